@@ -0,0 +1,81 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageLoadPng.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE)
+    namespace Avx2
+    {
+        static void DecodeLine2(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        {
+            if (srcN == dstN)
+            {
+                size_t size = size_t(width) * srcN, sizeA = AlignLo(size, A), i = 0;
+                for (; i < sizeA; i += A)
+                {
+                    __m256i _curr = _mm256_loadu_si256((__m256i*)(curr + i));
+                    __m256i _prev = _mm256_loadu_si256((__m256i*)(prev + i));
+                    _mm256_storeu_si256((__m256i*)(dst + i), _mm256_add_epi8(_curr, _prev));
+                }
+                for (; i < size; ++i)
+                    dst[i] = curr[i] + prev[i];
+            }
+            else
+                Base::DecodeLine2(curr, prev, width, srcN, dstN, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImagePngLoader::ImagePngLoader(const ImageLoaderParam& param)
+            : Sse41::ImagePngLoader(param)
+        {
+            _decodeLine[2] = Avx2::DecodeLine2;
+        }
+
+        void ImagePngLoader::SetConverter()
+        {
+            Sse41::ImagePngLoader::SetConverter();
+            if (_depth <= 8 && _width >= A)
+            {
+                if (_outN == 4)
+                {
+                    switch (_param.format)
+                    {
+                    case SimdPixelFormatBgr24: _converter = Avx2::BgraToRgb; break;
+                    case SimdPixelFormatBgra32: _converter = Avx2::BgraToRgba; break;
+                    case SimdPixelFormatRgb24: _converter = Avx2::BgraToBgr; break;
+                    default: break;
+                    }
+                }
+                else if (_outN == 3 && _param.format == SimdPixelFormatBgr24)
+                    _converter = Avx2::BgrToRgb;
+            }
+        }
+    }
+#endif
+}
@@ -46,6 +46,8 @@ namespace Simd
                 return new ResizerFloatBilinear(param);
             else if (param.IsByteBicubic())
                 return new ResizerByteBicubic(param);
+            else if (param.IsFilter())
+                return new ResizerFilter(param);
             else if (param.IsByteArea2x2())
 #if defined(SIMD_X86_ENABLE) && defined(NDEBUG) && defined(_MSC_VER) && _MSC_VER <= 1900
                 return new Sse41::ResizerByteArea2x2(param);
@@ -143,12 +143,13 @@ namespace Simd
             StoreBicubicInt<1>(dst0, dst);
         }
 
-        template<int N> void ResizerByteBicubic::RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        template<int N> void ResizerByteBicubic::RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd)
         {
             assert(_xn == 0 && _xt == _param.dstW);
             size_t step = 4 / N * 2;
             size_t body = AlignLoAny(_param.dstW - (N == 3 ? 1 : 0), step);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
                 const uint8_t* src1 = src + sy * srcStride;
@@ -263,10 +264,15 @@ namespace Simd
             }
         }
 
-        template<int N> void ResizerByteBicubic::RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        template<int N> void ResizerByteBicubic::RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf)
         {
+            size_t rs = _param.dstW * _param.channels;
+            int32_t* bx[4];
+            for (int i = 0; i < 4; ++i)
+                bx[i] = Allocate<int32_t>(buf, rs, _param.align);
             int32_t prev = -1;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 int32_t sy = _iy[dy], next = prev;
                 for (int32_t curr = sy - 1, end = sy + 3; curr < end; ++curr)
@@ -274,31 +280,31 @@ namespace Simd
                     if (curr < prev)
                         continue;
                     const uint8_t* ps = src + RestrictRange(curr, 0, (int)_param.srcH - 1) * srcStride;
-                    int32_t* pb = _bx[(curr + 1) & 3].data;
+                    int32_t* pb = bx[(curr + 1) & 3];
                     RowCubicSumX<N>(ps, _xn, _xt, _param.dstW, _ix.data, _ax.data, pb);
                     next++;
                 }
                 prev = next;
 
                 const int32_t* ay = _ay.data + dy * 4;
-                int32_t* pb0 = _bx[(sy + 0) & 3].data;
-                int32_t* pb1 = _bx[(sy + 1) & 3].data;
-                int32_t* pb2 = _bx[(sy + 2) & 3].data;
-                int32_t* pb3 = _bx[(sy + 3) & 3].data;
-                BicubicRowInt(pb0, pb1, pb2, pb3, _bx[0].size, ay, dst);
+                int32_t* pb0 = bx[(sy + 0) & 3];
+                int32_t* pb1 = bx[(sy + 1) & 3];
+                int32_t* pb2 = bx[(sy + 2) & 3];
+                int32_t* pb3 = bx[(sy + 3) & 3];
+                BicubicRowInt(pb0, pb1, pb2, pb3, rs, ay, dst);
             }
         }
 
-        void ResizerByteBicubic::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        void ResizerByteBicubic::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
         {
             bool sparse = _param.dstH * 3.0 <= _param.srcH;
             Init(sparse);
             switch (_param.channels)
             {
-            case 1: sparse ? Sse41::ResizerByteBicubic::RunS<1>(src, srcStride, dst, dstStride) : RunB<1>(src, srcStride, dst, dstStride); return;
-            case 2: sparse ? RunS<2>(src, srcStride, dst, dstStride) : RunB<2>(src, srcStride, dst, dstStride); return;
-            case 3: sparse ? RunS<3>(src, srcStride, dst, dstStride) : RunB<3>(src, srcStride, dst, dstStride); return;
-            case 4: sparse ? RunS<4>(src, srcStride, dst, dstStride) : RunB<4>(src, srcStride, dst, dstStride); return;
+            case 1: sparse ? Sse41::ResizerByteBicubic::RunS<1>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<1>(src, srcStride, dst, dstStride, yBeg, yEnd, Buffer(band)); return;
+            case 2: sparse ? RunS<2>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<2>(src, srcStride, dst, dstStride, yBeg, yEnd, Buffer(band)); return;
+            case 3: sparse ? RunS<3>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<3>(src, srcStride, dst, dstStride, yBeg, yEnd, Buffer(band)); return;
+            case 4: sparse ? RunS<4>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<4>(src, srcStride, dst, dstStride, yBeg, yEnd, Buffer(band)); return;
             default:
                 assert(0);
             }
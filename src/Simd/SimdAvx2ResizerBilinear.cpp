@@ -120,8 +120,7 @@ namespace Simd
                 }
             }
             size_t size = AlignHi(_param.dstW, _param.align)*_param.channels * 2 + SIMD_ALIGN;
-            _bx[0].Resize(size, false, _param.align);
-            _bx[1].Resize(size, false, _param.align);
+            SetBandSize(2 * AlignHi(size, _param.align));
         }
 
         template <size_t channelCount> void ResizerByteBilinearInterpolateX(const __m256i * alpha, __m256i * buffer);
@@ -227,7 +226,7 @@ namespace Simd
             Store<false>((__m256i*)dst, PackI16ToU8(lo, hi));
         }
 
-        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf)
         {
             struct One { uint8_t val[N * 1]; };
             struct Two { uint8_t val[N * 2]; };
@@ -238,11 +237,12 @@ namespace Simd
             size_t dstW = _param.dstW;
             ptrdiff_t previous = -2;
             __m256i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t* bx[2] = { buf, buf + _bandSize / 2 };
             const uint8_t * ax = _ax.data;
             const int32_t * ix = _ix.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm256_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm256_set1_epi16(int16_t(_ay[yDst]));
@@ -279,7 +279,7 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf)
         {
             size_t bufW = AlignHi(_param.dstW, A) * 2;
             size_t size = 2 * _param.dstW;
@@ -287,11 +287,12 @@ namespace Simd
             size_t blocks = _blocks;
             ptrdiff_t previous = -2;
             __m256i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t* bx[2] = { buf, buf + _bandSize / 2 };
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t yDst = yBeg; yDst < yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm256_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm256_set1_epi16(int16_t(_ay[yDst]));
@@ -324,7 +325,7 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
         {
             assert(_param.dstW >= A);
 
@@ -333,13 +334,13 @@ namespace Simd
             {
             case 1:
                 if (_blocks)
-                    RunG(src, srcStride, dst, dstStride);
+                    RunG(src, srcStride, dst, dstStride, yBeg, yEnd, Buffer(band));
                 else
-                    Run<1>(src, srcStride, dst, dstStride);
+                    Run<1>(src, srcStride, dst, dstStride, yBeg, yEnd, Buffer(band));
                 break;
-            case 2: Run<2>(src, srcStride, dst, dstStride); break;
-            case 3: Run<3>(src, srcStride, dst, dstStride); break;
-            case 4: Run<4>(src, srcStride, dst, dstStride); break;
+            case 2: Run<2>(src, srcStride, dst, dstStride, yBeg, yEnd, Buffer(band)); break;
+            case 3: Run<3>(src, srcStride, dst, dstStride, yBeg, yEnd, Buffer(band)); break;
+            case 4: Run<4>(src, srcStride, dst, dstStride, yBeg, yEnd, Buffer(band)); break;
             default:
                 assert(0);
             }
@@ -416,10 +417,10 @@ namespace Simd
             return _mm256_add_ps(m0, m1);
         }
 
-        template<size_t N> void ResizerShortBilinear::RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride)
+        template<size_t N> void ResizerShortBilinear::RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf)
         {
             size_t rs = _param.dstW * N;
-            float* pbx[2] = { _bx[0].data, _bx[1].data };
+            float* pbx[2] = { buf, buf + _bandSize / 2 / sizeof(float) };
             int32_t prev = -2;
             size_t rs3 = AlignLoAny(rs - 1, 3);
             size_t rs6 = AlignLoAny(rs - 1, 6);
@@ -427,7 +428,8 @@ namespace Simd
             size_t rs8 = AlignLo(rs, 8);
             size_t rs16 = AlignLo(rs, 16);
             __m256 _1 = _mm256_set1_ps(1.0f);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -556,7 +558,7 @@ namespace Simd
             return _mm256_permutevar8x32_epi32(_mm256_packus_epi32(lo, hi), RSB_3_P2);
         }
 
-        template<size_t N> void ResizerShortBilinear::RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride)
+        template<size_t N> void ResizerShortBilinear::RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd)
         {
             size_t rs = _param.dstW * N;
             size_t rs3 = AlignLoAny(rs - 1, 3);
@@ -566,7 +568,8 @@ namespace Simd
             size_t rs8 = AlignLo(rs, 8);
             size_t rs16 = AlignLo(rs, 16);
             __m256 _1 = _mm256_set1_ps(1.0f);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -728,15 +731,15 @@ namespace Simd
             }
         }
 
-        void ResizerShortBilinear::Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride)
+        void ResizerShortBilinear::Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf)
         {
             bool sparse = _param.dstH * 2.0 <= _param.srcH;
             switch (_param.channels)
             {
-            case 1: sparse ? RunS<1>(src, srcStride, dst, dstStride) : RunB<1>(src, srcStride, dst, dstStride); return;
-            case 2: sparse ? RunS<2>(src, srcStride, dst, dstStride) : RunB<2>(src, srcStride, dst, dstStride); return;
-            case 3: sparse ? RunS<3>(src, srcStride, dst, dstStride) : RunB<3>(src, srcStride, dst, dstStride); return;
-            case 4: sparse ? RunS<4>(src, srcStride, dst, dstStride) : RunB<4>(src, srcStride, dst, dstStride); return;
+            case 1: sparse ? RunS<1>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<1>(src, srcStride, dst, dstStride, yBeg, yEnd, buf); return;
+            case 2: sparse ? RunS<2>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<2>(src, srcStride, dst, dstStride, yBeg, yEnd, buf); return;
+            case 3: sparse ? RunS<3>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<3>(src, srcStride, dst, dstStride, yBeg, yEnd, buf); return;
+            case 4: sparse ? RunS<4>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<4>(src, srcStride, dst, dstStride, yBeg, yEnd, buf); return;
             default:
                 assert(0);
             }
@@ -749,15 +752,16 @@ namespace Simd
         {
         }
 
-        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf)
         {
             size_t cn = _param.channels;
             size_t rs = _param.dstW * cn;
-            float * pbx[2] = { _bx[0].data, _bx[1].data };
+            float* pbx[2] = { buf, buf + _bandSize / 2 / sizeof(float) };
             int32_t prev = -2;
             size_t rsa = AlignLo(rs, Avx::F);
             size_t rsh = AlignLo(rs, Sse41::F);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -0,0 +1,177 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdResizerCommon.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        template<class T> SIMD_INLINE __m256 ResizerFilterLoad(const T* src);
+
+        template<> SIMD_INLINE __m256 ResizerFilterLoad<uint8_t>(const uint8_t* src)
+        {
+            return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)src)));
+        }
+
+        template<> SIMD_INLINE __m256 ResizerFilterLoad<uint16_t>(const uint16_t* src)
+        {
+            return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)src)));
+        }
+
+        template<> SIMD_INLINE __m256 ResizerFilterLoad<float>(const float* src)
+        {
+            return _mm256_loadu_ps(src);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterRowVert1(const uint8_t* src, size_t stride, const float* ay, size_t ky, float* dst)
+        {
+            __m256 sum = _mm256_mul_ps(ResizerFilterLoad((const T*)src), _mm256_set1_ps(ay[0]));
+            for (size_t k = 1; k < ky; ++k)
+                sum = _mm256_fmadd_ps(ResizerFilterLoad((const T*)(src + k * stride)), _mm256_set1_ps(ay[k]), sum);
+            _mm256_storeu_ps(dst, sum);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterRowVert2(const uint8_t* src, size_t stride, const float* ay, size_t ky, float* dst)
+        {
+            __m256 _ay = _mm256_set1_ps(ay[0]);
+            __m256 sum0 = _mm256_mul_ps(ResizerFilterLoad((const T*)src + 0), _ay);
+            __m256 sum1 = _mm256_mul_ps(ResizerFilterLoad((const T*)src + F), _ay);
+            for (size_t k = 1; k < ky; ++k)
+            {
+                const T* ps = (const T*)(src + k * stride);
+                _ay = _mm256_set1_ps(ay[k]);
+                sum0 = _mm256_fmadd_ps(ResizerFilterLoad(ps + 0), _ay, sum0);
+                sum1 = _mm256_fmadd_ps(ResizerFilterLoad(ps + F), _ay, sum1);
+            }
+            _mm256_storeu_ps(dst + 0, sum0);
+            _mm256_storeu_ps(dst + F, sum1);
+        }
+
+        template<class T> void ResizerFilterRowVert(const uint8_t* src, size_t stride, size_t size, const float* ay, size_t ky, float* dst)
+        {
+            if (size < F)
+            {
+                const T* ps = (const T*)src;
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] = float(ps[i]) * ay[0];
+                for (size_t k = 1; k < ky; ++k)
+                {
+                    ps = (const T*)(src + k * stride);
+                    for (size_t i = 0; i < size; ++i)
+                        dst[i] += float(ps[i]) * ay[k];
+                }
+                return;
+            }
+            size_t size2F = AlignLo(size, 2 * F), sizeF = AlignLo(size, F), i = 0;
+            for (; i < size2F; i += 2 * F)
+                ResizerFilterRowVert2<T>(src + i * sizeof(T), stride, ay, ky, dst + i);
+            for (; i < sizeF; i += F)
+                ResizerFilterRowVert1<T>(src + i * sizeof(T), stride, ay, ky, dst + i);
+            if (i < size)
+                ResizerFilterRowVert1<T>(src + (size - F) * sizeof(T), stride, ay, ky, dst + size - F);
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        template<class T> SIMD_INLINE void ResizerFilterStore4(__m128 value, T* dst);
+
+        template<> SIMD_INLINE void ResizerFilterStore4(__m128 value, uint8_t* dst)
+        {
+            __m128i u8 = _mm_packus_epi16(_mm_packus_epi32(_mm_cvtps_epi32(value), Sse41::K_ZERO), Sse41::K_ZERO);
+            *(int32_t*)dst = _mm_cvtsi128_si32(u8);
+        }
+
+        template<> SIMD_INLINE void ResizerFilterStore4(__m128 value, uint16_t* dst)
+        {
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi32(_mm_cvtps_epi32(value), Sse41::K_ZERO));
+        }
+
+        template<> SIMD_INLINE void ResizerFilterStore4(__m128 value, float* dst)
+        {
+            _mm_storeu_ps(dst, value);
+        }
+
+        template<class T> void ResizerFilterRowHorz4(const float* src, size_t width, const int32_t* ix, const float* ax, size_t kx, uint8_t* dst)
+        {
+            T* pd = (T*)dst;
+            size_t width2 = AlignLo(width, 2), dx = 0;
+            for (; dx < width2; dx += 2, ax += 2 * kx, pd += 8)
+            {
+                const float* ps0 = src + ix[dx + 0];
+                const float* ps1 = src + ix[dx + 1];
+                const float* ax0 = ax + 0 * kx;
+                const float* ax1 = ax + 1 * kx;
+                __m256 sum = _mm256_setzero_ps();
+                for (size_t k = 0; k < kx; ++k)
+                {
+                    __m256 _src = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(ps0 + 4 * k)), _mm_loadu_ps(ps1 + 4 * k), 1);
+                    __m256 _ax = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(ax0[k])), _mm_set1_ps(ax1[k]), 1);
+                    sum = _mm256_fmadd_ps(_src, _ax, sum);
+                }
+                ResizerFilterStore4(_mm256_castps256_ps128(sum), pd + 0);
+                ResizerFilterStore4(_mm256_extractf128_ps(sum, 1), pd + 4);
+            }
+            for (; dx < width; dx++, ax += kx, pd += 4)
+            {
+                const float* ps = src + ix[dx];
+                __m128 sum = _mm_setzero_ps();
+                for (size_t k = 0; k < kx; ++k)
+                    sum = _mm_fmadd_ps(_mm_loadu_ps(ps + 4 * k), _mm_set1_ps(ax[k]), sum);
+                ResizerFilterStore4(sum, pd);
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        ResizerFilter::ResizerFilter(const ResParam& param)
+            : Sse41::ResizerFilter(param)
+        {
+            switch (_param.type)
+            {
+            case SimdResizeChannelByte:
+                _rowVert = ResizerFilterRowVert<uint8_t>;
+                if (_param.channels == 4)
+                    _rowHorz = ResizerFilterRowHorz4<uint8_t>;
+                break;
+            case SimdResizeChannelShort:
+                _rowVert = ResizerFilterRowVert<uint16_t>;
+                if (_param.channels == 4)
+                    _rowHorz = ResizerFilterRowHorz4<uint16_t>;
+                break;
+            case SimdResizeChannelFloat:
+                _rowVert = ResizerFilterRowVert<float>;
+                if (_param.channels == 4)
+                    _rowHorz = ResizerFilterRowHorz4<float>;
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif
+}
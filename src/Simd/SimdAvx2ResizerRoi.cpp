@@ -0,0 +1,165 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizerRoi.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<class T> SIMD_INLINE __m256 RoiLoad(const T* src);
+
+        template<> SIMD_INLINE __m256 RoiLoad(const uint8_t* src)
+        {
+            return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)src)));
+        }
+
+        template<> SIMD_INLINE __m256 RoiLoad(const float* src)
+        {
+            return _mm256_loadu_ps(src);
+        }
+
+        template<class T> SIMD_INLINE void ResizerRoiVert(const T* src0, const T* src1, __m256 alpha, float* dst)
+        {
+            __m256 s0 = RoiLoad(src0);
+            _mm256_storeu_ps(dst, _mm256_fmadd_ps(_mm256_sub_ps(RoiLoad(src1), s0), alpha, s0));
+        }
+
+        template<class T> void ResizerRoiVert(const uint8_t* src0, const uint8_t* src1, float alpha, size_t size, float* dst)
+        {
+            const T* s0 = (const T*)src0;
+            const T* s1 = (const T*)src1;
+            if (size >= F)
+            {
+                __m256 _alpha = _mm256_set1_ps(alpha);
+                size_t sizeF = AlignLo(size, F), sizeQF = AlignLo(size, QF), i = 0;
+                for (; i < sizeQF; i += QF)
+                {
+                    ResizerRoiVert(s0 + i + 0 * F, s1 + i + 0 * F, _alpha, dst + i + 0 * F);
+                    ResizerRoiVert(s0 + i + 1 * F, s1 + i + 1 * F, _alpha, dst + i + 1 * F);
+                    ResizerRoiVert(s0 + i + 2 * F, s1 + i + 2 * F, _alpha, dst + i + 2 * F);
+                    ResizerRoiVert(s0 + i + 3 * F, s1 + i + 3 * F, _alpha, dst + i + 3 * F);
+                }
+                for (; i < sizeF; i += F)
+                    ResizerRoiVert(s0 + i, s1 + i, _alpha, dst + i);
+                if (i < size)
+                    ResizerRoiVert(s0 + size - F, s1 + size - F, _alpha, dst + size - F);
+            }
+            else
+            {
+                for (size_t i = 0; i < size; ++i)
+                {
+                    float v0 = (float)s0[i];
+                    dst[i] = v0 + ((float)s1[i] - v0) * alpha;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void ResizerRoiHorz1(const float* src, const int32_t* ix, const float* ax, size_t width, float* dst)
+        {
+            size_t widthF = AlignLo(width, F), x = 0;
+            for (; x < widthF; x += F)
+            {
+                __m256i idx = _mm256_loadu_si256((__m256i*)(ix + x));
+                __m256 s0 = _mm256_i32gather_ps(src + 0, idx, 4);
+                __m256 s1 = _mm256_i32gather_ps(src + 1, idx, 4);
+                _mm256_storeu_ps(dst + x, _mm256_fmadd_ps(_mm256_sub_ps(s1, s0), _mm256_loadu_ps(ax + x), s0));
+            }
+            for (; x < width; ++x)
+            {
+                const float* s = src + ix[x];
+                dst[x] = s[0] + (s[1] - s[0]) * ax[x];
+            }
+        }
+
+        SIMD_INLINE __m256i RoiRound(const float* src)
+        {
+            return _mm256_cvtps_epi32(_mm256_loadu_ps(src));
+        }
+
+        SIMD_INLINE void ResizerRoiStore16(const float* src, uint8_t* dst)
+        {
+            __m256i i16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(RoiRound(src + 0), RoiRound(src + F)), 0xD8);
+            __m256i u8 = _mm256_permute4x64_epi64(_mm256_packus_epi16(i16, i16), 0x08);
+            _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(u8));
+        }
+
+        template<class T> void ResizerRoiHorz1(const float* src, const int32_t* ix, const float* ax, size_t width, size_t channels, float* buf, uint8_t* dst)
+        {
+            if (sizeof(T) == 4)
+                ResizerRoiHorz1(src, ix, ax, width, (float*)dst);
+            else
+            {
+                ResizerRoiHorz1(src, ix, ax, width, buf);
+                size_t i = 0;
+                if (width >= DF)
+                {
+                    size_t widthDF = AlignLo(width, DF);
+                    for (; i < widthDF; i += DF)
+                        ResizerRoiStore16(buf + i, dst + i);
+                    if (i < width)
+                        ResizerRoiStore16(buf + width - DF, dst + width - DF);
+                }
+                else
+                {
+                    for (; i < width; ++i)
+                        dst[i] = (uint8_t)Simd::RestrictRange(Round(buf[i]), 0, 255);
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ResizerRoi::ResizerRoi(const Base::RoiResParam& param)
+            : Sse41::ResizerRoi(param)
+        {
+            if (_param.type == SimdResizeChannelFloat)
+            {
+                _vert = ResizerRoiVert<float>;
+                if (_param.channels == 1)
+                    _horz = ResizerRoiHorz1<float>;
+            }
+            else
+            {
+                _vert = ResizerRoiVert<uint8_t>;
+                if (_param.channels == 1)
+                    _horz = ResizerRoiHorz1<uint8_t>;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerRoiInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            Base::RoiResParam param(srcX, srcY, dstX, dstY, channels, type, method);
+            if (!param.Valid())
+                return NULL;
+            return new ResizerRoi(param);
+        }
+    }
+#endif
+}
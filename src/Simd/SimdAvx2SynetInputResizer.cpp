@@ -0,0 +1,111 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetInputResizer.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Avx2
+    {
+        SIMD_INLINE __m256 InputResizerLerp(const float* src0, const float* src1, __m256 alpha)
+        {
+            __m256 s0 = _mm256_loadu_ps(src0);
+            return _mm256_add_ps(s0, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(src1), s0), alpha));
+        }
+
+        template<SimdTensorDataType type> SIMD_INLINE void InputResizerStore(__m256 value, uint8_t* dst);
+
+        template<> SIMD_INLINE void InputResizerStore<SimdTensorData32f>(__m256 value, uint8_t* dst)
+        {
+            _mm256_storeu_ps((float*)dst, value);
+        }
+
+        template<> SIMD_INLINE void InputResizerStore<SimdTensorData16b>(__m256 value, uint8_t* dst)
+        {
+            __m256i u32 = Float32ToBFloat16(value);
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi32(_mm256_castsi256_si128(u32), _mm256_extracti128_si256(u32, 1)));
+        }
+
+        template<> SIMD_INLINE void InputResizerStore<SimdTensorData8u>(__m256 value, uint8_t* dst)
+        {
+            __m256i i32 = _mm256_cvtps_epi32(value);
+            __m128i i16 = _mm_packs_epi32(_mm256_castsi256_si128(i32), _mm256_extracti128_si256(i32, 1));
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(i16, Sse41::K_ZERO));
+        }
+
+        template<SimdTensorDataType type> void InputResizerVert(const float* src0, const float* src1, float alpha, size_t size, uint8_t* dst)
+        {
+            const size_t elem = type == SimdTensorData32f ? 4 : (type == SimdTensorData16b ? 2 : 1);
+            __m256 _alpha = _mm256_set1_ps(alpha);
+            if (size < F)
+            {
+                float buf0[F] = { 0 }, buf1[F] = { 0 };
+                SIMD_ALIGNED(32) uint8_t buf[F * 4];
+                for (size_t i = 0; i < size; ++i)
+                    buf0[i] = src0[i], buf1[i] = src1[i];
+                InputResizerStore<type>(InputResizerLerp(buf0, buf1, _alpha), buf);
+                memcpy(dst, buf, size * elem);
+                return;
+            }
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                InputResizerStore<type>(InputResizerLerp(src0 + i, src1 + i, _alpha), dst + i * elem);
+            if (i < size)
+            {
+                i = size - F;
+                InputResizerStore<type>(InputResizerLerp(src0 + i, src1 + i, _alpha), dst + i * elem);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetInputResizer::SynetInputResizer(const Base::InputResizerParam& param)
+            : Sse41::SynetInputResizer(param)
+        {
+            switch (_param.dstType)
+            {
+            case SimdTensorData32f: _vert = InputResizerVert<SimdTensorData32f>; break;
+            case SimdTensorData16b: _vert = InputResizerVert<SimdTensorData16b>; break;
+            case SimdTensorData8u: _vert = InputResizerVert<SimdTensorData8u>; break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetInputResizerInit(SimdPixelFormatType srcFormat, SimdYuvLayoutType yuvLayout, SimdYuvType yuvType,
+            size_t cropX, size_t cropY, size_t cropWidth, size_t cropHeight, size_t dstWidth, size_t dstHeight, size_t channels,
+            const float* mean, const float* scale, SimdTensorDataType dstType, SimdTensorFormatType dstFormat)
+        {
+            Base::InputResizerParam param(srcFormat, yuvLayout, yuvType, cropX, cropY, cropWidth, cropHeight, dstWidth, dstHeight, channels, mean, scale, dstType, dstFormat);
+            if (!param.Valid())
+                return NULL;
+            return new SynetInputResizer(param);
+        }
+    }
+#endif
+}
@@ -66,89 +66,102 @@ namespace Simd
             return (hi << 16) | lo;
         }
 
-        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        void ZlibDeflate(const uint8_t* data, int begin, int end, int level, bool last, OutputMemoryStream& stream)
         {
-            const int ZHASH = 16384;
-            if (quality < 5)
-                quality = 5;
-            const int basket = quality * 2;
-            Array32i hashTable(ZHASH * basket);
-            memset(hashTable.data, -1, hashTable.RawSize());
-
-            stream.Write(uint8_t(0x78));
-            stream.Write(uint8_t(0x5e));
-            stream.WriteBits(1, 1);
+            stream.WriteBits(last ? 1 : 0, 1);
             stream.WriteBits(1, 2);
-
-            int i = 0, j;
-            while (i < size - 3)
+            int i = begin, j;
+            if (level < 2)
             {
-                int h = Base::ZlibHash(data + i) & (ZHASH - 1), best = 3;
-                uint8_t* bestLoc = 0;
-                int* hList = hashTable.data + h * basket;
-                for (j = 0; hList[j] != -1 && j < basket; ++j)
+                while (i < end)
                 {
-                    if (hList[j] > i - 32768)
+                    int run = i ? ZlibCount(data + i - 1, data + i, end - i) : 0;
+                    if (run >= 3)
                     {
-                        int d = ZlibCount(data + hList[j], data + i, size - i);
-                        if (d >= best)
-                        {
-                            best = d;
-                            bestLoc = data + hList[j];
-                        }
+                        Base::ZlibMatch(run, 1, stream);
+                        i += run;
+                    }
+                    else
+                    {
+                        Base::ZlibHuffB(data[i], stream);
+                        ++i;
                     }
                 }
-                if (j == basket)
-                {
-                    memcpy(hList, hList + quality, quality * sizeof(int));
-                    memset(hList + quality, -1, quality * sizeof(int));
-                    j = quality;
-                }
-                hList[j] = i;
-
-                if (bestLoc)
+            }
+            else
+            {
+                const int ZHASH = 16384;
+                const int basket = level * 2;
+                Array32i hashTable(ZHASH * basket);
+                memset(hashTable.data, -1, hashTable.RawSize());
+                for (int p = Max(begin - 32768, 0); p < begin; ++p)
+                    Base::ZlibInsert(hashTable.data + (Base::ZlibHash(data + p) & (ZHASH - 1)) * basket, basket, p);
+                while (i < end - 3)
                 {
-                    h = Base::ZlibHash(data + i + 1) & (ZHASH - 1);
+                    int h = Base::ZlibHash(data + i) & (ZHASH - 1), best = 3;
+                    const uint8_t* bestLoc = NULL;
                     int* hList = hashTable.data + h * basket;
-                    for (j = 0; hList[j] != -1 && j < basket; ++j)
+                    for (j = 0; j < basket && hList[j] != -1; ++j)
                     {
-                        if (hList[j] > i - 32767)
+                        if (hList[j] > i - 32768)
                         {
-                            int e = ZlibCount(data + hList[j], data + i + 1, size - i - 1);
-                            if (e > best)
+                            int d = ZlibCount(data + hList[j], data + i, end - i);
+                            if (d >= best)
                             {
-                                bestLoc = NULL;
-                                break;
+                                best = d;
+                                bestLoc = data + hList[j];
                             }
                         }
                     }
-                }
+                    if (j == basket)
+                    {
+                        memcpy(hList, hList + level, level * sizeof(int));
+                        memset(hList + level, -1, level * sizeof(int));
+                        j = level;
+                    }
+                    hList[j] = i;
 
-                if (bestLoc)
-                {
-                    int d = (int)(data + i - bestLoc);
-                    assert(d <= 32767 && best <= 258);
-                    for (j = 0; best > Base::ZlibLenC[j + 1] - 1; ++j);
-                    Base::ZlibHuff(j + 257, stream);
-                    if (Base::ZlibLenEb[j])
-                        stream.WriteBits(best - Base::ZlibLenC[j], Base::ZlibLenEb[j]);
-                    for (j = 0; d > Base::ZlibDistC[j + 1] - 1; ++j);
-                    stream.WriteBits(Base::ZlibBitRev(j, 5), 5);
-                    if (Base::ZlibDistEb[j])
-                        stream.WriteBits(d - Base::ZlibDistC[j], Base::ZlibDistEb[j]);
-                    i += best;
+                    if (bestLoc)
+                    {
+                        h = Base::ZlibHash(data + i + 1) & (ZHASH - 1);
+                        int* hList = hashTable.data + h * basket;
+                        for (j = 0; j < basket && hList[j] != -1; ++j)
+                        {
+                            if (hList[j] > i - 32767)
+                            {
+                                int e = ZlibCount(data + hList[j], data + i + 1, end - i - 1);
+                                if (e > best)
+                                {
+                                    bestLoc = NULL;
+                                    break;
+                                }
+                            }
+                        }
+                    }
+
+                    if (bestLoc)
+                    {
+                        Base::ZlibMatch(best, (int)(data + i - bestLoc), stream);
+                        i += best;
+                    }
+                    else
+                    {
+                        Base::ZlibHuffB(data[i], stream);
+                        ++i;
+                    }
                 }
-                else
-                {
+                for (; i < end; ++i)
                     Base::ZlibHuffB(data[i], stream);
-                    ++i;
-                }
             }
-            for (; i < size; ++i)
-                Base::ZlibHuffB(data[i], stream);
             Base::ZlibHuff(256, stream);
-            stream.FlushBits();
-            stream.WriteBe32u(ZlibAdler32(data, size));
+            if (!last)
+            {
+                stream.WriteBits(0, 3);
+                stream.FlushBits();
+                stream.WriteBe32u(0x0000FFFF);
+            }
+            else
+                stream.FlushBits();
         }
 
         uint32_t EncodeLine0(const uint8_t* src, size_t stride, size_t n, size_t size, int8_t* dst)
@@ -394,7 +407,8 @@ namespace Simd
             _encode[4] = Avx512bw::EncodeLine4;
             _encode[5] = Avx512bw::EncodeLine5;
             _encode[6] = Avx512bw::EncodeLine6;
-            _compress = Avx512bw::ZlibCompress;
+            _deflate = Avx512bw::ZlibDeflate;
+            _adler = Avx512bw::ZlibAdler32;
         }
     }
 #endif// SIMD_AVX512BW_ENABLE
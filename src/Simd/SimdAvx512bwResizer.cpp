@@ -45,6 +45,8 @@ namespace Simd
                 return new ResizerFloatBilinear(param);
             else if (param.IsByteBicubic())
                 return new ResizerByteBicubic(param);
+            else if (param.IsFilter())
+                return new ResizerFilter(param);
             else if (param.IsByteArea2x2())
                 return new ResizerByteArea2x2(param);
             else if (param.IsByteArea1x1())
@@ -129,16 +129,18 @@ namespace Simd
                 ResizerByteArea1x1RowUpdate<UpdateSet>(src, size, aligned, curr - next, dst, tail);
         }
 
-        template<size_t N> void ResizerByteArea1x1::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea1x1::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, int32_t* by)
         {
             size_t bodyW = _param.dstW - (N == 3 ? 1 : 0), rowSize = _param.srcW * N, rowRest = dstStride - _param.dstW * N;
             const int32_t * iy = _iy.data, *ix = _ix.data, *ay = _ay.data, *ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
             size_t rowSizeA = AlignLo(rowSize, A);
             __mmask64 tail = TailMask64(rowSize - rowSizeA);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += iy[yBeg] * srcStride;
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += rowRest)
             {
-                int32_t * buf = _by.data;
+                int32_t * buf = by;
                 size_t yn = iy[dy + 1] - iy[dy];
                 ResizerByteArea1x1RowSum(src, srcStride, yn, rowSize, rowSizeA, ay[dy], ay0, ay[dy + 1], buf, tail), src += yn * srcStride;
                 size_t dx = 0;
@@ -155,14 +157,14 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea1x1::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteArea1x1::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
+            case 2: Run<2>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
+            case 3: Run<3>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
+            case 4: Run<4>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
             default:
                 assert(0);
             }
@@ -297,14 +299,16 @@ namespace Simd
                 ResizerByteArea2x2RowUpdateBgr<UpdateSet>(src, tail ? src : src + stride, size, curr - next, dst);
         }
 
-        template<size_t N> void ResizerByteArea2x2::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea2x2::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, int32_t* by)
         {
             size_t bodyW = _param.dstW - (N == 3 ? 1 : 0), rowSize = _param.srcW * N, rowRest = dstStride - _param.dstW * N;
             const int32_t* iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += iy[yBeg] * 2 * srcStride;
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += rowRest)
             {
-                int32_t* buf = _by.data;
+                int32_t* buf = by;
                 size_t yn = (iy[dy + 1] - iy[dy]) * 2;
                 bool tail = (dy == _param.dstH - 1) && (_param.srcH & 1);
                 ResizerByteArea2x2RowSum<N>(src, srcStride, yn, rowSize, ay[dy], ay0, ay[dy + 1], tail, buf), src += yn * srcStride;
@@ -322,14 +326,14 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea2x2::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        void ResizerByteArea2x2::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
+            case 2: Run<2>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
+            case 3: Run<3>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
+            case 4: Run<4>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
             default:
                 assert(0);
             }
@@ -132,12 +132,13 @@ namespace Simd
             StoreBicubicInt<N>(dst0, dst);
         }
 
-        template<int N> void ResizerByteBicubic::RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        template<int N> void ResizerByteBicubic::RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd)
         {
             assert(_xn == 0 && _xt == _param.dstW);
             size_t step = 4 / N * 4;
             size_t body = AlignLoAny(_param.dstW, step);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
                 const uint8_t* src1 = src + sy * srcStride;
@@ -185,13 +186,14 @@ namespace Simd
             _mm_mask_storeu_epi8(dst, mask, _mm512_cvtusepi32_epi8(_mm512_max_epi32(dst0, _mm512_setzero_si512())));
         }
 
-        template<> void ResizerByteBicubic::RunS<1>(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        template<> void ResizerByteBicubic::RunS<1>(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd)
         {
             assert(_xn == 0 && _xt == _param.dstW);
             size_t step = 16;
             size_t body = AlignLoAny(_param.dstW, step);
             __mmask16 tail = TailMask16(_param.dstW - body);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
                 const uint8_t* src1 = src + sy * srcStride;
@@ -245,13 +247,14 @@ namespace Simd
             _mm_mask_storeu_epi16((int16_t*)dst, mask, _mm512_cvtusepi32_epi8(_mm512_max_epi32(dst0, _mm512_setzero_si512())));
         }
 
-        template<> void ResizerByteBicubic::RunS<2>(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        template<> void ResizerByteBicubic::RunS<2>(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd)
         {
             assert(_xn == 0 && _xt == _param.dstW);
             size_t step = 8;
             size_t body = AlignLoAny(_param.dstW, step);
             __mmask8 tail = TailMask8(_param.dstW - body);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
                 const uint8_t* src1 = src + sy * srcStride;
@@ -310,7 +313,7 @@ namespace Simd
             _mm_mask_storeu_epi8(dst, dstMask, _mm512_cvtusepi32_epi8(_mm512_max_epi32(dst0, _mm512_setzero_si512())));
         }
 
-        template<> void ResizerByteBicubic::RunS<3>(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        template<> void ResizerByteBicubic::RunS<3>(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd)
         {
             assert(_xn == 0 && _xt == _param.dstW);
             size_t step = 4;
@@ -322,7 +325,8 @@ namespace Simd
             srcMaskTail[3] = tail > 3 ? 0x7 : 0x0;
             srcMaskTail[4] = TailMask8(tail);
             __mmask16 dstMaskTail = TailMask16(tail * 3);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
                 const uint8_t* src1 = src + sy * srcStride;
@@ -380,7 +384,7 @@ namespace Simd
             _mm_mask_storeu_epi8(dst, dstMask, _mm512_cvtusepi32_epi8(_mm512_max_epi32(dst0, _mm512_setzero_si512())));
         }
 
-        template<> void ResizerByteBicubic::RunS<4>(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        template<> void ResizerByteBicubic::RunS<4>(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd)
         {
             assert(_xn == 0 && _xt == _param.dstW);
             size_t step = 4;
@@ -392,7 +396,8 @@ namespace Simd
             srcMaskTail[3] = tail > 3 ? 0xF : 0x0;
             srcMaskTail[4] = TailMask8(tail);
             __mmask16 dstMaskTail = TailMask16(tail * 4);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
                 const uint8_t* src1 = src + sy * srcStride;
@@ -511,13 +516,18 @@ namespace Simd
             }
         }
 
-        template<int N> void ResizerByteBicubic::RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        template<int N> void ResizerByteBicubic::RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf)
         {
-            size_t rowBody = AlignLo(_bx[0].size, F);
-            __mmask16 rowTail = TailMask16(_bx[0].size - rowBody);
+            size_t rs = _param.dstW * _param.channels;
+            int32_t* bx[4];
+            for (int i = 0; i < 4; ++i)
+                bx[i] = Allocate<int32_t>(buf, rs, _param.align);
+            size_t rowBody = AlignLo(rs, F);
+            __mmask16 rowTail = TailMask16(rs - rowBody);
 
             int32_t prev = -1;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 int32_t sy = _iy[dy], next = prev;
                 for (int32_t curr = sy - 1, end = sy + 3; curr < end; ++curr)
@@ -525,17 +535,17 @@ namespace Simd
                     if (curr < prev)
                         continue;
                     const uint8_t* ps = src + RestrictRange(curr, 0, (int)_param.srcH - 1) * srcStride;
-                    int32_t* pb = _bx[(curr + 1) & 3].data;
+                    int32_t* pb = bx[(curr + 1) & 3];
                     RowCubicSumX<N>(ps, _xn, _xt, _param.dstW, _ix.data, _ax.data, pb);
                     next++;
                 }
                 prev = next;
 
                 const int32_t* ay = _ay.data + dy * 4;
-                int32_t* pb0 = _bx[(sy + 0) & 3].data;
-                int32_t* pb1 = _bx[(sy + 1) & 3].data;
-                int32_t* pb2 = _bx[(sy + 2) & 3].data;
-                int32_t* pb3 = _bx[(sy + 3) & 3].data;
+                int32_t* pb0 = bx[(sy + 0) & 3];
+                int32_t* pb1 = bx[(sy + 1) & 3];
+                int32_t* pb2 = bx[(sy + 2) & 3];
+                int32_t* pb3 = bx[(sy + 3) & 3];
                 BicubicRowInt(pb0, pb1, pb2, pb3, ay, rowBody, rowTail, dst);
             }
         }
@@ -566,13 +576,18 @@ namespace Simd
                 Base::PixelCubicSumX<1, -1, 1>(src + ix[dx], ax, dst);
         }
 
-        template<> void ResizerByteBicubic::RunB<1>(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        template<> void ResizerByteBicubic::RunB<1>(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf)
         {
-            size_t rowBody = AlignLo(_bx[0].size, F);
-            __mmask16 rowTail = TailMask16(_bx[0].size - rowBody);
+            size_t rs = _param.dstW * _param.channels;
+            int32_t* bx[4];
+            for (int i = 0; i < 4; ++i)
+                bx[i] = Allocate<int32_t>(buf, rs, _param.align);
+            size_t rowBody = AlignLo(rs, F);
+            __mmask16 rowTail = TailMask16(rs - rowBody);
 
             int32_t prev = -1;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 int32_t sy = _iy[dy], next = prev;
                 for (int32_t curr = sy - 1, end = sy + 3; curr < end; ++curr)
@@ -580,41 +595,41 @@ namespace Simd
                     if (curr < prev)
                         continue;
                     const uint8_t* ps = src + RestrictRange(curr, 0, (int)_param.srcH - 1) * srcStride;
-                    int32_t* pb = _bx[(curr + 1) & 3].data;
+                    int32_t* pb = bx[(curr + 1) & 3];
                     RowCubicSumX1(ps, _xn, _xt, _param.dstW, _ix.data, _ax.data, pb);
                     next++;
                 }
                 prev = next;
 
                 const int32_t* ay = _ay.data + dy * 4;
-                int32_t* pb0 = _bx[(sy + 0) & 3].data;
-                int32_t* pb1 = _bx[(sy + 1) & 3].data;
-                int32_t* pb2 = _bx[(sy + 2) & 3].data;
-                int32_t* pb3 = _bx[(sy + 3) & 3].data;
+                int32_t* pb0 = bx[(sy + 0) & 3];
+                int32_t* pb1 = bx[(sy + 1) & 3];
+                int32_t* pb2 = bx[(sy + 2) & 3];
+                int32_t* pb3 = bx[(sy + 3) & 3];
                 BicubicRowInt(pb0, pb1, pb2, pb3, ay, rowBody, rowTail, dst);
             }
         }
 
         //-----------------------------------------------------------------------------------------
 
-        void ResizerByteBicubic::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        void ResizerByteBicubic::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
         {
             bool sparse = _param.dstH * 3.0 <= _param.srcH;
             Init(sparse);
             switch (_param.channels)
             {
-            case 1: sparse ? RunS<1>(src, srcStride, dst, dstStride) : RunB<1>(src, srcStride, dst, dstStride); return;
-            case 2: sparse ? RunS<2>(src, srcStride, dst, dstStride) : RunB<2>(src, srcStride, dst, dstStride); return;
-            case 3: sparse ? RunS<3>(src, srcStride, dst, dstStride) : RunB<3>(src, srcStride, dst, dstStride); return;
-            case 4: sparse ? RunS<4>(src, srcStride, dst, dstStride) : RunB<4>(src, srcStride, dst, dstStride); return;
+            case 1: sparse ? RunS<1>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<1>(src, srcStride, dst, dstStride, yBeg, yEnd, Buffer(band)); return;
+            case 2: sparse ? RunS<2>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<2>(src, srcStride, dst, dstStride, yBeg, yEnd, Buffer(band)); return;
+            case 3: sparse ? RunS<3>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<3>(src, srcStride, dst, dstStride, yBeg, yEnd, Buffer(band)); return;
+            case 4: sparse ? RunS<4>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<4>(src, srcStride, dst, dstStride, yBeg, yEnd, Buffer(band)); return;
             default:
                 assert(0);
             }
         }
 #else // SIMD_AVX512BW_RESIZER_BYTE_BICUBIC_MSVS_COMPER_ERROR
-        void ResizerByteBicubic::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        void ResizerByteBicubic::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
         {
-            Avx2::ResizerByteBicubic::Run(src, srcStride, dst, dstStride);
+            Avx2::ResizerByteBicubic::Run(src, srcStride, dst, dstStride, yBeg, yEnd, band);
         }
 #endif // SIMD_AVX512BW_RESIZER_BYTE_BICUBIC_MSVS_COMPER_ERROR
     }
@@ -0,0 +1,108 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdResizerCommon.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        template<class T> SIMD_INLINE __m512 ResizerFilterLoad(const T* src, __mmask16 tail = -1);
+
+        template<> SIMD_INLINE __m512 ResizerFilterLoad<uint8_t>(const uint8_t* src, __mmask16 tail)
+        {
+            return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, src)));
+        }
+
+        template<> SIMD_INLINE __m512 ResizerFilterLoad<uint16_t>(const uint16_t* src, __mmask16 tail)
+        {
+            return _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(tail, src)));
+        }
+
+        template<> SIMD_INLINE __m512 ResizerFilterLoad<float>(const float* src, __mmask16 tail)
+        {
+            return _mm512_maskz_loadu_ps(tail, src);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterRowVert1(const uint8_t* src, size_t stride, const float* ay, size_t ky, float* dst, __mmask16 tail = -1)
+        {
+            __m512 sum = _mm512_mul_ps(ResizerFilterLoad((const T*)src, tail), _mm512_set1_ps(ay[0]));
+            for (size_t k = 1; k < ky; ++k)
+                sum = _mm512_fmadd_ps(ResizerFilterLoad((const T*)(src + k * stride), tail), _mm512_set1_ps(ay[k]), sum);
+            _mm512_mask_storeu_ps(dst, tail, sum);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterRowVert2(const uint8_t* src, size_t stride, const float* ay, size_t ky, float* dst)
+        {
+            __m512 _ay = _mm512_set1_ps(ay[0]);
+            __m512 sum0 = _mm512_mul_ps(ResizerFilterLoad((const T*)src + 0), _ay);
+            __m512 sum1 = _mm512_mul_ps(ResizerFilterLoad((const T*)src + F), _ay);
+            for (size_t k = 1; k < ky; ++k)
+            {
+                const T* ps = (const T*)(src + k * stride);
+                _ay = _mm512_set1_ps(ay[k]);
+                sum0 = _mm512_fmadd_ps(ResizerFilterLoad(ps + 0), _ay, sum0);
+                sum1 = _mm512_fmadd_ps(ResizerFilterLoad(ps + F), _ay, sum1);
+            }
+            _mm512_storeu_ps(dst + 0, sum0);
+            _mm512_storeu_ps(dst + F, sum1);
+        }
+
+        template<class T> void ResizerFilterRowVert(const uint8_t* src, size_t stride, size_t size, const float* ay, size_t ky, float* dst)
+        {
+            size_t size2F = AlignLo(size, 2 * F), sizeF = AlignLo(size, F), i = 0;
+            for (; i < size2F; i += 2 * F)
+                ResizerFilterRowVert2<T>(src + i * sizeof(T), stride, ay, ky, dst + i);
+            for (; i < sizeF; i += F)
+                ResizerFilterRowVert1<T>(src + i * sizeof(T), stride, ay, ky, dst + i);
+            if (i < size)
+                ResizerFilterRowVert1<T>(src + i * sizeof(T), stride, ay, ky, dst + i, TailMask16(size - i));
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        ResizerFilter::ResizerFilter(const ResParam& param)
+            : Avx2::ResizerFilter(param)
+        {
+            switch (_param.type)
+            {
+            case SimdResizeChannelByte:
+                _rowVert = ResizerFilterRowVert<uint8_t>;
+                break;
+            case SimdResizeChannelShort:
+                _rowVert = ResizerFilterRowVert<uint16_t>;
+                break;
+            case SimdResizeChannelFloat:
+                _rowVert = ResizerFilterRowVert<float>;
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif
+}
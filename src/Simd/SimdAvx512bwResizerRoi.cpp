@@ -0,0 +1,132 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizerRoi.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<class T> SIMD_INLINE __m512 RoiLoad(const T* src, __mmask16 tail = -1);
+
+        template<> SIMD_INLINE __m512 RoiLoad(const uint8_t* src, __mmask16 tail)
+        {
+            return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, src)));
+        }
+
+        template<> SIMD_INLINE __m512 RoiLoad(const float* src, __mmask16 tail)
+        {
+            return _mm512_maskz_loadu_ps(tail, src);
+        }
+
+        template<class T> SIMD_INLINE void ResizerRoiVert(const T* src0, const T* src1, __m512 alpha, float* dst, __mmask16 tail = -1)
+        {
+            __m512 s0 = RoiLoad(src0, tail);
+            _mm512_mask_storeu_ps(dst, tail, _mm512_fmadd_ps(_mm512_sub_ps(RoiLoad(src1, tail), s0), alpha, s0));
+        }
+
+        template<class T> void ResizerRoiVert(const uint8_t* src0, const uint8_t* src1, float alpha, size_t size, float* dst)
+        {
+            const T* s0 = (const T*)src0;
+            const T* s1 = (const T*)src1;
+            __m512 _alpha = _mm512_set1_ps(alpha);
+            size_t sizeF = AlignLo(size, F), sizeQF = AlignLo(size, QF), i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                ResizerRoiVert(s0 + i + 0 * F, s1 + i + 0 * F, _alpha, dst + i + 0 * F);
+                ResizerRoiVert(s0 + i + 1 * F, s1 + i + 1 * F, _alpha, dst + i + 1 * F);
+                ResizerRoiVert(s0 + i + 2 * F, s1 + i + 2 * F, _alpha, dst + i + 2 * F);
+                ResizerRoiVert(s0 + i + 3 * F, s1 + i + 3 * F, _alpha, dst + i + 3 * F);
+            }
+            for (; i < sizeF; i += F)
+                ResizerRoiVert(s0 + i, s1 + i, _alpha, dst + i);
+            if (i < size)
+                ResizerRoiVert(s0 + i, s1 + i, _alpha, dst + i, TailMask16(size - i));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<class T> SIMD_INLINE void ResizerRoiStore(__m512 value, T* dst, __mmask16 tail);
+
+        template<> SIMD_INLINE void ResizerRoiStore(__m512 value, float* dst, __mmask16 tail)
+        {
+            _mm512_mask_storeu_ps(dst, tail, value);
+        }
+
+        template<> SIMD_INLINE void ResizerRoiStore(__m512 value, uint8_t* dst, __mmask16 tail)
+        {
+            __m512i i32 = _mm512_max_epi32(_mm512_cvtps_epi32(value), _mm512_setzero_si512());
+            _mm_mask_storeu_epi8(dst, tail, _mm512_cvtusepi32_epi8(i32));
+        }
+
+        template<class T> SIMD_INLINE void ResizerRoiHorz1(const float* src, const int32_t* ix, const float* ax, T* dst, __mmask16 tail = -1)
+        {
+            __m512i idx = _mm512_maskz_loadu_epi32(tail, ix);
+            __m512 s0 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, idx, src + 0, 4);
+            __m512 s1 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, idx, src + 1, 4);
+            ResizerRoiStore(_mm512_fmadd_ps(_mm512_sub_ps(s1, s0), _mm512_maskz_loadu_ps(tail, ax), s0), dst, tail);
+        }
+
+        template<class T> void ResizerRoiHorz1(const float* src, const int32_t* ix, const float* ax, size_t width, size_t channels, float* buf, uint8_t* dst)
+        {
+            T* d = (T*)dst;
+            size_t widthF = AlignLo(width, F), x = 0;
+            for (; x < widthF; x += F)
+                ResizerRoiHorz1(src, ix + x, ax + x, d + x);
+            if (x < width)
+                ResizerRoiHorz1(src, ix + x, ax + x, d + x, TailMask16(width - x));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ResizerRoi::ResizerRoi(const Base::RoiResParam& param)
+            : Avx2::ResizerRoi(param)
+        {
+            if (_param.type == SimdResizeChannelFloat)
+            {
+                _vert = ResizerRoiVert<float>;
+                if (_param.channels == 1)
+                    _horz = ResizerRoiHorz1<float>;
+            }
+            else
+            {
+                _vert = ResizerRoiVert<uint8_t>;
+                if (_param.channels == 1)
+                    _horz = ResizerRoiHorz1<uint8_t>;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerRoiInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            Base::RoiResParam param(srcX, srcY, dstX, dstY, channels, type, method);
+            if (!param.Valid())
+                return NULL;
+            return new ResizerRoi(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,99 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetInputResizer.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512 InputResizerLerp(const float* src0, const float* src1, __m512 alpha, __mmask16 tail = -1)
+        {
+            __m512 s0 = _mm512_maskz_loadu_ps(tail, src0);
+            return _mm512_add_ps(s0, _mm512_mul_ps(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, src1), s0), alpha));
+        }
+
+        template<SimdTensorDataType type> SIMD_INLINE void InputResizerStore(__m512 value, uint8_t* dst, __mmask16 tail = -1);
+
+        template<> SIMD_INLINE void InputResizerStore<SimdTensorData32f>(__m512 value, uint8_t* dst, __mmask16 tail)
+        {
+            _mm512_mask_storeu_ps((float*)dst, tail, value);
+        }
+
+        template<> SIMD_INLINE void InputResizerStore<SimdTensorData16b>(__m512 value, uint8_t* dst, __mmask16 tail)
+        {
+            _mm256_mask_storeu_epi16((uint16_t*)dst, tail, _mm512_cvtepi32_epi16(Float32ToBFloat16(value)));
+        }
+
+        template<> SIMD_INLINE void InputResizerStore<SimdTensorData8u>(__m512 value, uint8_t* dst, __mmask16 tail)
+        {
+            __m512i i32 = _mm512_max_epi32(_mm512_cvtps_epi32(value), _mm512_setzero_si512());
+            _mm_mask_storeu_epi8(dst, tail, _mm512_cvtusepi32_epi8(i32));
+        }
+
+        template<SimdTensorDataType type> void InputResizerVert(const float* src0, const float* src1, float alpha, size_t size, uint8_t* dst)
+        {
+            const size_t elem = type == SimdTensorData32f ? 4 : (type == SimdTensorData16b ? 2 : 1);
+            __m512 _alpha = _mm512_set1_ps(alpha);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                InputResizerStore<type>(InputResizerLerp(src0 + i, src1 + i, _alpha), dst + i * elem);
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                InputResizerStore<type>(InputResizerLerp(src0 + i, src1 + i, _alpha, tail), dst + i * elem, tail);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetInputResizer::SynetInputResizer(const Base::InputResizerParam& param)
+            : Avx2::SynetInputResizer(param)
+        {
+            switch (_param.dstType)
+            {
+            case SimdTensorData32f: _vert = InputResizerVert<SimdTensorData32f>; break;
+            case SimdTensorData16b: _vert = InputResizerVert<SimdTensorData16b>; break;
+            case SimdTensorData8u: _vert = InputResizerVert<SimdTensorData8u>; break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetInputResizerInit(SimdPixelFormatType srcFormat, SimdYuvLayoutType yuvLayout, SimdYuvType yuvType,
+            size_t cropX, size_t cropY, size_t cropWidth, size_t cropHeight, size_t dstWidth, size_t dstHeight, size_t channels,
+            const float* mean, const float* scale, SimdTensorDataType dstType, SimdTensorFormatType dstFormat)
+        {
+            Base::InputResizerParam param(srcFormat, yuvLayout, yuvType, cropX, cropY, cropWidth, cropHeight, dstWidth, dstHeight, channels, mean, scale, dstType, dstFormat);
+            if (!param.Valid())
+                return NULL;
+            return new SynetInputResizer(param);
+        }
+    }
+#endif
+}
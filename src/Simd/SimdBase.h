@@ -36,6 +36,29 @@ namespace Simd
 
         void SetThreadNumber(size_t threadNumber);
 
+        void * ThreadContextCreate(size_t threadNumber, uint64_t affinity);
+
+        void * ThreadContextBind(void * context);
+
+        void * ThreadContextCurrent();
+
+        class ThreadContextScope
+        {
+        public:
+            ThreadContextScope(void * context)
+                : _previous(ThreadContextBind(context))
+            {
+            }
+
+            ~ThreadContextScope()
+            {
+                ThreadContextBind(_previous);
+            }
+
+        private:
+            void * _previous;
+        };
+
         uint32_t Crc32(const void* src, size_t size);
 
         uint32_t Crc32c(const void * src, size_t size);
@@ -0,0 +1,239 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdImageLoad.h"
+
+#include <stdio.h>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning (push)
+#pragma warning (disable: 4996)
+#endif
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE uint32_t ReadBe16(const uint8_t* p)
+        {
+            return (uint32_t(p[0]) << 8) | uint32_t(p[1]);
+        }
+
+        SIMD_INLINE uint32_t ReadBe32(const uint8_t* p)
+        {
+            return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+        }
+
+        SIMD_INLINE uint32_t ReadTiff16(const uint8_t* p, bool le)
+        {
+            return le ? (uint32_t(p[1]) << 8) | uint32_t(p[0]) : ReadBe16(p);
+        }
+
+        SIMD_INLINE uint32_t ReadTiff32(const uint8_t* p, bool le)
+        {
+            return le ? (uint32_t(p[3]) << 24) | (uint32_t(p[2]) << 16) | (uint32_t(p[1]) << 8) | uint32_t(p[0]) : ReadBe32(p);
+        }
+
+        static int ExifOrientation(const uint8_t* tiff, size_t size)
+        {
+            if (size < 8 || !((tiff[0] == 'I' && tiff[1] == 'I') || (tiff[0] == 'M' && tiff[1] == 'M')))
+                return 1;
+            bool le = tiff[0] == 'I';
+            if (ReadTiff16(tiff + 2, le) != 42)
+                return 1;
+            size_t ifd = ReadTiff32(tiff + 4, le);
+            if (ifd + 2 > size)
+                return 1;
+            size_t count = ReadTiff16(tiff + ifd, le);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint8_t* entry = tiff + ifd + 2 + i * 12;
+                if (entry + 12 > tiff + size)
+                    break;
+                if (ReadTiff16(entry, le) == 0x0112 && ReadTiff16(entry + 2, le) == 3)
+                {
+                    int orientation = ReadTiff16(entry + 8, le);
+                    return orientation >= 1 && orientation <= 8 ? orientation : 1;
+                }
+            }
+            return 1;
+        }
+
+        static SimdImageSubsamplingType JpegSubsampling(const uint8_t* comps, size_t n)
+        {
+            if (n != 3)
+                return SimdImageSubsamplingNone;
+            int h0 = comps[1] >> 4, v0 = comps[1] & 15, h1 = comps[4] >> 4, v1 = comps[4] & 15;
+            if (h1 == 0 || v1 == 0 || comps[7] != comps[4] || h0 % h1 || v0 % v1)
+                return SimdImageSubsamplingOther;
+            int h = h0 / h1, v = v0 / v1;
+            if (h == 1 && v == 1)
+                return SimdImageSubsampling444;
+            if (h == 2 && v == 1)
+                return SimdImageSubsampling422;
+            if (h == 2 && v == 2)
+                return SimdImageSubsampling420;
+            if (h == 1 && v == 2)
+                return SimdImageSubsampling440;
+            if (h == 4 && v == 1)
+                return SimdImageSubsampling411;
+            return SimdImageSubsamplingOther;
+        }
+
+        static bool JpegInfo(const uint8_t* data, size_t size, SimdImageInfo* info)
+        {
+            bool frame = false;
+            size_t pos = 2;
+            while (pos + 4 <= size)
+            {
+                if (data[pos] != 0xFF)
+                    return false;
+                uint8_t marker = data[++pos];
+                while (marker == 0xFF && pos + 1 < size)
+                    marker = data[++pos];
+                pos++;
+                if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7))
+                    continue;
+                if (marker == 0xD9 || pos + 2 > size)
+                    return false;
+                size_t length = ReadBe16(data + pos);
+                if (length < 2)
+                    return false;
+                if (marker == 0xDA)
+                    return frame;
+                if (pos + length > size)
+                    return false;
+                const uint8_t* segment = data + pos + 2;
+                length -= 2;
+                if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+                {
+                    if (frame || length < 6 || length < 6 + size_t(segment[5]) * 3)
+                        return false;
+                    frame = true;
+                    info->depth = segment[0];
+                    info->height = ReadBe16(segment + 1);
+                    info->width = ReadBe16(segment + 3);
+                    info->channels = segment[5];
+                    info->subsampling = JpegSubsampling(segment + 6, segment[5]);
+                    info->progressive = (marker & 3) == 2 ? SimdTrue : SimdFalse;
+                }
+                else if (marker == 0xDD && length >= 2)
+                    info->restartInterval = ReadBe16(segment);
+                else if (marker == 0xE1 && length >= 6 && memcmp(segment, "Exif\0\0", 6) == 0)
+                    info->orientation = ExifOrientation(segment + 6, length - 6);
+                pos += length + 2;
+            }
+            return false;
+        }
+
+        static bool PngInfo(const uint8_t* data, size_t size, SimdImageInfo* info)
+        {
+            size_t pos = 8;
+            if (pos + 8 + 13 > size || memcmp(data + pos + 4, "IHDR", 4) != 0 || ReadBe32(data + pos) != 13)
+                return false;
+            const uint8_t* ihdr = data + pos + 8;
+            info->width = ReadBe32(ihdr + 0);
+            info->height = ReadBe32(ihdr + 4);
+            info->depth = ihdr[8];
+            int type = ihdr[9];
+            switch (type)
+            {
+            case 0: info->channels = 1; break;
+            case 2: info->channels = 3; break;
+            case 3: info->channels = 3; info->depth = 8; break;
+            case 4: info->channels = 2; break;
+            case 6: info->channels = 4; break;
+            default: return false;
+            }
+            info->progressive = ihdr[12] ? SimdTrue : SimdFalse;
+            pos += 8 + 13 + 4;
+            while (pos + 8 <= size)
+            {
+                size_t length = ReadBe32(data + pos);
+                const uint8_t* chunk = data + pos + 4;
+                if (memcmp(chunk, "IDAT", 4) == 0 || memcmp(chunk, "IEND", 4) == 0)
+                    return true;
+                if (pos + 12 + length > size)
+                    return false;
+                if (memcmp(chunk, "tRNS", 4) == 0 && type != 4 && type != 6)
+                    info->channels++;
+                else if (memcmp(chunk, "eXIf", 4) == 0)
+                    info->orientation = ExifOrientation(chunk + 4, length);
+                pos += 12 + length;
+            }
+            return false;
+        }
+
+        bool ImageInfoFromMemory(const uint8_t* data, size_t size, SimdImageInfo* info)
+        {
+            if (data == NULL || info == NULL || size < 8)
+                return false;
+            SimdImageInfo result;
+            memset(&result, 0, sizeof(result));
+            result.orientation = 1;
+            if (data[0] == 0xFF && data[1] == 0xD8)
+            {
+                result.file = SimdImageFileJpeg;
+                if (!JpegInfo(data, size, &result))
+                    return false;
+            }
+            else if (memcmp(data, "\x89PNG\r\n\x1A\n", 8) == 0)
+            {
+                result.file = SimdImageFilePng;
+                if (!PngInfo(data, size, &result))
+                    return false;
+            }
+            else
+                return false;
+            *info = result;
+            return true;
+        }
+
+        bool ImageInfoFromFile(const char* path, SimdImageInfo* info)
+        {
+            bool result = false;
+            ::FILE* file = ::fopen(path, "rb");
+            if (file)
+            {
+                std::vector<uint8_t> buffer;
+                size_t size = 0, capacity = 64 * 1024;
+                for (;;)
+                {
+                    buffer.resize(capacity);
+                    size += ::fread(buffer.data() + size, 1, capacity - size, file);
+                    result = ImageInfoFromMemory(buffer.data(), size, info);
+                    if (result || size < capacity)
+                        break;
+                    capacity *= 2;
+                }
+                ::fclose(file);
+            }
+            return result;
+        }
+    }
+}
+
+#if defined(_MSC_VER)
+#pragma warning (pop)
+#endif
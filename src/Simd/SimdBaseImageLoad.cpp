@@ -28,6 +28,19 @@
 
 #include <stdio.h>
 
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define SIMD_IMAGE_LOAD_MMAP
+#endif
+
 #if defined(_MSC_VER)
 #pragma warning (push)
 #pragma warning (disable: 4996)
@@ -35,29 +48,189 @@
 
 namespace Simd
 {
+    class MappedFile
+    {
+    public:
+        MappedFile()
+            : _data(NULL)
+            , _size(0)
+#if defined(_WIN32)
+            , _file(INVALID_HANDLE_VALUE)
+            , _mapping(NULL)
+#endif
+        {
+        }
+
+        ~MappedFile()
+        {
+#if defined(_WIN32)
+            if (_data && _buffer.Empty())
+                ::UnmapViewOfFile(_data);
+            if (_mapping)
+                ::CloseHandle(_mapping);
+            if (_file != INVALID_HANDLE_VALUE)
+                ::CloseHandle(_file);
+#elif defined(SIMD_IMAGE_LOAD_MMAP)
+            if (_data && _buffer.Empty())
+                ::munmap((void*)_data, _size);
+#endif
+        }
+
+        bool Open(const char* path)
+        {
+#if defined(_WIN32)
+            _file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+            if (_file == INVALID_HANDLE_VALUE)
+                return false;
+            LARGE_INTEGER size;
+            if (!::GetFileSizeEx(_file, &size) || size.QuadPart == 0)
+                return Read(path);
+            _mapping = ::CreateFileMappingA(_file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (_mapping)
+                _data = (const uint8_t*)::MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+            if (_data == NULL)
+                return Read(path);
+            _size = (size_t)size.QuadPart;
+            return true;
+#elif defined(SIMD_IMAGE_LOAD_MMAP)
+            int fd = ::open(path, O_RDONLY);
+            if (fd == -1)
+                return false;
+            struct stat st;
+            if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0)
+            {
+                ::close(fd);
+                return Read(path);
+            }
+            void* data = ::mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (data == MAP_FAILED)
+                return Read(path);
+#if defined(MADV_SEQUENTIAL)
+            ::madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+            _data = (const uint8_t*)data;
+            _size = (size_t)st.st_size;
+            return true;
+#else
+            return Read(path);
+#endif
+        }
+
+        SIMD_INLINE const uint8_t* Data() const
+        {
+            return _data;
+        }
+
+        SIMD_INLINE size_t Size() const
+        {
+            return _size;
+        }
+
+    private:
+        const uint8_t* _data;
+        size_t _size;
+        Array8u _buffer;
+#if defined(_WIN32)
+        HANDLE _file, _mapping;
+#endif
+
+        bool Read(const char* path)
+        {
+            bool result = false;
+            ::FILE* file = ::fopen(path, "rb");
+            if (file)
+            {
+                ::fseek(file, 0, SEEK_END);
+                long size = ::ftell(file);
+                ::fseek(file, 0, SEEK_SET);
+                if (size > 0)
+                {
+                    _buffer.Resize(size);
+                    result = ::fread(_buffer.data, 1, _buffer.size, file) == _buffer.size;
+                    _data = _buffer.data;
+                    _size = _buffer.size;
+                }
+                ::fclose(file);
+            }
+            return result;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+
     uint8_t* ImageLoadFromFile(const ImageLoadFromMemoryPtr loader, const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
     {
-        uint8_t* data = NULL;
-        ::FILE* file = ::fopen(path, "rb");
-        if (file)
+        MappedFile file;
+        if (file.Open(path))
+            return loader(file.Data(), file.Size(), stride, width, height, format);
+        return NULL;
+    }
+
+    uint8_t* ImageLoadFromMemory(const CreateImageLoaderPtr create, const ImageLoaderParam& param, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+    {
+        ImageLoaderParam validated(param);
+        if (validated.Validate())
         {
-            ::fseek(file, 0, SEEK_END);
-            Array8u buffer(::ftell(file));
-            ::fseek(file, 0, SEEK_SET);
-            if (::fread(buffer.data, 1, buffer.size, file) == buffer.size)
-                data = loader(buffer.data, buffer.size, stride, width, height, format);
-            ::fclose(file);
+            Holder<ImageLoader> loader(create(validated));
+            if (loader)
+            {
+                if (loader->FromStream())
+                    return loader->Release(stride, width, height, format);
+            }
         }
-        return data;
+        return NULL;
+    }
+
+    uint8_t* ImageLoadFromFile(const CreateImageLoaderPtr create, const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+    {
+        MappedFile file;
+        if (file.Open(path))
+            return ImageLoadFromMemory(create, ImageLoaderParam(file.Data(), file.Size(), *format, scale), stride, width, height, format);
+        return NULL;
+    }
+
+    bool ImageLoadFromMemory(const CreateImageLoaderPtr create, const ImageLoaderParam& param, uint8_t* dst, size_t dstStride, size_t dstSize, size_t* width, size_t* height, SimdPixelFormatType* format)
+    {
+        ImageLoaderParam validated(param);
+        if (validated.Validate())
+        {
+            Holder<ImageLoader> loader(create(validated));
+            if (loader)
+            {
+                loader->SetTarget(dst, dstStride, dstSize);
+                bool result = loader->FromStream();
+                loader->Release(width, height, format);
+                return result;
+            }
+        }
+        return false;
+    }
+
+    bool ImageLoadFromFile(const CreateImageLoaderPtr create, const char* path, uint8_t* dst, size_t dstStride, size_t dstSize, size_t* width, size_t* height, SimdPixelFormatType* format)
+    {
+        MappedFile file;
+        if (file.Open(path))
+            return ImageLoadFromMemory(create, ImageLoaderParam(file.Data(), file.Size(), *format), dst, dstStride, dstSize, width, height, format);
+        return false;
+    }
+
+    uint8_t* ImageLoadYuvFromFile(const ImageLoadYuvFromMemoryPtr loader, const char* path, SimdYuvLayoutType layout, uint8_t* planes[3], size_t strides[3], size_t* width, size_t* height)
+    {
+        MappedFile file;
+        if (file.Open(path))
+            return loader(file.Data(), file.Size(), layout, planes, strides, width, height);
+        return NULL;
     }
 
     //-------------------------------------------------------------------------
 
-    ImageLoaderParam::ImageLoaderParam(const uint8_t* d, size_t s, SimdPixelFormatType f)
+    ImageLoaderParam::ImageLoaderParam(const uint8_t* d, size_t s, SimdPixelFormatType f, size_t sc)
         : data(d)
         , size(s)
         , format(f)
         , file(SimdImageFileUndefined)
+        , scale(sc)
     {
     }
 
@@ -88,6 +261,8 @@ namespace Simd
             if (data[0] == 0xFF && data[1] == 0xD8)
                 file = SimdImageFileJpeg;
         }
+        if (scale != 1 && (file != SimdImageFileJpeg || (scale != 2 && scale != 4 && scale != 8)))
+            return false;
         return
             file != SimdImageFileUndefined && 
                 (format == SimdPixelFormatNone || format == SimdPixelFormatGray8 || 
@@ -120,7 +295,8 @@ namespace Simd
             uint8_t byte;
             if (!(_stream.Read(byte) && byte == '\n'))
                 return false;
-            _image.Recreate(width, height, (Image::Format)_param.format);
+            if (!PrepareImage(width, height))
+                return false;
             _block = height;
             if (_param.file == SimdImageFilePgmTxt || _param.file == SimdImageFilePgmBin)
             {
@@ -35,10 +35,19 @@ namespace Simd
     {
         namespace Zlib
         {
-            const size_t ZFAST_BITS = 9;
+            const size_t ZFAST_BITS = 10;
             const size_t ZFAST_SIZE = 1 << ZFAST_BITS;
             const size_t ZFAST_MASK = ZFAST_SIZE - 1;
 
+            static SIMD_INLINE int BitRev16(int n)
+            {
+                n = ((n & 0xAAAA) >> 1) | ((n & 0x5555) << 1);
+                n = ((n & 0xCCCC) >> 2) | ((n & 0x3333) << 2);
+                n = ((n & 0xF0F0) >> 4) | ((n & 0x0F0F) << 4);
+                n = ((n & 0xFF00) >> 8) | ((n & 0x00FF) << 8);
+                return n;
+            }
+
             struct Zhuffman
             {
                 uint16_t fast[ZFAST_SIZE];
@@ -86,7 +95,7 @@ namespace Simd
                             value[c] = (uint16_t)i;
                             if (s <= (int)ZFAST_BITS)
                             {
-                                int j = ZlibBitRev(nextCode[s], s);
+                                int j = BitRev16(nextCode[s]) >> (16 - s);
                                 while (j < (1 << ZFAST_BITS))
                                 {
                                     fast[j] = fastv;
@@ -100,15 +109,6 @@ namespace Simd
                 }
             };
 
-            static SIMD_INLINE int BitRev16(int n)
-            {
-                n = ((n & 0xAAAA) >> 1) | ((n & 0x5555) << 1);
-                n = ((n & 0xCCCC) >> 2) | ((n & 0x3333) << 2);
-                n = ((n & 0xF0F0) >> 4) | ((n & 0x0F0F) << 4);
-                n = ((n & 0xFF00) >> 8) | ((n & 0x00FF) << 8);
-                return n;
-            }
-
             static SIMD_INLINE int ZhuffmanDecode(InputMemoryStream& is, const Zhuffman& z)
             {
                 int b, s;
@@ -116,7 +116,7 @@ namespace Simd
                 {
                     if (is.Eof())
                         return -1;
-                    is.FillBits();
+                    is.FillBitsFast();
                 }
                 b = z.fast[is.BitBuffer() & ZFAST_MASK];
                 if (b)
@@ -142,6 +142,29 @@ namespace Simd
                 }
             }
 
+            const size_t ZOUT_MARGIN = 258 + 16;
+
+            SIMD_INLINE void CopyMatch(uint8_t* dst, size_t dist, size_t len)
+            {
+                const uint8_t* src = dst - dist;
+                if (dist == 1)
+                {
+                    memset(dst, src[0], len);
+                    return;
+                }
+                while (dst - src < 8)
+                {
+                    size_t size = Min(size_t(dst - src), len);
+                    memcpy(dst, src, size);
+                    dst += size;
+                    len -= size;
+                    if (len == 0)
+                        return;
+                }
+                for (size_t i = 0; i < len; i += 8)
+                    *(uint64_t*)(dst + i) = *(uint64_t*)(src + i);
+            }
+
             static int ParseHuffmanBlock(InputMemoryStream& is, const Zhuffman& zLength, const Zhuffman& zDistance, OutputMemoryStream& os)
             {
                 static const int zlengthBase[31] = { 3,4,5,6,7,8,9,10,11,13, 15,17,19,23,27,31,35,43,51,59, 67,83,99,115,131,163,195,227,258,0,0 };
@@ -154,19 +177,27 @@ namespace Simd
                 uint8_t* beg = os.Data(), * dst = os.Current(), * end = beg + os.Capacity();
                 for (;;)
                 {
+                    if (end - dst < (ptrdiff_t)ZOUT_MARGIN)
+                    {
+                        os.Seek(dst - beg);
+                        os.Reserve(dst - beg + ZOUT_MARGIN);
+                        beg = os.Data();
+                        dst = os.Current();
+                        end = beg + os.Capacity();
+                    }
                     int z = ZhuffmanDecode(is, zLength);
                     if (z < 256)
                     {
                         if (z < 0)
                             return CorruptPngError("bad huffman code");
-                        if (dst >= end)
+                        *dst++ = (uint8_t)z;
+                        int b = zLength.fast[is.BitBuffer() & ZFAST_MASK], s = b >> 9;
+                        if (b && (b & 511) < 256 && (int)is.BitCount() >= s)
                         {
-                            os.Reserve(end - beg + 1);
-                            beg = os.Data();
-                            dst = os.Current();
-                            end = beg + os.Capacity();
+                            is.BitBuffer() >>= s;
+                            is.BitCount() -= s;
+                            *dst++ = (uint8_t)b;
                         }
-                        *dst++ = (uint8_t)z;
                     }
                     else
                     {
@@ -188,41 +219,8 @@ namespace Simd
                             dist += (int)is.ReadBits(zdistExtra[z]);
                         if (dst - beg < dist)
                             return CorruptPngError("bad dist");
-                        if (dst + len > end)
-                        {
-                            os.Reserve(dst - beg + len);
-                            beg = os.Data();
-                            dst = os.Current();
-                            end = beg + os.Capacity();
-                        }
-                        if (dist == 1)
-                        {
-                            uint8_t val = dst[-dist];
-                            if (len < 16)
-                            {
-                                while (len--)
-                                    *dst++ = val;
-                            }
-                            else
-                            {
-                                memset(dst, val, len);
-                                dst += len;
-                            }
-                        }
-                        else
-                        {
-                            uint8_t* src = dst - dist;
-                            if (dist < len || len < 16)
-                            {
-                                while(len--)
-                                    *dst++ = *src++;
-                            }
-                            else
-                            {
-                                memcpy(dst, src, len);
-                                dst += len;
-                            }                        
-                        }
+                        CopyMatch(dst, dist, len);
+                        dst += len;
                     }
                 }
             }
@@ -372,7 +370,7 @@ namespace Simd
 
         static const uint8_t DepthScaleTable[9] = { 0, 0xff, 0x55, 0, 0x11, 0,0,0, 0x01 };
 
-        static void DecodeLine0(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine0(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
                 memcpy(dst, curr, width * srcN);
@@ -391,7 +389,7 @@ namespace Simd
             }
         }
 
-        static void DecodeLine1(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine1(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
             {
@@ -422,7 +420,7 @@ namespace Simd
             }
         }
 
-        static void DecodeLine2(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine2(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
             {
@@ -445,7 +443,7 @@ namespace Simd
             }
         }
 
-        static void DecodeLine3(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine3(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
             {
@@ -478,7 +476,7 @@ namespace Simd
             }
         }
 
-        static void DecodeLine4(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine4(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
             {
@@ -511,7 +509,7 @@ namespace Simd
             }
         }
 
-        static void DecodeLine5(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine5(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
             {
@@ -542,7 +540,7 @@ namespace Simd
             }
         }
 
-        static void DecodeLine6(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine6(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
             {
@@ -823,7 +821,8 @@ namespace Simd
                 return false;
 
             InputMemoryStream zSrc = MergedDataStream();
-            OutputMemoryStream zDst(AlignHi(size_t(_width) * _depth, 8) * _height * _channels + _height);
+            size_t rowSize = (size_t(_width) * _depth * _channels + 7) / 8 + 1;
+            OutputMemoryStream zDst(rowSize * _height * (_interlace ? 2 : 1) + Zlib::ZOUT_MARGIN);
             if(!Zlib::Decode(zSrc, zDst, !_iPhone))
                 return false;
 
@@ -840,9 +839,7 @@ namespace Simd
 
             ExpandPalette();
 
-            ConvertImage();
-
-            return true;
+            return ConvertImage();
         }
 
         bool ImagePngLoader::ParseFile()
@@ -1239,12 +1236,14 @@ namespace Simd
             }
         }
 
-        void ImagePngLoader::ConvertImage()
+        bool ImagePngLoader::ConvertImage()
         {
             SIMD_PERF_FUNC();
             SetConverter();
-            _image.Recreate(_width, _height, (Image::Format)_param.format);
+            if (!PrepareImage(_width, _height))
+                return false;
             _converter(_buffer.data, _width, _height, _width * _outN, _image.data, _image.stride);
+            return true;
         }
     }
 }
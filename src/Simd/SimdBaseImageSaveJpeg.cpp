@@ -25,6 +25,7 @@
 #include "Simd/SimdImageSave.h"
 #include "Simd/SimdImageSaveJpeg.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -367,6 +368,9 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        const size_t JPEG_PARALLEL_ROWS_MIN = 64;
+        const size_t JPEG_PARALLEL_SIZE_MIN = 256 * 1024;
+
         ImageJpegSaver::ImageJpegSaver(const ImageSaverParam& param)
             : ImageSaver(param)
             , _deintBgra(NULL)
@@ -374,9 +378,18 @@ namespace Simd
             , _writeBlock(NULL)
             , _writeNv12Block(NULL)
             , _writeYuv420pBlock(NULL)
+            , _restart(0)
+            , _threads(1)
+            , _header(0)
         {
         }
 
+        ImageJpegSaver::~ImageJpegSaver()
+        {
+            for (size_t i = 0; i < _bands.size(); ++i)
+                delete _bands[i];
+        }
+
         void ImageJpegSaver::Init()
         {
             InitParams(false);
@@ -438,8 +451,22 @@ namespace Simd
             }
             _block = _subSample ? 16 : 8;
             _width = (int)AlignHi(_param.width, _block);
+            _threads = Simd::Min(Base::GetThreadNumber(), _param.height / JPEG_PARALLEL_ROWS_MIN);
+            _threads = Simd::Min(_threads, _param.width * _param.height / JPEG_PARALLEL_SIZE_MIN);
+            _restart = 0;
+            if (_threads > 1)
+            {
+                size_t rows = DivHi(_param.height, _block), cols = _width / _block;
+                _restart = (int)Simd::Min(DivHi(rows, _threads), 0xFFFF / cols);
+                size_t bands = DivHi(rows, _restart);
+                _threads = Simd::Min(_threads, bands);
+                while (_bands.size() < bands)
+                    _bands.push_back(new OutputMemoryStream());
+            }
+            else
+                _threads = 1;
             if (_param.format != SimdPixelFormatGray8 && _param.yuvType == SimdYuvUnknown)
-                _buffer.Resize(_width * _block * 3);
+                _buffer.Resize(_width * _block * 3 * _threads);
         }
 
         void ImageJpegSaver::WriteHeader()
@@ -488,87 +515,180 @@ namespace Simd
             _stream.Write8u(0x11); // HTUACinfo
             _stream.Write(AC_CHR_COD + 1, sizeof(AC_CHR_COD) - 1);
             _stream.Write(AC_CHR_VAL, sizeof(AC_CHR_VAL));
+            if (_restart)
+            {
+                int interval = _restart * _width / _block;
+                const uint8_t dri[] = { 0xFF, 0xDD, 0, 4, uint8_t(interval >> 8), uint8_t(interval) };
+                _stream.Write(dri, sizeof(dri));
+            }
             _stream.Write(head2, sizeof(head2));
         }
 
-        bool ImageJpegSaver::ToStream(const uint8_t* src, size_t stride)
+        void ImageJpegSaver::Start()
         {
-            Init();
-            WriteHeader();
-            uint8_t* r = _buffer.data, * g = r + _width * _block,* b = g + _width * _block;
-            int dc[3] = { 0, 0, 0 };
-            for (int row = 0; row < (int)_param.height; row += _block)
+            if (_header == 0)
             {
-                int block = Simd::Min(row + _block, (int)_param.height) - row;
-                switch (_param.format)
+                Init();
+                WriteHeader();
+                _header = _stream.Pos();
+            }
+            else
+                _stream.Seek(_header);
+            _stream.BitBuffer() = 0;
+            _stream.BitCount() = 0;
+        }
+
+        size_t ImageJpegSaver::Export(uint8_t* dst, size_t capacity) const
+        {
+            size_t size = _stream.Pos();
+            if (dst && size <= capacity)
+                memcpy(dst, _stream.Data(), size);
+            return size;
+        }
+
+        template<class WriteRows> void ImageJpegSaver::WriteData(const WriteRows& writeRows)
+        {
+            static const uint16_t FILL_BITS[] = { 0x7F, 7 };
+            if (_restart)
+            {
+                int height = (int)_param.height, band = _restart * _block;
+                size_t bands = DivHi(_param.height, band), size = _buffer.size / _threads;
+                OutputMemoryStream** streams = _bands.data();
+                Parallel(0, bands, [&](size_t thread, size_t begin, size_t end)
                 {
-                case SimdPixelFormatBgr24:
-                    _deintBgr(src, stride, _param.width, block, b, _width, g, _width, r, _width);
-                    break;
-                case SimdPixelFormatBgra32:
-                    _deintBgra(src, stride, _param.width, block, b, _width, g, _width, r, _width, NULL, 0);
-                    break;
-                case SimdPixelFormatRgb24:
-                    _deintBgr(src, stride, _param.width, block, r, _width, g, _width, b, _width);
-                    break;
-                case SimdPixelFormatRgba32:
-                    _deintBgra(src, stride, _param.width, block, r, _width, g, _width, b, _width, NULL, 0);
-                    break;
-                default: 
-                    break;
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        OutputMemoryStream& stream = *streams[i];
+                        stream.Seek(0);
+                        stream.BitBuffer() = 0;
+                        stream.BitCount() = 0;
+                        writeRows(stream, _buffer.data + thread * size, (int)i * band, Simd::Min((int)(i + 1) * band, height));
+                        Base::WriteBits(stream, FILL_BITS);
+                    }
+                }, _threads);
+                for (size_t i = 0; i < bands; ++i)
+                {
+                    _stream.Write(streams[i]->Data(), streams[i]->Pos());
+                    if (i + 1 < bands)
+                    {
+                        _stream.Write8u(0xFF);
+                        _stream.Write8u(uint8_t(0xD0 + (i & 7)));
+                    }
                 }
-                if(_param.format == SimdPixelFormatGray8)
-                    _writeBlock(_stream, (int)_param.width, block, src, src, src, (int)stride, _fY, _fUv, dc);
-                else
-                    _writeBlock(_stream, (int)_param.width, block, r, g, b, _width, _fY, _fUv, dc);
-                src += block * stride;
             }
-            static const uint16_t FILL_BITS[] = { 0x7F, 7 };
-            Base::WriteBits(_stream, FILL_BITS);
+            else
+            {
+                writeRows(_stream, _buffer.data, 0, (int)_param.height);
+                Base::WriteBits(_stream, FILL_BITS);
+            }
             _stream.Write8u(0xFF);
             _stream.Write8u(0xD9);
+        }
+
+        bool ImageJpegSaver::ToStream(const uint8_t* src, size_t stride)
+        {
+            Start();
+            WriteData([&](OutputMemoryStream& stream, uint8_t* buffer, int begin, int end)
+            {
+                uint8_t* r = buffer, * g = r + _width * _block, * b = g + _width * _block;
+                const uint8_t* s = src + begin * stride;
+                int dc[3] = { 0, 0, 0 };
+                for (int row = begin; row < end; row += _block)
+                {
+                    int block = Simd::Min(row + _block, end) - row;
+                    switch (_param.format)
+                    {
+                    case SimdPixelFormatBgr24:
+                        _deintBgr(s, stride, _param.width, block, b, _width, g, _width, r, _width);
+                        break;
+                    case SimdPixelFormatBgra32:
+                        _deintBgra(s, stride, _param.width, block, b, _width, g, _width, r, _width, NULL, 0);
+                        break;
+                    case SimdPixelFormatRgb24:
+                        _deintBgr(s, stride, _param.width, block, r, _width, g, _width, b, _width);
+                        break;
+                    case SimdPixelFormatRgba32:
+                        _deintBgra(s, stride, _param.width, block, r, _width, g, _width, b, _width, NULL, 0);
+                        break;
+                    default:
+                        break;
+                    }
+                    if (_param.format == SimdPixelFormatGray8)
+                        _writeBlock(stream, (int)_param.width, block, s, s, s, (int)stride, _fY, _fUv, dc);
+                    else
+                        _writeBlock(stream, (int)_param.width, block, r, g, b, _width, _fY, _fUv, dc);
+                    s += block * stride;
+                }
+            });
             return true;
         }
 
         bool ImageJpegSaver::ToStream(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride)
         {
-            Init();
-            WriteHeader();
-            int dc[3] = { 0, 0, 0 };
-            for (int row = 0; row < (int)_param.height; row += _block)
+            Start();
+            WriteData([&](OutputMemoryStream& stream, uint8_t* buffer, int begin, int end)
             {
-                int block = Simd::Min(row + _block, (int)_param.height) - row;
-                _writeNv12Block(_stream, (int)_param.width, block, y, (int)yStride, uv, (int)uvStride, _fY, _fUv, dc);
-                y += block * yStride;
-                uv += (block / 2) * uvStride;
-            }
-            static const uint16_t FILL_BITS[] = { 0x7F, 7 };
-            Base::WriteBits(_stream, FILL_BITS);
-            _stream.Write8u(0xFF);
-            _stream.Write8u(0xD9);
+                const uint8_t* ys = y + begin * yStride, * uvs = uv ? uv + (begin / 2) * uvStride : NULL;
+                int dc[3] = { 0, 0, 0 };
+                for (int row = begin; row < end; row += _block)
+                {
+                    int block = Simd::Min(row + _block, end) - row;
+                    _writeNv12Block(stream, (int)_param.width, block, ys, (int)yStride, uvs, (int)uvStride, _fY, _fUv, dc);
+                    ys += block * yStride;
+                    if (uvs)
+                        uvs += (block / 2) * uvStride;
+                }
+            });
             return true;
         }
 
         bool ImageJpegSaver::ToStream(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride)
         {
-            Init();
-            WriteHeader();
-            int dc[3] = { 0, 0, 0 };
-            for (int row = 0; row < (int)_param.height; row += _block)
+            Start();
+            WriteData([&](OutputMemoryStream& stream, uint8_t* buffer, int begin, int end)
             {
-                int block = Simd::Min(row + _block, (int)_param.height) - row;
-                _writeYuv420pBlock(_stream, (int)_param.width, block, y, (int)yStride, u, (int)uStride, v, (int)vStride, _fY, _fUv, dc);
-                y += block * yStride;
-                u += (block / 2) * uStride;
-                v += (block / 2) * vStride;
-            }
-            static const uint16_t FILL_BITS[] = { 0x7F, 7 };
-            Base::WriteBits(_stream, FILL_BITS);
-            _stream.Write8u(0xFF);
-            _stream.Write8u(0xD9);
+                const uint8_t* ys = y + begin * yStride;
+                const uint8_t* us = u ? u + (begin / 2) * uStride : NULL, * vs = v ? v + (begin / 2) * vStride : NULL;
+                int dc[3] = { 0, 0, 0 };
+                for (int row = begin; row < end; row += _block)
+                {
+                    int block = Simd::Min(row + _block, end) - row;
+                    _writeYuv420pBlock(stream, (int)_param.width, block, ys, (int)yStride, us, (int)uStride, vs, (int)vStride, _fY, _fUv, dc);
+                    ys += block * yStride;
+                    if (us && vs)
+                    {
+                        us += (block / 2) * uStride;
+                        vs += (block / 2) * vStride;
+                    }
+                }
+            });
             return true;
         }
 
+        size_t ImageJpegSaver::Encode(const uint8_t* src, size_t stride, uint8_t* dst, size_t capacity)
+        {
+            if (_param.yuvType != SimdYuvUnknown)
+                return 0;
+            ToStream(src, stride);
+            return Export(dst, capacity);
+        }
+
+        size_t ImageJpegSaver::Encode(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, uint8_t* dst, size_t capacity)
+        {
+            if (_param.yuvType == SimdYuvUnknown)
+                return 0;
+            ToStream(y, yStride, uv, uvStride);
+            return Export(dst, capacity);
+        }
+
+        size_t ImageJpegSaver::Encode(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, uint8_t* dst, size_t capacity)
+        {
+            if (_param.yuvType == SimdYuvUnknown)
+                return 0;
+            ToStream(y, yStride, u, uStride, v, vStride);
+            return Export(dst, capacity);
+        }
+
         //-----------------------------------------------------------------------------------------
 
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size)
@@ -600,5 +720,14 @@ namespace Simd
             }
             return NULL;
         }
+
+        void* JpegEncoderInit(size_t width, size_t height, SimdPixelFormatType format, int quality, SimdYuvType yuvType)
+        {
+            ImageSaverParam param = yuvType == SimdYuvUnknown ? ImageSaverParam(width, height, format, SimdImageFileJpeg, quality) :
+                ImageSaverParam(width, height, quality, yuvType);
+            if (!param.Validate())
+                return NULL;
+            return new ImageJpegSaver(param);
+        }
     }
 }
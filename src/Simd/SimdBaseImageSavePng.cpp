@@ -26,6 +26,7 @@
 #include "Simd/SimdImageSavePng.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -74,89 +75,121 @@ namespace Simd
             return (hi << 16) | lo;
         }
 
-        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        uint32_t ZlibAdler32Combine(uint32_t adler1, uint32_t adler2, size_t size2)
         {
-            const int ZHASH = 16384;
-            if (quality < 5)
-                quality = 5;
-            const int basket = quality * 2;
-            Array32i hashTable(ZHASH * basket);
-            memset(hashTable.data, -1, hashTable.RawSize());
+            const uint32_t BASE = 65521;
+            uint32_t rem = uint32_t(size2 % BASE);
+            uint32_t lo = adler1 & 0xFFFF;
+            uint32_t hi = uint32_t(uint64_t(rem) * lo % BASE);
+            lo += (adler2 & 0xFFFF) + BASE - 1;
+            hi += (adler1 >> 16) + (adler2 >> 16) + BASE - rem;
+            if (lo >= BASE)
+                lo -= BASE;
+            if (lo >= BASE)
+                lo -= BASE;
+            if (hi >= (BASE << 1))
+                hi -= (BASE << 1);
+            if (hi >= BASE)
+                hi -= BASE;
+            return (hi << 16) | lo;
+        }
 
-            stream.Write(uint8_t(0x78));
-            stream.Write(uint8_t(0x5e));
-            stream.WriteBits(1, 1);
+        void ZlibDeflate(const uint8_t* data, int begin, int end, int level, bool last, OutputMemoryStream& stream)
+        {
+            stream.WriteBits(last ? 1 : 0, 1);
             stream.WriteBits(1, 2);
-
-            int i = 0, j;
-            while (i < size - 3)
+            int i = begin, j;
+            if (level < 2)
             {
-                int h = ZlibHash(data + i) & (ZHASH - 1), best = 3;
-                uint8_t* bestLoc = 0;
-                int* hList = hashTable.data + h * basket;
-                for (j = 0; hList[j] != -1 && j < basket; ++j)
+                while (i < end)
                 {
-                    if (hList[j] > i - 32768)
+                    int run = i ? ZlibCount(data + i - 1, data + i, end - i) : 0;
+                    if (run >= 3)
                     {
-                        int d = ZlibCount(data + hList[j], data + i, size - i);
-                        if (d >= best)
-                        {
-                            best = d;
-                            bestLoc = data + hList[j];
-                        }
+                        Base::ZlibMatch(run, 1, stream);
+                        i += run;
+                    }
+                    else
+                    {
+                        Base::ZlibHuffB(data[i], stream);
+                        ++i;
                     }
                 }
-                if (j == basket)
-                {
-                    memcpy(hList, hList + quality, quality * sizeof(int));
-                    memset(hList + quality, -1, quality * sizeof(int));
-                    j = quality;
-                }
-                hList[j] = i;
-
-                if (bestLoc)
+            }
+            else
+            {
+                const int ZHASH = 16384;
+                const int basket = level * 2;
+                Array32i hashTable(ZHASH * basket);
+                memset(hashTable.data, -1, hashTable.RawSize());
+                for (int p = Max(begin - 32768, 0); p < begin; ++p)
+                    Base::ZlibInsert(hashTable.data + (Base::ZlibHash(data + p) & (ZHASH - 1)) * basket, basket, p);
+                while (i < end - 3)
                 {
-                    h = ZlibHash(data + i + 1) & (ZHASH - 1);
+                    int h = Base::ZlibHash(data + i) & (ZHASH - 1), best = 3;
+                    const uint8_t* bestLoc = NULL;
                     int* hList = hashTable.data + h * basket;
-                    for (j = 0; hList[j] != -1 && j < basket; ++j)
+                    for (j = 0; j < basket && hList[j] != -1; ++j)
                     {
-                        if (hList[j] > i - 32767)
+                        if (hList[j] > i - 32768)
                         {
-                            int e = ZlibCount(data + hList[j], data + i + 1, size - i - 1);
-                            if (e > best)
+                            int d = ZlibCount(data + hList[j], data + i, end - i);
+                            if (d >= best)
                             {
-                                bestLoc = NULL;
-                                break;
+                                best = d;
+                                bestLoc = data + hList[j];
                             }
                         }
                     }
-                }
+                    if (j == basket)
+                    {
+                        memcpy(hList, hList + level, level * sizeof(int));
+                        memset(hList + level, -1, level * sizeof(int));
+                        j = level;
+                    }
+                    hList[j] = i;
 
-                if (bestLoc)
-                {
-                    int d = (int)(data + i - bestLoc);
-                    assert(d <= 32767 && best <= 258);
-                    for (j = 0; best > Base::ZlibLenC[j + 1] - 1; ++j);
-                    Base::ZlibHuff(j + 257, stream);
-                    if (Base::ZlibLenEb[j])
-                        stream.WriteBits(best - Base::ZlibLenC[j], Base::ZlibLenEb[j]);
-                    for (j = 0; d > Base::ZlibDistC[j + 1] - 1; ++j);
-                    stream.WriteBits(Base::ZlibBitRev(j, 5), 5);
-                    if (Base::ZlibDistEb[j])
-                        stream.WriteBits(d - Base::ZlibDistC[j], Base::ZlibDistEb[j]);
-                    i += best;
-                }
-                else
-                {
-                    ZlibHuffB(data[i], stream);
-                    ++i;
+                    if (bestLoc)
+                    {
+                        h = Base::ZlibHash(data + i + 1) & (ZHASH - 1);
+                        int* hList = hashTable.data + h * basket;
+                        for (j = 0; j < basket && hList[j] != -1; ++j)
+                        {
+                            if (hList[j] > i - 32767)
+                            {
+                                int e = ZlibCount(data + hList[j], data + i + 1, end - i - 1);
+                                if (e > best)
+                                {
+                                    bestLoc = NULL;
+                                    break;
+                                }
+                            }
+                        }
+                    }
+
+                    if (bestLoc)
+                    {
+                        Base::ZlibMatch(best, (int)(data + i - bestLoc), stream);
+                        i += best;
+                    }
+                    else
+                    {
+                        Base::ZlibHuffB(data[i], stream);
+                        ++i;
+                    }
                 }
+                for (; i < end; ++i)
+                    Base::ZlibHuffB(data[i], stream);
+            }
+            Base::ZlibHuff(256, stream);
+            if (!last)
+            {
+                stream.WriteBits(0, 3);
+                stream.FlushBits();
+                stream.WriteBe32u(0x0000FFFF);
             }
-            for (; i < size; ++i)
-                ZlibHuffB(data[i], stream);
-            ZlibHuff(256, stream);
-            stream.FlushBits();
-            stream.WriteBe32u(ZlibAdler32(data, size));
+            else
+                stream.FlushBits();
         }
 
         uint32_t EncodeLine0(const uint8_t* src, size_t stride, size_t n, size_t size, int8_t* dst)
@@ -266,6 +299,9 @@ namespace Simd
             return sum;
         }
 
+        const size_t PNG_PARALLEL_ROWS_MIN = 16;
+        const size_t PNG_PARALLEL_SIZE_MIN = 128 * 1024;
+
         ImagePngSaver::ImagePngSaver(const ImageSaverParam& param)
             : ImageSaver(param)
             , _channels(0)
@@ -303,8 +339,10 @@ namespace Simd
                 _convert = Base::BgraToRgba;
                 _buff.Resize(_param.height * _size);
             }
+            _threads = Base::GetThreadNumber();
+            _level = _param.quality >= 1 && _param.quality <= 9 ? _param.quality : COMPRESSION;
             _filt.Resize((_size + 1) * _param.height);
-            _line.Resize(_size * FILTERS);
+            _line.Resize(_size * FILTERS * _threads);
             _encode[0] = Base::EncodeLine0;
             _encode[1] = Base::EncodeLine1;
             _encode[2] = Base::EncodeLine2;
@@ -312,7 +350,14 @@ namespace Simd
             _encode[4] = Base::EncodeLine4;
             _encode[5] = Base::EncodeLine5;
             _encode[6] = Base::EncodeLine6;
-            _compress = Base::ZlibCompress;
+            _deflate = Base::ZlibDeflate;
+            _adler = Base::ZlibAdler32;
+        }
+
+        ImagePngSaver::~ImagePngSaver()
+        {
+            for (size_t i = 0; i < _chunks.size(); ++i)
+                delete _chunks[i];
         }
 
         bool ImagePngSaver::ToStream(const uint8_t* src, size_t stride)
@@ -323,25 +368,63 @@ namespace Simd
                 src = _buff.data;
                 stride = _size;
             }
-            for (size_t row = 0; row < _param.height; ++row)
+            Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                int8_t* line = _line.data + _size * FILTERS * thread;
+                for (size_t row = begin; row < end; ++row)
+                {
+                    int bestFilter = 0, bestSum = INT_MAX;
+                    for (int filter = 0; filter < FILTERS; filter++)
+                    {
+                        static const int TYPES[] = { 0, 1, 0, 5, 6, 0, 1, 2, 3, 4 };
+                        int type = TYPES[filter + (row ? 1 : 0) * FILTERS];
+                        int sum = _encode[type](src + stride * row, stride, _channels, _size, line + _size * filter);
+                        if (sum < bestSum)
+                        {
+                            bestSum = sum;
+                            bestFilter = filter;
+                        }
+                    }
+                    _filt[row * (_size + 1)] = (uint8_t)bestFilter;
+                    memcpy(_filt.data + row * (_size + 1) + 1, line + _size * bestFilter, _size);
+                }
+            }, Simd::Min(_threads, _param.height / PNG_PARALLEL_ROWS_MIN));
+
+            int size = (int)_filt.size;
+            OutputMemoryStream zlib(Simd::Min(_param.width * _param.height, Base::AlgCacheL1()));
+            zlib.Write(uint8_t(0x78));
+            zlib.Write(uint8_t(0x5e));
+            size_t chunks = Simd::Min(_threads, _filt.size / PNG_PARALLEL_SIZE_MIN);
+            if (chunks > 1)
             {
-                int bestFilter = 0, bestSum = INT_MAX;
-                for (int filter = 0; filter < FILTERS; filter++)
+                int chunk = (int)DivHi(_filt.size, chunks);
+                while (_chunks.size() < chunks)
+                    _chunks.push_back(new OutputMemoryStream());
+                OutputMemoryStream** streams = _chunks.data();
+                std::vector<uint32_t> adlers(chunks);
+                Parallel(0, chunks, [&](size_t thread, size_t begin, size_t end)
                 {
-                    static const int TYPES[] = { 0, 1, 0, 5, 6, 0, 1, 2, 3, 4 };
-                    int type = TYPES[filter + (row ? 1 : 0) * FILTERS];
-                    int sum = _encode[type](src + stride * row, stride, _channels, _size, _line.data + _size * filter);
-                    if (sum < bestSum)
+                    for (size_t c = begin; c < end; ++c)
                     {
-                        bestSum = sum;
-                        bestFilter = filter;
+                        int b = (int)c * chunk, e = Simd::Min(b + chunk, size);
+                        _deflate(_filt.data, b, e, _level, c == chunks - 1, *streams[c]);
+                        adlers[c] = _adler(_filt.data + b, e - b);
                     }
+                }, chunks);
+                uint32_t adler = adlers[0];
+                for (size_t c = 0; c < chunks; ++c)
+                {
+                    zlib.Write(streams[c]->Data(), streams[c]->Size());
+                    if (c)
+                        adler = ZlibAdler32Combine(adler, adlers[c], Simd::Min(chunk, size - (int)c * chunk));
                 }
-                _filt[row * (_size + 1)] = (uint8_t)bestFilter;
-                memcpy(_filt.data + row * (_size + 1) + 1, _line.data + _size * bestFilter, _size);
+                zlib.WriteBe32u(adler);
+            }
+            else
+            {
+                _deflate(_filt.data, 0, size, _level, true, zlib);
+                zlib.WriteBe32u(_adler(_filt.data, size));
             }
-            OutputMemoryStream zlib(Simd::Min(_param.width * _param.height, Base::AlgCacheL1()));
-            _compress(_filt.data, (int)_filt.size, COMPRESSION, zlib);
             WriteToStream(zlib.Data(), zlib.Size());
             return true;
         }
@@ -0,0 +1,96 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+
+#include <atomic>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+        static std::atomic<size_t> g_hugePageThreshold(0);
+        static std::atomic<int> g_numaNode(-1);
+
+        void SetAllocationPolicy(size_t hugePageThreshold, int numaNode)
+        {
+            g_hugePageThreshold = hugePageThreshold;
+            g_numaNode = numaNode;
+        }
+
+        void GetAllocationPolicy(size_t * hugePageThreshold, int * numaNode)
+        {
+            if (hugePageThreshold)
+                *hugePageThreshold = g_hugePageThreshold;
+            if (numaNode)
+                *numaNode = g_numaNode;
+        }
+
+        size_t AllocationAlign(size_t size, size_t align)
+        {
+#if defined(__linux__)
+            size_t threshold = g_hugePageThreshold;
+            if (threshold && size >= threshold)
+                return Max(align, HUGE_PAGE_SIZE);
+            if (g_numaNode >= 0 && size >= HUGE_PAGE_SIZE)
+                return Max(align, (size_t)sysconf(_SC_PAGESIZE));
+#endif
+            return align;
+        }
+
+        void AllocationAdvise(void * ptr, size_t size)
+        {
+#if defined(__linux__)
+            if (ptr == NULL || size < HUGE_PAGE_SIZE)
+                return;
+            size_t page = sysconf(_SC_PAGESIZE);
+            uint8_t * beg = (uint8_t*)AlignHi(ptr, page), * end = (uint8_t*)AlignLo((uint8_t*)ptr + size, page);
+            if (beg >= end)
+                return;
+            size_t threshold = g_hugePageThreshold;
+#if defined(MADV_HUGEPAGE)
+            if (threshold && size >= threshold)
+                madvise(beg, end - beg, MADV_HUGEPAGE);
+#endif
+            int node = g_numaNode;
+#if defined(__NR_mbind)
+            if (node >= 0 && node < 64)
+            {
+                const int MPOL_BIND_ = 2;
+                const unsigned MPOL_MF_MOVE_ = 2;
+                unsigned long mask = 1UL << node;
+                syscall(__NR_mbind, beg, end - beg, MPOL_BIND_, &mask, sizeof(mask) * 8, MPOL_MF_MOVE_);
+            }
+#endif
+#endif
+        }
+    }
+}
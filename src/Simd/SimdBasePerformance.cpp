@@ -23,6 +23,15 @@
 */
 #include "Simd/SimdPerformance.h"
 
+#include <cmath>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <string.h>
+#endif
+
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
 namespace Simd
 {
@@ -33,6 +42,132 @@ namespace Simd
             return double(count) / double(TimeFrequency()) * 1000.0;
         }
 
+        SIMD_INLINE double Microseconds(int64_t count)
+        {
+            return double(count) / double(TimeFrequency()) * 1000000.0;
+        }
+
+        SIMD_INLINE size_t HistIndex(int64_t count)
+        {
+            if (count < 4)
+                return count > 0 ? size_t(count) : 0;
+            size_t exp = 2;
+            while ((count >> (exp + 1)) != 0)
+                exp++;
+            return (exp - 1) * 4 + size_t((count >> (exp - 2)) & 3);
+        }
+
+        SIMD_INLINE int64_t HistValue(size_t index)
+        {
+            if (index < 4)
+                return int64_t(index);
+            size_t exp = index / 4 + 1;
+            int64_t width = int64_t(1) << (exp - 2);
+            return (4 + int64_t(index & 3)) * width + width / 2;
+        }
+
+        class HardwareCounters
+        {
+        public:
+            static HardwareCounters & ThisThread()
+            {
+                static thread_local HardwareCounters counters;
+                return counters;
+            }
+
+            bool Read(int64_t * values)
+            {
+#if defined(__linux__)
+                if (!_opened)
+                    Open();
+                if (_leader < 0)
+                    return false;
+                uint64_t buf[PerformanceMeasurer::CounterSize + 1];
+                if (read(_leader, buf, sizeof(buf)) < (ssize_t)sizeof(uint64_t))
+                    return false;
+                for (size_t i = 0; i < PerformanceMeasurer::CounterSize; ++i)
+                    values[i] = _index[i] < buf[0] ? (int64_t)buf[_index[i] + 1] : 0;
+                return true;
+#else
+                return false;
+#endif
+            }
+
+        private:
+#if defined(__linux__)
+            bool _opened;
+            int _leader, _fd[PerformanceMeasurer::CounterSize];
+            uint64_t _index[PerformanceMeasurer::CounterSize];
+
+            HardwareCounters()
+                : _opened(false)
+                , _leader(-1)
+            {
+                for (size_t i = 0; i < PerformanceMeasurer::CounterSize; ++i)
+                    _fd[i] = -1, _index[i] = UINT64_MAX;
+            }
+
+            ~HardwareCounters()
+            {
+                for (size_t i = 0; i < PerformanceMeasurer::CounterSize; ++i)
+                    if (_fd[i] >= 0)
+                        close(_fd[i]);
+            }
+
+            void Open()
+            {
+                static const uint32_t types[PerformanceMeasurer::CounterSize] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+                    PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE };
+                static const uint64_t configs[PerformanceMeasurer::CounterSize] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                    PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+                    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+                _opened = true;
+                uint64_t size = 0;
+                for (size_t i = 0; i < PerformanceMeasurer::CounterSize; ++i)
+                {
+                    perf_event_attr attr;
+                    memset(&attr, 0, sizeof(attr));
+                    attr.size = sizeof(attr);
+                    attr.type = types[i];
+                    attr.config = configs[i];
+                    attr.read_format = PERF_FORMAT_GROUP;
+                    attr.exclude_kernel = 1;
+                    attr.exclude_hv = 1;
+                    _fd[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, _leader, 0);
+                    if (_fd[i] < 0)
+                        continue;
+                    if (_leader < 0)
+                        _leader = _fd[i];
+                    _index[i] = size++;
+                }
+            }
+#else
+            HardwareCounters()
+            {
+            }
+#endif
+        };
+
+        //---------------------------------------------------------------------
+
+        static String JsonString(const String& str)
+        {
+            std::stringstream ss;
+            ss << "\"";
+            for (size_t i = 0; i < str.size(); ++i)
+            {
+                char c = str[i];
+                if (c == '"' || c == '\\')
+                    ss << '\\' << c;
+                else if ((unsigned char)c < 0x20)
+                    ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec << std::setfill(' ');
+                else
+                    ss << c;
+            }
+            ss << "\"";
+            return ss.str();
+        }
+
         PerformanceMeasurer::PerformanceMeasurer(const String& name, int64_t flop)
             : _name(name)
             , _flop(flop)
@@ -43,7 +178,10 @@ namespace Simd
             , _max(std::numeric_limits<int64_t>::min())
             , _entered(false)
             , _paused(false)
+            , _counted(false)
         {
+            std::fill(_hist, _hist + HIST_SIZE, 0);
+            std::fill(_counters, _counters + CounterSize, 0);
         }
 
         PerformanceMeasurer::PerformanceMeasurer(const PerformanceMeasurer & pm)
@@ -57,7 +195,10 @@ namespace Simd
             , _max(pm._max)
             , _entered(pm._entered)
             , _paused(pm._paused)
+            , _counted(pm._counted)
         {
+            std::copy(pm._hist, pm._hist + HIST_SIZE, _hist);
+            std::copy(pm._counters, pm._counters + CounterSize, _counters);
         }
 
         void PerformanceMeasurer::Enter()
@@ -66,6 +207,7 @@ namespace Simd
             {
                 _entered = true;
                 _paused = false;
+                _counted = PerformanceMeasurerStorage::s_storage.Counting() && HardwareCounters::ThisThread().Read(_counterStart);
                 _start = TimeCounter();
             }
         }
@@ -76,14 +218,23 @@ namespace Simd
             {
                 if (_entered)
                 {
+                    int64_t finish = TimeCounter(), counters[CounterSize];
                     _entered = false;
-                    _current += TimeCounter() - _start;
+                    if (_counted && HardwareCounters::ThisThread().Read(counters))
+                    {
+                        for (size_t i = 0; i < CounterSize; ++i)
+                            _counters[i] += counters[i] - _counterStart[i];
+                    }
+                    _current += finish - _start;
+                    if (_trace.size() < TRACE_MAX && PerformanceMeasurerStorage::s_storage.Tracing())
+                        _trace.push_back(Span(_start, finish));
                 }
                 if (!pause)
                 {
                     _total += _current;
                     _min = std::min(_min, _current);
                     _max = std::max(_max, _current);
+                    _hist[HistIndex(_current)]++;
                     ++_count;
                     _current = 0;
                 }
@@ -101,6 +252,30 @@ namespace Simd
             ss << std::setprecision(3) << " {min=" << Miliseconds(_min) << "; max=" << Miliseconds(_max) << "}";
             if (_flop)
                 ss << " " << std::setprecision(1) << GFlops() << " GFlops";
+            if (_counters[Cycles])
+            {
+                ss << std::setprecision(2) << " IPC=" << double(_counters[Instructions]) / double(_counters[Cycles]);
+                ss << std::setprecision(1) << " {L1D=" << PerCall(L1dMisses) * 0.001 << "K; LLC=" << PerCall(LlcMisses) * 0.001;
+                ss << "K; branch=" << PerCall(BranchMisses) * 0.001 << "K misses per call}";
+            }
+            return ss.str();
+        }
+
+        String PerformanceMeasurer::Json() const
+        {
+            std::stringstream ss;
+            ss << std::setprecision(3) << std::fixed;
+            ss << "\"count\": " << _count << ", \"total\": " << Miliseconds(_total) << ", \"average\": " << Average();
+            ss << ", \"min\": " << (_count ? Miliseconds(_min) : 0.0) << ", \"max\": " << (_count ? Miliseconds(_max) : 0.0);
+            ss << ", \"p50\": " << Percentile(0.50) << ", \"p90\": " << Percentile(0.90) << ", \"p99\": " << Percentile(0.99);
+            ss << ", \"gflops\": " << GFlops();
+            if (_counters[Cycles])
+            {
+                ss << ", \"ipc\": " << double(_counters[Instructions]) / double(_counters[Cycles]) << std::setprecision(0);
+                ss << ", \"cycles\": " << PerCall(Cycles) << ", \"instructions\": " << PerCall(Instructions);
+                ss << ", \"l1dMisses\": " << PerCall(L1dMisses) << ", \"llcMisses\": " << PerCall(LlcMisses);
+                ss << ", \"branchMisses\": " << PerCall(BranchMisses);
+            }
             return ss.str();
         }
 
@@ -110,6 +285,10 @@ namespace Simd
             _total += other._total;
             _min = std::min(_min, other._min);
             _max = std::max(_max, other._max);
+            for (size_t i = 0; i < HIST_SIZE; ++i)
+                _hist[i] += other._hist[i];
+            for (size_t i = 0; i < CounterSize; ++i)
+                _counters[i] += other._counters[i];
         }
 
         double PerformanceMeasurer::Average() const
@@ -122,6 +301,25 @@ namespace Simd
             return _count && _flop && _total > 0 ? (double(_flop) * _count / Miliseconds(_total) / 1000000.0) : 0;
         }
 
+        double PerformanceMeasurer::Percentile(double p) const
+        {
+            if (_count == 0)
+                return 0;
+            int64_t rank = std::max<int64_t>(int64_t(std::ceil(p * _count)), 1), sum = 0;
+            for (size_t i = 0; i < HIST_SIZE; ++i)
+            {
+                sum += _hist[i];
+                if (sum >= rank)
+                    return Miliseconds(std::min(std::max(HistValue(i), _min), _max));
+            }
+            return Miliseconds(_max);
+        }
+
+        double PerformanceMeasurer::PerCall(Counter counter) const
+        {
+            return _count ? double(_counters[counter]) / double(_count) : 0;
+        }
+
         //---------------------------------------------------------------------
 
         PerformanceMeasurerStorage PerformanceMeasurerStorage::s_storage;
@@ -149,6 +347,74 @@ namespace Simd
             _report = report.str();
             return _report.c_str();
         }
+
+        const char* PerformanceMeasurerStorage::JsonReport()
+        {
+            typedef std::map<String, std::vector<std::pair<size_t, const Pm*>>> ThreadsMap;
+            std::lock_guard<std::mutex> lock(_mutex);
+            FunctionMap combined;
+            ThreadsMap threads;
+            size_t index = 0;
+            for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread, ++index)
+            {
+                for (FunctionMap::const_iterator function = thread->second.begin(); function != thread->second.end(); ++function)
+                {
+                    if (combined.find(function->first) == combined.end())
+                        combined[function->first].reset(new PerformanceMeasurer(*function->second));
+                    else
+                        combined[function->first]->Combine(*function->second);
+                    threads[function->first].push_back(std::make_pair(index, function->second.get()));
+                }
+            }
+            std::stringstream report;
+            report << "{" << std::endl << "  \"functions\": [";
+            for (FunctionMap::const_iterator it = combined.begin(); it != combined.end(); ++it)
+            {
+                report << (it == combined.begin() ? "" : ",") << std::endl;
+                report << "    { \"name\": " << JsonString(it->first) << ", " << it->second->Json() << "," << std::endl;
+                report << "      \"threads\": [";
+                const ThreadsMap::mapped_type& list = threads[it->first];
+                for (size_t i = 0; i < list.size(); ++i)
+                    report << (i ? "," : "") << std::endl << "        { \"thread\": " << list[i].first << ", " << list[i].second->Json() << " }";
+                report << " ] }";
+            }
+            report << " ]" << std::endl << "}" << std::endl;
+            _report = report.str();
+            return _report.c_str();
+        }
+
+        const char* PerformanceMeasurerStorage::TraceReport()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            int64_t origin = std::numeric_limits<int64_t>::max();
+            for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread)
+                for (FunctionMap::const_iterator function = thread->second.begin(); function != thread->second.end(); ++function)
+                    if (function->second->Trace().size())
+                        origin = std::min(origin, function->second->Trace()[0].start);
+            std::stringstream report;
+            report << std::setprecision(3) << std::fixed;
+            report << "{ \"traceEvents\": [";
+            size_t index = 0, events = 0;
+            for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread, ++index)
+            {
+                for (FunctionMap::const_iterator function = thread->second.begin(); function != thread->second.end(); ++function)
+                {
+                    const Pm::Spans& spans = function->second->Trace();
+                    if (spans.empty())
+                        continue;
+                    String name = JsonString(function->first);
+                    for (size_t i = 0; i < spans.size(); ++i, ++events)
+                    {
+                        report << (events ? "," : "") << std::endl << "  { \"name\": " << name << ", \"cat\": \"simd\", \"ph\": \"X\"";
+                        report << ", \"ts\": " << Microseconds(spans[i].start - origin) << ", \"dur\": " << Microseconds(spans[i].finish - spans[i].start);
+                        report << ", \"pid\": 0, \"tid\": " << index << " }";
+                    }
+                }
+            }
+            report << " ]," << std::endl << "  \"displayTimeUnit\": \"ms\" }" << std::endl;
+            _report = report.str();
+            return _report.c_str();
+        }
     }
 }
 #endif//SIMD_PERFORMANCE_STATISTIC
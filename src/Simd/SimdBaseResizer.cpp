@@ -23,6 +23,8 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -41,6 +43,8 @@ namespace Simd
                 return new ResizerFloatBilinear(param);
             else if (param.IsByteBicubic())
                 return new ResizerByteBicubic(param);
+            else if (param.IsFilter())
+                return new ResizerFilter(param);
             else if (param.IsByteArea2x2())
                 return new ResizerByteArea2x2(param);
             else if (param.IsByteArea1x1())
@@ -48,6 +52,137 @@ namespace Simd
             else
                 return NULL;
         }
+
+        //---------------------------------------------------------------------------------------------
+
+        const size_t RESIZER_PARALLEL_ROWS_MIN = 16;
+        const size_t RESIZER_PARALLEL_SIZE_MIN = 64 * 1024;
+
+        ResizerParallel::ResizerParallel(const ResParam& param, ResizerInitPtr init, size_t threads)
+            : Resizer(param)
+            , _threads(threads)
+            , _context(Base::ThreadContextCurrent())
+        {
+            _resizer = (Resizer*)init(param.srcW, param.srcH, param.dstW, param.dstH, param.channels, param.type, param.method);
+            if (_resizer)
+                _resizer->SetBands(_threads);
+        }
+
+        ResizerParallel::~ResizerParallel()
+        {
+            if (_resizer)
+                delete _resizer;
+        }
+
+        void ResizerParallel::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            ThreadContextScope scope(_context);
+            Resizer* resizer = _resizer;
+            size_t threads = _threads, dstH = _param.dstH;
+            resizer->Run(src, srcStride, dst, dstStride, 0, 0, 0);//initializes lazily estimated tables before they are shared by bands.
+            Parallel(0, threads, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                    resizer->Run(src, srcStride, dst, dstStride, dstH * i / threads, dstH * (i + 1) / threads, i);
+            }, threads);
+        }
+
+        void ResizerParallel::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
+        {
+            _resizer->Run(src, srcStride, dst, dstStride, yBeg, yEnd, band);
+        }
+
+        void * ResizerParallelInit(ResizerInitPtr init, size_t threads, size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(void*));
+            threads = Min(Min(threads, dstY / RESIZER_PARALLEL_ROWS_MIN), dstX * dstY * param.PixelSize() / RESIZER_PARALLEL_SIZE_MIN);
+            if (threads <= 1)
+                return init(srcX, srcY, dstX, dstY, channels, type, method);
+            ResizerParallel* resizer = new ResizerParallel(param, init, threads);
+            if (resizer->Bands() == threads)
+                return resizer;
+            delete resizer;
+            return NULL;
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        ResizerYuv::ResizerYuv(ResizerInitPtr init, size_t threads, size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdYuvLayoutType layout, SimdResizeMethodType method)
+            : _threads(Simd::Max<size_t>(threads, 1))
+            , _context(Base::ThreadContextCurrent())
+            , _valid(true)
+        {
+            size_t srcUvX = DivHi(srcX, 2), srcUvY = DivHi(srcY, 2), dstUvX = DivHi(dstX, 2), dstUvY = DivHi(dstY, 2);
+            AddPlane(init, 0, srcX, srcY, dstX, dstY, 1, method);
+            switch (layout)
+            {
+            case SimdYuvLayoutGray8:
+                break;
+            case SimdYuvLayoutNv12:
+                AddPlane(init, 1, srcUvX, srcUvY, dstUvX, dstUvY, 2, method);
+                break;
+            case SimdYuvLayoutYuv420p:
+                AddPlane(init, 1, srcUvX, srcUvY, dstUvX, dstUvY, 1, method);
+                AddPlane(init, 2, srcUvX, srcUvY, dstUvX, dstUvY, 1, method);
+                break;
+            default:
+                _valid = false;
+            }
+        }
+
+        ResizerYuv::~ResizerYuv()
+        {
+            for (size_t i = 0; i < _resizers.size(); ++i)
+                delete _resizers[i];
+        }
+
+        void ResizerYuv::AddPlane(ResizerInitPtr init, size_t plane, size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method)
+        {
+            if (!_valid)
+                return;
+            Resizer* resizer = (Resizer*)init(srcX, srcY, dstX, dstY, channels, SimdResizeChannelByte, method);
+            if (resizer == NULL)
+            {
+                _valid = false;
+                return;
+            }
+            size_t bands = Simd::Max<size_t>(Min(_threads, dstY / RESIZER_PARALLEL_ROWS_MIN), 1);
+            resizer->SetBands(bands);
+            _resizers.push_back(resizer);
+            for (size_t i = 0; i < bands; ++i)
+                _bands.push_back(Band({ resizer, plane, dstY * i / bands, dstY * (i + 1) / bands, i }));
+        }
+
+        void ResizerYuv::Run(const uint8_t* const* src, const size_t* srcStride, uint8_t* const* dst, const size_t* dstStride)
+        {
+            ThreadContextScope scope(_context);
+            const Band* bands = _bands.data();
+            for (size_t i = 0; i < _bands.size(); ++i)
+            {
+                size_t p = bands[i].plane;
+                if (bands[i].band == 0)
+                    bands[i].resizer->Run(src[p], srcStride[p], dst[p], dstStride[p], 0, 0, 0);
+            }
+            Parallel(0, _bands.size(), [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    size_t p = bands[i].plane;
+                    bands[i].resizer->Run(src[p], srcStride[p], dst[p], dstStride[p], bands[i].yBeg, bands[i].yEnd, bands[i].band);
+                }
+            }, _threads, 1, _bands.size());
+        }
+
+        void * ResizerYuvInit(ResizerInitPtr init, size_t threads, size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdYuvLayoutType layout, SimdResizeMethodType method)
+        {
+            if (srcX == 0 || srcY == 0 || dstX == 0 || dstY == 0)
+                return NULL;
+            ResizerYuv* resizer = new ResizerYuv(init, threads, srcX, srcY, dstX, dstY, layout, method);
+            if (resizer->Valid())
+                return resizer;
+            delete resizer;
+            return NULL;
+        }
     }
 }
 
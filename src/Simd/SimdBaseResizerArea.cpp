@@ -66,7 +66,7 @@ namespace Simd
         {
             EstimateParams(_param.srcH, _param.dstH, Base::AREA_RANGE, _ay.data, _iy.data);
             EstimateParams(_param.srcW, _param.dstW, Base::AREA_RANGE, _ax.data, _ix.data);
-            _by.Resize(AlignHi(_param.srcW * _param.channels, _param.align), false, _param.align);
+            SetBandSize(AlignHi(_param.srcW * _param.channels, _param.align) * sizeof(int32_t));
         }
 
         template<size_t N, UpdateType update> SIMD_INLINE void ResizerByteArea1x1RowUpdate(const uint8_t* src, int32_t val, int32_t* dst)
@@ -97,14 +97,16 @@ namespace Simd
                 ResizerByteArea1x1RowUpdate<N, UpdateSet>(src, size, curr - next, dst);
         }
 
-        template<size_t N> void ResizerByteArea1x1::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea1x1::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, int32_t* by)
         {
             size_t dstW = _param.dstW, rowSize = _param.srcW * N, rowRest = dstStride - dstW * N;
             const int32_t* iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += iy[yBeg] * srcStride;
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += rowRest)
             {
-                int32_t* buf = _by.data;
+                int32_t* buf = by;
                 size_t yn = iy[dy + 1] - iy[dy];
                 ResizerByteArea1x1RowSum<N>(src, srcStride, yn, rowSize, ay[dy], ay0, ay[dy + 1], buf), src += yn * srcStride;
                 for (size_t dx = 0; dx < dstW; dx++, dst += N)
@@ -115,14 +117,14 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea1x1::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteArea1x1::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
+            case 2: Run<2>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
+            case 3: Run<3>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
+            case 4: Run<4>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
             default:
                 assert(0);
             }
@@ -135,7 +137,7 @@ namespace Simd
         {
             EstimateParams(DivHi(_param.srcH, 2), _param.dstH, Base::AREA_RANGE / 2, _ay.data, _iy.data);
             EstimateParams(DivHi(_param.srcW, 2), _param.dstW, Base::AREA_RANGE / 2, _ax.data, _ix.data);
-            _by.Resize(AlignHi(DivHi(_param.srcW, 2) * _param.channels, _param.align) + SIMD_ALIGN, false, _param.align);
+            SetBandSize((AlignHi(DivHi(_param.srcW, 2) * _param.channels, _param.align) + SIMD_ALIGN) * sizeof(int32_t));
         }
 
         template<size_t N, UpdateType update> SIMD_INLINE void ResizerByteArea2x2RowUpdate(const uint8_t* src0, const uint8_t* src1, size_t size, int32_t val, int32_t* dst)
@@ -164,14 +166,16 @@ namespace Simd
                 ResizerByteArea2x2RowUpdate<N, UpdateSet>(src, tail ? src : src + stride, size, curr - next, dst);
         }
 
-        template<size_t N> void ResizerByteArea2x2::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea2x2::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, int32_t* by)
         {
             size_t dstW = _param.dstW, rowSize = _param.srcW * N, rowRest = dstStride - dstW * N;
             const int32_t* iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += iy[yBeg] * 2 * srcStride;
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += rowRest)
             {
-                int32_t* buf = _by.data;
+                int32_t* buf = by;
                 size_t yn = (iy[dy + 1] - iy[dy]) * 2;
                 bool tail = (dy == _param.dstH - 1) && (_param.srcH & 1);
                 ResizerByteArea2x2RowSum<N>(src, srcStride, yn, rowSize, ay[dy], ay0, ay[dy + 1], tail, buf), src += yn * srcStride;
@@ -183,14 +187,14 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea2x2::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        void ResizerByteArea2x2::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
+            case 2: Run<2>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
+            case 3: Run<3>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
+            case 4: Run<4>(src, srcStride, dst, dstStride, yBeg, yEnd, (int32_t*)Buffer(band)); return;
             default:
                 assert(0);
             }
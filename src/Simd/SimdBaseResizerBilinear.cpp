@@ -68,7 +68,7 @@ namespace Simd
             }
         }        
 
-        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
         {
             size_t cn =  _param.channels;
             size_t rs = _param.dstW * cn;
@@ -77,12 +77,13 @@ namespace Simd
                 _ax.Resize(rs);
                 _ix.Resize(rs);
                 EstimateIndexAlpha(_param.srcW, _param.dstW, cn, _ix.data, _ax.data);
-                _bx[0].Resize(rs);
-                _bx[1].Resize(rs);
+                SetBandSize(2 * AlignHi(rs * sizeof(int32_t), _param.align));
             }
-            int32_t * pbx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t* buf = Buffer(band);
+            int32_t * pbx[2] = { Allocate<int32_t>(buf, rs, _param.align), Allocate<int32_t>(buf, rs, _param.align) };
             int32_t prev = -2;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 int32_t fy = _ay[dy];
                 int32_t sy = _iy[dy];
@@ -140,8 +141,7 @@ namespace Simd
             _ax.Resize(rs, false, _param.align);
             _ix.Resize(rs, false, _param.align);
             EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
-            _bx[0].Resize(rs, false, _param.align);
-            _bx[1].Resize(rs, false, _param.align);
+            SetBandSize(2 * AlignHi(rs * sizeof(float), _param.align));
         }
 
         void ResizerShortBilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t* indices, float* alphas)
@@ -171,17 +171,18 @@ namespace Simd
             }
         }
 
-        void ResizerShortBilinear::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        void ResizerShortBilinear::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
         {
-            Run((const uint16_t*)src, srcStride / sizeof(uint16_t), (uint16_t*)dst, dstStride / sizeof(uint16_t));
+            Run((const uint16_t*)src, srcStride / sizeof(uint16_t), (uint16_t*)dst, dstStride / sizeof(uint16_t), yBeg, yEnd, (float*)Buffer(band));
         }
 
-        template<size_t N> void ResizerShortBilinear::RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride)
+        template<size_t N> void ResizerShortBilinear::RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf)
         {
             size_t rs = _param.dstW * N;
-            float* pbx[2] = { _bx[0].data, _bx[1].data };
+            float* pbx[2] = { buf, buf + _bandSize / 2 / sizeof(float) };
             int32_t prev = -2;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -211,10 +212,11 @@ namespace Simd
             }
         }
 
-        template<size_t N> void ResizerShortBilinear::RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride)
+        template<size_t N> void ResizerShortBilinear::RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd)
         {
             size_t rs = _param.dstW * N;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -233,15 +235,15 @@ namespace Simd
             }
         }
 
-        void ResizerShortBilinear::Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride)
+        void ResizerShortBilinear::Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf)
         {
             bool sparse = _param.dstH * 2.0 <= _param.srcH;
             switch (_param.channels)
             {
-            case 1: sparse ? RunS<1>(src, srcStride, dst, dstStride) : RunB<1>(src, srcStride, dst, dstStride); return;
-            case 2: sparse ? RunS<2>(src, srcStride, dst, dstStride) : RunB<2>(src, srcStride, dst, dstStride); return;
-            case 3: sparse ? RunS<3>(src, srcStride, dst, dstStride) : RunB<3>(src, srcStride, dst, dstStride); return;
-            case 4: sparse ? RunS<4>(src, srcStride, dst, dstStride) : RunB<4>(src, srcStride, dst, dstStride); return;
+            case 1: sparse ? RunS<1>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<1>(src, srcStride, dst, dstStride, yBeg, yEnd, buf); return;
+            case 2: sparse ? RunS<2>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<2>(src, srcStride, dst, dstStride, yBeg, yEnd, buf); return;
+            case 3: sparse ? RunS<3>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<3>(src, srcStride, dst, dstStride, yBeg, yEnd, buf); return;
+            case 4: sparse ? RunS<4>(src, srcStride, dst, dstStride, yBeg, yEnd) : RunB<4>(src, srcStride, dst, dstStride, yBeg, yEnd, buf); return;
             default:
                 assert(0);
             }
@@ -259,8 +261,7 @@ namespace Simd
             _ax.Resize(rs, false, _param.align);
             _ix.Resize(rs, false, _param.align);
             EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
-            _bx[0].Resize(rs, false, _param.align);
-            _bx[1].Resize(rs, false, _param.align);
+            SetBandSize(2 * AlignHi(rs * sizeof(float), _param.align));
         }
 
         void ResizerFloatBilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, float * alphas)
@@ -342,18 +343,19 @@ namespace Simd
                 assert(0);
         }
 
-        void ResizerFloatBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerFloatBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
         {
-            Run((const float*)src, srcStride / sizeof(float), (float*)dst, dstStride / sizeof(float));
+            Run((const float*)src, srcStride / sizeof(float), (float*)dst, dstStride / sizeof(float), yBeg, yEnd, (float*)Buffer(band));
         }
 
-        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf)
         {
             size_t cn = _param.channels;
             size_t rs = _param.dstW * cn;
-            float * pbx[2] = { _bx[0].data, _bx[1].data };
+            float * pbx[2] = { buf, buf + _bandSize / 2 / sizeof(float) };
             int32_t prev = -2;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -0,0 +1,188 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+#include <mutex>
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t RESIZER_CACHE_CAPACITY_DEFAULT = 16;
+
+        class ResizerCache
+        {
+        public:
+            static ResizerCache& Global()
+            {
+                static ResizerCache cache;
+                return cache;
+            }
+
+            void* Acquire(const ResizerCacheKey& key)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (size_t i = 0; i < _entries.size(); ++i)
+                {
+                    Entry& entry = _entries[i];
+                    if (!entry.busy && entry.key == key)
+                    {
+                        entry.busy = true;
+                        entry.tick = ++_tick;
+                        return entry.resizer;
+                    }
+                }
+                return NULL;
+            }
+
+            void Release(const ResizerCacheKey& key, void* resizer)
+            {
+                void* evicted = NULL;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    for (size_t i = 0; i < _entries.size(); ++i)
+                    {
+                        if (_entries[i].resizer == resizer)
+                        {
+                            if (_entries.size() > _capacity)
+                            {
+                                _entries.erase(_entries.begin() + i);
+                                evicted = resizer;
+                            }
+                            else
+                            {
+                                _entries[i].busy = false;
+                                _entries[i].tick = ++_tick;
+                            }
+                            resizer = NULL;
+                            break;
+                        }
+                    }
+                    if (resizer)
+                    {
+                        if (_entries.size() < _capacity)
+                            _entries.push_back(Entry(key, resizer, ++_tick));
+                        else
+                        {
+                            size_t oldest = FindOldest();
+                            if (oldest < _entries.size())
+                            {
+                                evicted = _entries[oldest].resizer;
+                                _entries[oldest] = Entry(key, resizer, ++_tick);
+                            }
+                            else
+                                evicted = resizer;
+                        }
+                    }
+                }
+                if (evicted)
+                    delete (Deletable*)evicted;
+            }
+
+            void SetCapacity(size_t capacity)
+            {
+                std::vector<void*> evicted;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _capacity = capacity;
+                    while (_entries.size() > _capacity)
+                    {
+                        size_t oldest = FindOldest();
+                        if (oldest == _entries.size())
+                            break;
+                        evicted.push_back(_entries[oldest].resizer);
+                        _entries.erase(_entries.begin() + oldest);
+                    }
+                }
+                for (size_t i = 0; i < evicted.size(); ++i)
+                    delete (Deletable*)evicted[i];
+            }
+
+            size_t Capacity()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _capacity;
+            }
+
+        private:
+            struct Entry
+            {
+                ResizerCacheKey key;
+                void* resizer;
+                uint64_t tick;
+                bool busy;
+
+                Entry(const ResizerCacheKey& k, void* r, uint64_t t) : key(k), resizer(r), tick(t), busy(false) {}
+            };
+
+            ResizerCache()
+                : _capacity(RESIZER_CACHE_CAPACITY_DEFAULT)
+                , _tick(0)
+            {
+                _entries.reserve(_capacity);
+            }
+
+            ~ResizerCache()
+            {
+                for (size_t i = 0; i < _entries.size(); ++i)
+                    delete (Deletable*)_entries[i].resizer;
+            }
+
+            size_t FindOldest() const
+            {
+                size_t oldest = _entries.size();
+                for (size_t i = 0; i < _entries.size(); ++i)
+                    if (!_entries[i].busy && (oldest == _entries.size() || _entries[i].tick < _entries[oldest].tick))
+                        oldest = i;
+                return oldest;
+            }
+
+            std::vector<Entry> _entries;
+            size_t _capacity;
+            uint64_t _tick;
+            std::mutex _mutex;
+        };
+
+        void* ResizerCacheAcquire(const ResizerCacheKey& key)
+        {
+            return ResizerCache::Global().Acquire(key);
+        }
+
+        void ResizerCacheRelease(const ResizerCacheKey& key, void* resizer)
+        {
+            ResizerCache::Global().Release(key, resizer);
+        }
+
+        void ResizerCacheSetCapacity(size_t capacity)
+        {
+            ResizerCache::Global().SetCapacity(capacity);
+        }
+
+        size_t ResizerCacheGetCapacity()
+        {
+            return ResizerCache::Global().Capacity();
+        }
+    }
+}
@@ -0,0 +1,241 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdResizerCommon.h"
+
+#include <math.h>
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE double LanczosWeight(double x)
+        {
+            const double a = RESIZER_LANCZOS_SIZE, pi = 3.14159265358979323846;
+            if (x == 0.0)
+                return 1.0;
+            if (x <= -a || x >= a)
+                return 0.0;
+            return a * ::sin(pi * x) * ::sin(pi * x / a) / (pi * pi * x * x);
+        }
+
+        static void FilterWeights(SimdResizeMethodType method, size_t srcSize, size_t dstSize, size_t i, std::vector<double>& weights, ptrdiff_t & first)
+        {
+            double scale = double(srcSize) / double(dstSize);
+            weights.clear();
+            if (method == SimdResizeMethodBicubic)
+            {
+                float pos = (float)((i + 0.5f) * float(scale) - 0.5f);
+                int idx = (int)::floor(pos);
+                float d = pos - idx;
+                if (idx < 0)
+                {
+                    idx = 0;
+                    d = 0.0f;
+                }
+                if (idx > (int)srcSize - 2)
+                {
+                    idx = (int)srcSize - 2;
+                    d = 1.0f;
+                }
+                first = idx - 1;
+                weights.push_back(-(2.0f - d) * (1.0f - d) * d / 6.0f);
+                weights.push_back((2.0f - d) * (1.0f + d) * (1.0f - d) / 2.0f);
+                weights.push_back((2.0f - d) * (1.0f + d) * d / 2.0f);
+                weights.push_back(-(1.0f + d) * (1.0f - d) * d / 6.0f);
+            }
+            else if (method == SimdResizeMethodLanczos)
+            {
+                double factor = Max(scale, 1.0), support = RESIZER_LANCZOS_SIZE * factor, center = (i + 0.5) * scale;
+                ptrdiff_t beg = (ptrdiff_t)::floor(center - support), end = (ptrdiff_t)::ceil(center + support);
+                first = beg;
+                for (ptrdiff_t p = beg; p < end; ++p)
+                    weights.push_back(LanczosWeight((p + 0.5 - center) / factor));
+            }
+            else
+            {
+                size_t beg = i * srcSize, end = (i + 1) * srcSize;
+                first = ptrdiff_t(beg / dstSize);
+                for (size_t p = beg / dstSize; p * dstSize < end; ++p)
+                    weights.push_back(double(Min(end, (p + 1) * dstSize) - Max(beg, p * dstSize)) / double(srcSize));
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        template<class T> void ResizerFilterRowVert(const uint8_t* src, size_t stride, size_t size, const float* ay, size_t ky, float* dst)
+        {
+            const T* ps = (const T*)src;
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = float(ps[i]) * ay[0];
+            for (size_t k = 1; k < ky; ++k)
+            {
+                ps = (const T*)(src + k * stride);
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] += float(ps[i]) * ay[k];
+            }
+        }
+
+        template<class T> SIMD_INLINE T ResizerFilterCast(float value);
+
+        template<> SIMD_INLINE uint8_t ResizerFilterCast<uint8_t>(float value)
+        {
+            return (uint8_t)RestrictRange(Round(value), 0, 0xFF);
+        }
+
+        template<> SIMD_INLINE uint16_t ResizerFilterCast<uint16_t>(float value)
+        {
+            return (uint16_t)RestrictRange(Round(value), 0, 0xFFFF);
+        }
+
+        template<> SIMD_INLINE float ResizerFilterCast<float>(float value)
+        {
+            return value;
+        }
+
+        template<class T, size_t N> void ResizerFilterRowHorz(const float* src, size_t width, const int32_t* ix, const float* ax, size_t kx, uint8_t* dst)
+        {
+            T* pd = (T*)dst;
+            for (size_t dx = 0; dx < width; dx++, ax += kx, pd += N)
+            {
+                const float* ps = src + ix[dx];
+                float sum[N];
+                for (size_t c = 0; c < N; ++c)
+                    sum[c] = ps[c] * ax[0];
+                for (size_t k = 1; k < kx; ++k)
+                    for (size_t c = 0; c < N; ++c)
+                        sum[c] += ps[k * N + c] * ax[k];
+                for (size_t c = 0; c < N; ++c)
+                    pd[c] = ResizerFilterCast<T>(sum[c]);
+            }
+        }
+
+        template<class T> ResizerFilter::RowHorzPtr GetResizerFilterRowHorz(size_t channels)
+        {
+            switch (channels)
+            {
+            case 1: return ResizerFilterRowHorz<T, 1>;
+            case 2: return ResizerFilterRowHorz<T, 2>;
+            case 3: return ResizerFilterRowHorz<T, 3>;
+            case 4: return ResizerFilterRowHorz<T, 4>;
+            default:
+                assert(0); return NULL;
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        ResizerFilter::ResizerFilter(const ResParam& param)
+            : Resizer(param)
+        {
+            EstimateIndexAlpha(_param.srcH, _param.dstH, 1, 1, _iy, _ay, _ky);
+            EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, RESIZER_FILTER_ALIGN, _ix, _ax, _kx);
+            SetBandSize(((_param.srcW + _kx) * _param.channels + RESIZER_FILTER_ALIGN) * sizeof(float));
+            switch (_param.type)
+            {
+            case SimdResizeChannelByte:
+                _rowVert = ResizerFilterRowVert<uint8_t>;
+                _rowHorz = GetResizerFilterRowHorz<uint8_t>(_param.channels);
+                break;
+            case SimdResizeChannelShort:
+                _rowVert = ResizerFilterRowVert<uint16_t>;
+                _rowHorz = GetResizerFilterRowHorz<uint16_t>(_param.channels);
+                break;
+            case SimdResizeChannelFloat:
+                _rowVert = ResizerFilterRowVert<float>;
+                _rowHorz = GetResizerFilterRowHorz<float>(_param.channels);
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        void ResizerFilter::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, size_t align, Array32i& index, Array32f& alpha, size_t& kernel)
+        {
+            std::vector<std::vector<double>> weights(dstSize);
+            std::vector<ptrdiff_t> firsts(dstSize);
+            kernel = 1;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                std::vector<double> raw;
+                ptrdiff_t first = 0;
+                FilterWeights(_param.method, srcSize, dstSize, i, raw, first);
+                ptrdiff_t beg = (ptrdiff_t)srcSize, end = 0;
+                for (size_t j = 0; j < raw.size(); ++j)
+                {
+                    if (raw[j] == 0.0)
+                        continue;
+                    ptrdiff_t p = Simd::RestrictRange<ptrdiff_t>(first + ptrdiff_t(j), 0, srcSize - 1);
+                    beg = Min(beg, p);
+                    end = Max(end, p + 1);
+                }
+                if (beg >= end)
+                {
+                    beg = Simd::RestrictRange<ptrdiff_t>(first, 0, srcSize - 1);
+                    end = beg + 1;
+                }
+                std::vector<double>& w = weights[i];
+                w.resize(end - beg, 0.0);
+                double sum = 0;
+                for (size_t j = 0; j < raw.size(); ++j)
+                {
+                    ptrdiff_t p = Simd::RestrictRange<ptrdiff_t>(first + ptrdiff_t(j), 0, srcSize - 1);
+                    if (raw[j] != 0.0 && p >= beg && p < end)
+                        w[p - beg] += raw[j], sum += raw[j];
+                }
+                if (sum != 0.0)
+                    for (size_t j = 0; j < w.size(); ++j)
+                        w[j] /= sum;
+                else
+                    w[0] = 1.0;
+                firsts[i] = beg;
+                kernel = Max(kernel, w.size());
+            }
+            size_t size = AlignHi(kernel, align);
+            index.Resize(dstSize);
+            alpha.Resize(dstSize * size, true);
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                ptrdiff_t beg = Min(firsts[i], ptrdiff_t(srcSize - kernel));
+                for (size_t j = 0; j < weights[i].size(); ++j)
+                    alpha[i * size + firsts[i] - beg + j] = (float)weights[i][j];
+                index[i] = int32_t(beg * channels);
+            }
+            kernel = size;
+        }
+
+        void ResizerFilter::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
+        {
+            size_t size = _param.srcW * _param.channels;
+            float* bx = (float*)Buffer(band);
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++, dst += dstStride)
+            {
+                _rowVert(src + _iy[dy] * srcStride, srcStride, size, _ay.data + dy * _ky, _ky, bx);
+                _rowHorz(bx, _param.dstW, _ix.data, _ax.data, _kx, dst);
+            }
+        }
+    }
+}
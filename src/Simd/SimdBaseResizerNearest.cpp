@@ -78,9 +78,10 @@ namespace Simd
             EstimateIndex(_param.srcW, _param.dstW, _pixelSize, 1, _ix.data);
         }
 
-        void ResizerNearest::Resize(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        void ResizerNearest::Resize(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd)
         {
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++)
             {
                 const uint8_t* srcRow = src + _iy[dy] * srcStride;
                 for (size_t dx = 0, offset = 0; dx < _param.dstW; dx++, offset += _pixelSize)
@@ -89,9 +90,10 @@ namespace Simd
             }
         }
 
-        template<size_t N> void ResizerNearest::Resize(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        template<size_t N> void ResizerNearest::Resize(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd)
         {
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++)
             {
                 const uint8_t * srcRow = src + _iy[dy] * srcStride;
                 for (size_t dx = 0, offset = 0; dx < _param.dstW; dx++, offset += N)
@@ -100,20 +102,20 @@ namespace Simd
             }
         }
 
-        void ResizerNearest::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        void ResizerNearest::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
         {
             EstimateParams();
             switch (_pixelSize)
             {
-            case 1: Resize<1>(src, srcStride, dst, dstStride); break;
-            case 2: Resize<2>(src, srcStride, dst, dstStride); break;
-            case 3: Resize<3>(src, srcStride, dst, dstStride); break;
-            case 4: Resize<4>(src, srcStride, dst, dstStride); break;
-            case 6: Resize<6>(src, srcStride, dst, dstStride); break;
-            case 8: Resize<8>(src, srcStride, dst, dstStride); break;
-            case 12: Resize<12>(src, srcStride, dst, dstStride); break;
+            case 1: Resize<1>(src, srcStride, dst, dstStride, yBeg, yEnd); break;
+            case 2: Resize<2>(src, srcStride, dst, dstStride, yBeg, yEnd); break;
+            case 3: Resize<3>(src, srcStride, dst, dstStride, yBeg, yEnd); break;
+            case 4: Resize<4>(src, srcStride, dst, dstStride, yBeg, yEnd); break;
+            case 6: Resize<6>(src, srcStride, dst, dstStride, yBeg, yEnd); break;
+            case 8: Resize<8>(src, srcStride, dst, dstStride, yBeg, yEnd); break;
+            case 12: Resize<12>(src, srcStride, dst, dstStride, yBeg, yEnd); break;
             default:
-                Resize(src, srcStride, dst, dstStride);
+                Resize(src, srcStride, dst, dstStride, yBeg, yEnd);
             }
         }
     }
@@ -0,0 +1,164 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizerRoi.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<class T> SIMD_INLINE float RoiLoad(const T* src, size_t i)
+        {
+            return (float)src[i];
+        }
+
+        template<class T> SIMD_INLINE void RoiStore(float value, T* dst, size_t i);
+
+        template<> SIMD_INLINE void RoiStore(float value, uint8_t* dst, size_t i)
+        {
+            dst[i] = (uint8_t)RestrictRange(Round(value), 0, 255);
+        }
+
+        template<> SIMD_INLINE void RoiStore(float value, float* dst, size_t i)
+        {
+            dst[i] = value;
+        }
+
+        template<class T> void ResizerRoiVert(const uint8_t* src0, const uint8_t* src1, float alpha, size_t size, float* dst)
+        {
+            const T* s0 = (const T*)src0;
+            const T* s1 = (const T*)src1;
+            for (size_t i = 0; i < size; ++i)
+            {
+                float v0 = RoiLoad(s0, i);
+                dst[i] = v0 + (RoiLoad(s1, i) - v0) * alpha;
+            }
+        }
+
+        template<class T> void ResizerRoiHorz(const float* src, const int32_t* ix, const float* ax, size_t width, size_t channels, float* buf, uint8_t* dst)
+        {
+            T* d = (T*)dst;
+            for (size_t x = 0; x < width; ++x)
+            {
+                const float* s = src + ix[x];
+                float alpha = ax[x];
+                for (size_t c = 0; c < channels; ++c, ++d)
+                    RoiStore(s[c] + (s[c + channels] - s[c]) * alpha, d, 0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void ResizerRoiIndexAlpha(float beg, float end, size_t srcSize, size_t dstSize, int32_t* idx, float* alpha, int32_t& lo, int32_t& hi)
+        {
+            float scale = (end - beg) / dstSize, max = float(srcSize - 1);
+            int32_t last = (int32_t)(srcSize > 1 ? srcSize - 2 : 0);
+            lo = last, hi = 0;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                float pos = Simd::Min(Simd::Max(beg + (float(i) + 0.5f) * scale - 0.5f, 0.0f), max);
+                int32_t index = Simd::Min((int32_t)pos, last);
+                idx[i] = index;
+                alpha[i] = pos - float(index);
+                lo = Simd::Min(lo, index);
+                hi = Simd::Max(hi, index);
+            }
+            hi = Simd::Min(hi + 1, (int32_t)srcSize - 1);
+        }
+
+        const size_t RESIZER_ROI_PAD = 16;
+
+        ResizerRoi::ResizerRoi(const RoiResParam& param)
+            : _param(param)
+            , _threads(Base::GetThreadNumber())
+            , _context(Base::ThreadContextCurrent())
+        {
+            _buffers.resize(Simd::Max<size_t>(_threads, 1));
+            size_t rowSize = (_param.srcW + 2) * _param.channels + RESIZER_ROI_PAD;
+            for (size_t i = 0; i < _buffers.size(); ++i)
+            {
+                Buffer& buf = _buffers[i];
+                buf.ix.Resize(_param.dstW);
+                buf.ax.Resize(_param.dstW);
+                buf.iy.Resize(_param.dstH);
+                buf.ay.Resize(_param.dstH);
+                buf.row.Resize(rowSize, true);
+                buf.tmp.Resize(_param.dstW * _param.channels + RESIZER_ROI_PAD);
+            }
+            if (_param.type == SimdResizeChannelFloat)
+            {
+                _vert = ResizerRoiVert<float>;
+                _horz = ResizerRoiHorz<float>;
+            }
+            else
+            {
+                _vert = ResizerRoiVert<uint8_t>;
+                _horz = ResizerRoiHorz<uint8_t>;
+            }
+        }
+
+        void ResizerRoi::Run(const uint8_t* src, size_t srcStride, const float* rois, size_t count, uint8_t* dst)
+        {
+            ThreadContextScope scope(_context);
+            size_t dstSize = _param.DstSize();
+            Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                    RunRoi(src, srcStride, rois + i * 4, dst + i * dstSize, _buffers[thread]);
+            }, _buffers.size(), 1, 4);
+        }
+
+        void ResizerRoi::RunRoi(const uint8_t* src, size_t srcStride, const float* roi, uint8_t* dst, Buffer& buf)
+        {
+            const RoiResParam& p = _param;
+            int32_t xLo, xHi, yLo, yHi;
+            ResizerRoiIndexAlpha(roi[0], roi[2], p.srcW, p.dstW, buf.ix.data, buf.ax.data, xLo, xHi);
+            ResizerRoiIndexAlpha(roi[1], roi[3], p.srcH, p.dstH, buf.iy.data, buf.ay.data, yLo, yHi);
+            size_t cs = p.ChannelSize(), ps = p.channels * cs, span = (xHi - xLo + 1) * p.channels;
+            for (size_t x = 0; x < p.dstW; ++x)
+                buf.ix[x] = (buf.ix[x] - xLo) * (int32_t)p.channels;
+            for (size_t i = span, n = span + p.channels + RESIZER_ROI_PAD; i < n; ++i)
+                buf.row[i] = 0.0f;
+            size_t dstStride = p.dstW * ps;
+            src += xLo * ps;
+            for (size_t y = 0; y < p.dstH; ++y, dst += dstStride)
+            {
+                size_t y0 = buf.iy[y], y1 = Simd::Min(y0 + 1, p.srcH - 1);
+                _vert(src + y0 * srcStride, src + y1 * srcStride, buf.ay[y], span, buf.row.data);
+                _horz(buf.row.data, buf.ix.data, buf.ax.data, p.dstW, p.channels, buf.tmp.data, dst);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerRoiInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            RoiResParam param(srcX, srcY, dstX, dstY, channels, type, method);
+            if (!param.Valid())
+                return NULL;
+            return new ResizerRoi(param);
+        }
+    }
+}
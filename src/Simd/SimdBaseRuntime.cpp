@@ -0,0 +1,143 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRuntime.h"
+#include "Simd/SimdCpu.h"
+
+#include <map>
+#include <mutex>
+#include <fstream>
+
+namespace Simd
+{
+    namespace Base
+    {
+        class RuntimeCache
+        {
+        public:
+            static RuntimeCache & Global()
+            {
+                static RuntimeCache cache;
+                return cache;
+            }
+
+            bool Find(const String & key, String & name)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                Entries::const_iterator it = _entries.find(Entry(_model, key));
+                if (it == _entries.end())
+                    return false;
+                name = it->second;
+                return true;
+            }
+
+            void Store(const String & key, const String & name)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _entries[Entry(_model, key)] = name;
+            }
+
+            bool Load(const char * path)
+            {
+                std::ifstream ifs(path);
+                if (!ifs.is_open())
+                    return false;
+                Entries entries;
+                String line;
+                while (std::getline(ifs, line))
+                {
+                    if (line.empty())
+                        continue;
+                    size_t tab1 = line.find('\t'), tab2 = line.find('\t', tab1 + 1);
+                    if (tab1 == String::npos || tab2 == String::npos || tab2 == tab1 + 1 || tab2 + 1 == line.size() || line.find('\t', tab2 + 1) != String::npos)
+                        return false;
+                    entries[Entry(line.substr(0, tab1), line.substr(tab1 + 1, tab2 - tab1 - 1))] = line.substr(tab2 + 1);
+                }
+                if (ifs.bad())
+                    return false;
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (Entries::const_iterator it = entries.begin(); it != entries.end(); ++it)
+                    _entries[it->first] = it->second;
+                return true;
+            }
+
+            bool Save(const char * path)
+            {
+                std::ofstream ofs(path);
+                if (!ofs.is_open())
+                    return false;
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (Entries::const_iterator it = _entries.begin(); it != _entries.end(); ++it)
+                    ofs << it->first.first << "\t" << it->first.second << "\t" << it->second << std::endl;
+                return !ofs.fail();
+            }
+
+            void Clear()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _entries.clear();
+            }
+
+        private:
+            typedef std::pair<String, String> Entry;
+            typedef std::map<Entry, String> Entries;
+
+            RuntimeCache()
+                : _model(CpuModel())
+            {
+                for (size_t i = 0; i < _model.size(); ++i)
+                    if (_model[i] == '\t' || _model[i] == '\n' || _model[i] == '\r')
+                        _model[i] = ' ';
+            }
+
+            String _model;
+            Entries _entries;
+            std::mutex _mutex;
+        };
+
+        bool RuntimeCacheFind(const String & key, String & name)
+        {
+            return RuntimeCache::Global().Find(key, name);
+        }
+
+        void RuntimeCacheStore(const String & key, const String & name)
+        {
+            RuntimeCache::Global().Store(key, name);
+        }
+
+        bool RuntimeCacheLoad(const char * path)
+        {
+            return RuntimeCache::Global().Load(path);
+        }
+
+        bool RuntimeCacheSave(const char * path)
+        {
+            return RuntimeCache::Global().Save(path);
+        }
+
+        void RuntimeCacheClear()
+        {
+            RuntimeCache::Global().Clear();
+        }
+    }
+}
@@ -26,6 +26,7 @@
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -401,65 +402,62 @@ namespace Simd
             const ConvParam32f & p = _param;
             if (!_skipConv)
                 buf = Buffer(buf);
-            if (_merge > 1)
+            size_t threads = Tuned() && !(_nhwcWeight.data && _gemmCb.Size() == 0) ? _threads : 1;
+            for (size_t b = 0; b < _batch; b += _merge)
             {
-                for (size_t b = 0; b < _batch; b += _merge)
+                const float * tmp = src;
+                if (!_skipConv)
                 {
-                    const float * tmp = src;
-                    if (!_skipConv)
-                    {
-                        for (size_t m = 0; m < _merge; ++m)
-                            ImgToRow(src + m * _sizeS, buf + m * _sizeB);
-                        tmp = buf;
-                    }
-                    if (_nhwcWeight.data)
+                    if (_merge > 1)
                     {
-                        if (_gemmCb.Size())
-                            _gemmCb.Run(GemmCbArgs(_M*_merge, _N, _K, tmp, _nhwcWeight.data, dst));
-                        else
-                            _nhwcRun(_M*_merge, _N, _K, tmp, _nhwcWeight.data, dst, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                        Parallel(0, _merge, [&](size_t thread, size_t begin, size_t end)
+                        {
+                            for (size_t m = begin; m < end; ++m)
+                                ImgToRow(src + m * _sizeS, buf + m * _sizeB);
+                        }, _threads);
                     }
+                    else if (_param.trans)
+                        ImgToRow(src, buf);
                     else
-                        _gemm.Run(GemmArgs(_M*_merge, _N, _K, &_1, tmp, _ldS, _weight, _ldW, &_0, dst, _ldD));
-                    for (size_t m = 0; m < _merge; ++m)
-                        _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst + m * _sizeD);
-                    src += _sizeS * _merge;
-                    dst += _sizeD * _merge;
+                        ImgToCol(src, buf);
+                    tmp = buf;
                 }
+                Parallel(0, _M * _merge, [&](size_t thread, size_t begin, size_t end)
+                {
+                    ForwardTile(tmp, begin, end, dst);
+                }, threads, p.trans ? 4 : 1);
+                src += _sizeS * _merge;
+                dst += _sizeD * _merge;
             }
-            else
+        }
+
+        void SynetConvolution32fGemmNN::ForwardTile(const float * src, size_t begin, size_t end, float * dst)
+        {
+            const ConvParam32f & p = _param;
+            size_t M = end - begin;
+            if (p.trans)
             {
-                for (size_t b = 0; b < _batch; ++b)
+                if (_nhwcWeight.data)
+                {
+                    if (_gemmCb.Size())
+                        _gemmCb.Run(GemmCbArgs(M, _N, _K, src + begin * _ldS, _nhwcWeight.data, dst + begin * _ldD));
+                    else
+                        _nhwcRun(M, _N, _K, src + begin * _ldS, _nhwcWeight.data, dst + begin * _ldD, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                }
+                else
                 {
-                    const float * tmp = src;
-                    if (!_skipConv)
-                    {
-                        if (_param.trans)
-                            ImgToRow(src, buf);
-                        else
-                            ImgToCol(src, buf);
-                        tmp = buf;
-                    }
                     for (size_t g = 0; g < p.group; ++g)
-                    {
-                        if (p.trans)
-                        {
-                            if (_nhwcWeight.data)
-                            {
-                                if (_gemmCb.Size())
-                                    _gemmCb.Run(GemmCbArgs(_M, _N, _K, tmp, _nhwcWeight.data, dst));
-                                else
-                                    _nhwcRun(_M, _N, _K, tmp, _nhwcWeight.data, dst, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
-                            }
-                            else
-                                _gemm.Run(GemmArgs(_M, _N, _K, &_1, tmp + _grS * g, _ldS, _weight + _grW * g, _ldW, &_0, dst + _grD * g, _ldD));
-                        }
-                        else
-                            _gemm.Run(GemmArgs(_M, _N, _K, &_1, _weight + _grW * g, _ldW, tmp + _grS * g, _ldS, &_0, dst + _grD * g, _ldD));
-                    }
-                    _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst);
-                    src += _sizeS;
-                    dst += _sizeD;
+                        _gemm.Run(GemmArgs(M, _N, _K, &_1, src + _grS * g + begin * _ldS, _ldS, _weight + _grW * g, _ldW, &_0, dst + _grD * g + begin * _ldD, _ldD));
+                }
+                _biasAndActivation(_bias, p.dstC, M, p.activation, _params, p.trans, dst + begin * _ldD);
+            }
+            else
+            {
+                for (size_t g = 0; g < p.group; ++g)
+                {
+                    size_t c = g * _M + begin;
+                    _gemm.Run(GemmArgs(M, _N, _K, &_1, _weight + _grW * g + begin * _ldW, _ldW, src + _grS * g, _ldS, &_0, dst + c * _ldD, _ldD));
+                    _biasAndActivation(_bias ? _bias + c : NULL, M, _N, p.activation, p.activation == ::SimdConvolutionActivationPrelu ? _params + c : _params, p.trans, dst + c * _ldD);
                 }
             }
         }
@@ -864,11 +862,15 @@ namespace Simd
             }
             else
             {
+                size_t threads = Tuned() ? _threads : 1;
                 for (size_t b = 0; b < _batch; ++b)
                 {
                     _setInput(src, p.srcC, p.srcH, p.srcW, p.padY, p.padX, p.padH, p.padW, bufS, _strideS, p.trans);
-                    for (size_t i = 0; i < _count; ++i)
-                        _gemm.Run(GemmArgs(_M, _N, _K, &_1, _winogradWeight.data + i * _strideW, _K, bufS + i * _strideS, _N, &_0, bufD + i * _strideD, _N));
+                    Parallel(0, _count, [&](size_t thread, size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                            _gemm.Run(GemmArgs(_M, _N, _K, &_1, _winogradWeight.data + i * _strideW, _K, bufS + i * _strideS, _N, &_0, bufD + i * _strideD, _N));
+                    }, threads);
                     _setOutput(bufD, _strideD, dst, p.dstC, p.dstH, p.dstW, p.trans);
                     _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst);
                     src += _sizeS;
@@ -969,27 +971,37 @@ namespace Simd
         void SynetConvolution32fWinograd::ForwardMerged(const float * src, float * bufS, float * bufD, float * dst)
         {
             const ConvParam32f & p = _param;
+            size_t threads = Tuned() ? _threads : 1;
             for (size_t b = 0; b < _batch; b += _merge)
             {
-                for (size_t m = 0; m < _merge; ++m)
-                    _setInput(src + m * _sizeS, p.srcC, p.srcH, p.srcW, p.padY, p.padX, p.padH, p.padW, bufS + m * _strideS, _strideS * _merge, p.trans);
-                for (size_t i = 0; i < _count; ++i)
+                Parallel(0, _merge, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t m = begin; m < end; ++m)
+                        _setInput(src + m * _sizeS, p.srcC, p.srcH, p.srcW, p.padY, p.padX, p.padH, p.padW, bufS + m * _strideS, _strideS * _merge, p.trans);
+                }, _threads);
+                Parallel(0, _count, [&](size_t thread, size_t begin, size_t end)
                 {
-                    if (_nhwcWeight.data)
+                    for (size_t i = begin; i < end; ++i)
                     {
-                        if (_gemmCb.Size())
-                            _gemmCb.Run(GemmCbArgs(_M * _merge, _N, _K, bufS + i * _strideS * _merge, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD * _merge));
+                        if (_nhwcWeight.data)
+                        {
+                            if (_gemmCb.Size())
+                                _gemmCb.Run(GemmCbArgs(_M * _merge, _N, _K, bufS + i * _strideS * _merge, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD * _merge));
+                            else
+                                _nhwcRun(_M * _merge, _N, _K, bufS + i * _strideS * _merge, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD * _merge, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                        }
                         else
-                            _nhwcRun(_M * _merge, _N, _K, bufS + i * _strideS * _merge, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD * _merge, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                            _gemm.Run(GemmArgs(_M * _merge, _N, _K, &_1, bufS + i * _strideS * _merge, _K, _winogradWeight.data + i * _strideW, _N, &_0, bufD + i * _strideD * _merge, _N));
                     }
-                    else
-                        _gemm.Run(GemmArgs(_M * _merge, _N, _K, &_1, bufS + i * _strideS * _merge, _K, _winogradWeight.data + i * _strideW, _N, &_0, bufD + i * _strideD * _merge, _N));
-                }
-                for (size_t m = 0; m < _merge; ++m)
+                }, threads);
+                Parallel(0, _merge, [&](size_t thread, size_t begin, size_t end)
                 {
-                    _setOutput(bufD + m * _strideD, _strideD * _merge, dst + m * _sizeD, p.dstC, p.dstH, p.dstW, p.trans);
-                    _biasAndActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, dst + m * _sizeD);
-                }
+                    for (size_t m = begin; m < end; ++m)
+                    {
+                        _setOutput(bufD + m * _strideD, _strideD * _merge, dst + m * _sizeD, p.dstC, p.dstH, p.dstW, p.trans);
+                        _biasAndActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, dst + m * _sizeD);
+                    }
+                }, _threads);
                 src += _sizeS * _merge;
                 dst += _sizeD * _merge;
             }
@@ -998,6 +1010,7 @@ namespace Simd
         void SynetConvolution32fWinograd::ForwardSplitted(const float* src, float* bufS, float* bufD, float* dst)
         {
             const ConvParam32f& p = _param;
+            size_t threads = Tuned() ? _threads : 1;
             for (size_t b = 0; b < _batch; ++b)
             {
                 for (size_t s = 0; s < _split; ++s)
@@ -1010,18 +1023,21 @@ namespace Simd
                     size_t dstY = s * _tileHs * _blockY;
                     size_t dstH = Simd::Min(_tileHs * _blockY, p.dstH - dstY);
                     _setInput(src + srcY * p.srcC * p.srcW, p.srcC, srcH, p.srcW, padY, p.padX, padH, p.padW, bufS, _strideS, p.trans);
-                    for (size_t i = 0; i < _count; ++i)
+                    Parallel(0, _count, [&](size_t thread, size_t begin, size_t end)
                     {
-                        if (_nhwcWeight.data)
+                        for (size_t i = begin; i < end; ++i)
                         {
-                            if (_gemmCb.Size())
-                                _gemmCb.Run(GemmCbArgs(M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD));
+                            if (_nhwcWeight.data)
+                            {
+                                if (_gemmCb.Size())
+                                    _gemmCb.Run(GemmCbArgs(M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD));
+                                else
+                                    _nhwcRun(M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                            }
                             else
-                                _nhwcRun(M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                                _gemm.Run(GemmArgs(M, _N, _K, &_1, bufS + i * _strideS, _K, _winogradWeight.data + i * _strideW, _N, &_0, bufD + i * _strideD, _N));
                         }
-                        else
-                            _gemm.Run(GemmArgs(M, _N, _K, &_1, bufS + i * _strideS, _K, _winogradWeight.data + i * _strideW, _N, &_0, bufD + i * _strideD, _N));
-                    }
+                    }, threads);
                     _setOutput(bufD, _strideD, dst + dstY * p.dstC * p.dstW, p.dstC, dstH, p.dstW, p.trans);
                     _biasAndActivation(_bias, p.dstC, dstH * p.dstW, p.activation, _params, p.trans, dst + dstY * p.dstC * p.dstW);
                 }
@@ -1525,39 +1541,76 @@ namespace Simd
         void SynetConvolution32fNhwcDirect::Forward(const float * src, float * buf, float * dst)
         {
             const ConvParam32f & p = _param;
-            for (size_t b = 0; b < p.batch; ++b)
+            if (_old.enable)
             {
-                if(_old.enable)
+                for (size_t b = 0; b < p.batch; ++b)
+                {
                     _old.convolution(src, _param, _old.alg, _weight, _bias, _params, dst);
-                else
-                _run.Run(RunArgs(src, _param, _weight, _bias, _params, dst));
-                src += _sizeS;
-                dst += _sizeD;
+                    src += _sizeS;
+                    dst += _sizeD;
+                }
             }
+            else
+                _run.Run(RunArgs(src, _param, _weight, _bias, _params, dst, _threads));
         }
 
-        void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst)
+        void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst, size_t threads)
         {
-            for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
+            if (threads > 1)
+            {
+                size_t sizeS = p.srcH * p.srcW * p.srcC, sizeD = p.dstH * p.dstW * p.dstC;
+                size_t countD = DivHi(p.dstC, a.macroD), macroH = a.macroH;
+                if (p.batch * countD * DivHi(p.dstH, macroH) < threads * 2)
+                    macroH = DivHi(p.dstH, DivHi(threads * 2, p.batch * countD));
+                size_t countH = DivHi(p.dstH, macroH), countT = p.batch * countD * countH;
+                Parallel(0, countT, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t t = begin; t < end; ++t)
+                    {
+                        size_t b = t / (countD * countH), dc = (t / countH) % countD * a.macroD, yBeg = t % countH * macroH;
+                        size_t macroD = Simd::Min(p.dstC, dc + a.macroD) - dc, yEnd = Simd::Min(yBeg + macroH, p.dstH);
+                        const float* ps = src + b * sizeS, * pw = weight + dc / a.F * a.stepW;
+                        const float* pp = p.activation == ::SimdConvolutionActivationPrelu ? params + dc : params;
+                        float* pd = dst + b * sizeD;
+                        for (size_t sc = 0; sc < p.srcC; sc += a.macroC)
+                        {
+                            size_t macroC = Simd::Min(p.srcC, sc + a.macroC) - sc;
+                            if (sc + macroC == p.srcC)
+                                a.convolutions[TermLast](ps + sc, p, a, macroD, yBeg, yEnd, macroC, pw, bias + dc, pp, pd + dc, macroC == p.srcC ? 1 : 0);
+                            else
+                                a.convolutions[TermInterim](ps + sc, p, a, macroD, yBeg, yEnd, macroC, pw, bias + dc, pp, pd + dc, sc == 0 ? 1 : 0);
+                            pw += a.F * macroC;
+                        }
+                    }
+                }, threads);
+                return;
+            }
+            for (size_t b = 0; b < p.batch; ++b)
             {
-                size_t macroD = Simd::Min(p.dstC, dc + a.macroD) - dc;
-                for (size_t sc = 0; sc < p.srcC; sc += a.macroC)
+                const float* pw = weight, * pp = params;
+                for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
                 {
-                    size_t macroC = Simd::Min(p.srcC, sc + a.macroC) - sc;
-                    for (size_t yBeg = 0; yBeg < p.dstH;)
+                    size_t macroD = Simd::Min(p.dstC, dc + a.macroD) - dc;
+                    for (size_t sc = 0; sc < p.srcC; sc += a.macroC)
                     {
-                        size_t yEnd = Simd::Min(yBeg + a.macroH, p.dstH);
-                        if (sc + macroC == p.srcC)
-                            a.convolutions[TermLast](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC ? 1 : 0);
-                        else
-                            a.convolutions[TermInterim](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, sc == 0 ? 1 : 0);
-                        yBeg = yEnd;
+                        size_t macroC = Simd::Min(p.srcC, sc + a.macroC) - sc;
+                        for (size_t yBeg = 0; yBeg < p.dstH;)
+                        {
+                            size_t yEnd = Simd::Min(yBeg + a.macroH, p.dstH);
+                            if (sc + macroC == p.srcC)
+                                a.convolutions[TermLast](src + sc, p, a, macroD, yBeg, yEnd, macroC, pw, bias + dc, pp, dst + dc, macroC == p.srcC ? 1 : 0);
+                            else
+                                a.convolutions[TermInterim](src + sc, p, a, macroD, yBeg, yEnd, macroC, pw, bias + dc, pp, dst + dc, sc == 0 ? 1 : 0);
+                            yBeg = yEnd;
+                        }
+                        pw += a.F * macroC;
                     }
-                    weight += a.F * macroC;
+                    if (p.activation == ::SimdConvolutionActivationPrelu)
+                        pp += macroD;
+                    pw += p.kernelY * p.kernelY * p.srcC * macroD - p.srcC * a.F;
                 }
-                if (p.activation == ::SimdConvolutionActivationPrelu)
-                    params += macroD;
-                weight += p.kernelY * p.kernelY * p.srcC * macroD - p.srcC * a.F;
+                src += p.srcH * p.srcW * p.srcC;
+                dst += p.dstH * p.dstW * p.dstC;
             }
         }
 
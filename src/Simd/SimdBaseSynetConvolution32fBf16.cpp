@@ -27,6 +27,7 @@
 #include "Simd/SimdBFloat16.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -287,15 +288,17 @@ namespace Simd
         {
             const ConvParam32f& p = _param;
             const AlgParam& a = _alg;
+            size_t size, threads = Simd::Min(_threads, p.batch / a.batch * Stripes());
             //if (p.dstC <= a.macroD)
             //    return Base::AlgCacheL2() / 4;
             //else
             {
                 if (a.mode)
-                    return a.batch * AlignHi(p.srcC, 2) * p.dstW * p.dstH * p.kernelY * p.kernelX / 2;
+                    size = a.batch * AlignHi(p.srcC, 2) * p.dstW * p.dstH * p.kernelY * p.kernelX / 2;
                 else
-                    return a.srcH * a.srcW * AlignHi(p.srcC, 2) / 2;
+                    size = a.srcH * a.srcW * AlignHi(p.srcC, 2) / 2;
             }
+            return threads > 1 ? AlignHi(size, SIMD_ALIGN) * threads : size;
         }
 
         size_t SynetConvolution32fBf16Nhwc::InternalBufferSize() const
@@ -422,15 +425,22 @@ namespace Simd
             const ConvParam32f& p = _param;
             const AlgParam& a = _alg;
             buf = Buffer(buf);
-            for (size_t b = 0; b < p.batch; b += a.batch)
+            size_t stripes = Stripes(), tasks = p.batch / a.batch * stripes, threads = Simd::Min(_threads, tasks);
+            size_t sizeS = p.srcH * p.srcW * p.srcC * a.batch, sizeD = p.dstH * p.dstW * p.dstC * a.batch;
+            size_t sizeB = threads > 1 ? ExternalBufferSize() / threads : 0, dstH = p.dstH * a.batch;
+            Parallel(0, tasks, [&](size_t thread, size_t begin, size_t end)
             {
-                if(a.mode)
-                    ForwardGemm(src, (uint16_t*)buf, dst);
-                else
-                    ForwardConv(src, (uint16_t*)buf, dst);
-                src += p.srcH * p.srcW * p.srcC * a.batch;
-                dst += p.dstH * p.dstW * p.dstC * a.batch;
-            }
+                uint16_t* pb = (uint16_t*)(buf + thread * sizeB);
+                for (size_t t = begin; t < end; ++t)
+                {
+                    size_t b = t / stripes, s = t % stripes;
+                    size_t yBeg = dstH * s / stripes, yEnd = dstH * (s + 1) / stripes;
+                    if (a.mode)
+                        ForwardGemm(src + b * sizeS, yBeg, yEnd, pb, dst + b * sizeD);
+                    else
+                        ForwardConv(src + b * sizeS, yBeg, yEnd, pb, dst + b * sizeD);
+                }
+            }, threads);
         }
 
         bool SynetConvolution32fBf16Nhwc::Preferable(const ConvParam32f& p)
@@ -438,7 +448,7 @@ namespace Simd
             return p.trans != 0 && p.group == 1;
         }
 
-        void SynetConvolution32fBf16Nhwc::ForwardConv(const float* src, uint16_t* buf, float* dst)
+        void SynetConvolution32fBf16Nhwc::ForwardConv(const float* src, size_t yBeg, size_t yEnd, uint16_t* buf, float* dst)
         {
             const ConvParam32f& p = _param;
             const AlgParam& a = _alg;
@@ -450,19 +460,19 @@ namespace Simd
                 for (size_t sc = 0; sc < p.srcC; sc += a.macroC)
                 {
                     size_t macroC = Simd::Min(p.srcC, sc + a.macroC) - sc;
-                    for (size_t yBeg = 0; yBeg < p.dstH;)
+                    for (size_t yb = yBeg; yb < yEnd;)
                     {
-                        size_t yEnd = Simd::Min(yBeg + a.macroH, p.dstH);
-                        size_t offs = Offset(yBeg, sc, sc + macroC);
+                        size_t ye = Simd::Min(yb + a.macroH, yEnd);
+                        size_t offs = Offset(yb, sc, sc + macroC);
                         if (dc == 0)
-                            _convert(src + sc, p, yBeg, yEnd, macroC, buf + offs);
+                            _convert(src + sc, p, yb, ye, macroC, buf + offs);
                         if (sc + macroC == p.srcC)
-                            _convolutions[TermLast](buf + offs, p, macroD, yEnd - yBeg, macroC, macroC == p.srcC ? 1 : 0, 
-                                weight, bias, params, dst + yBeg * p.dstW * p.dstC);
+                            _convolutions[TermLast](buf + offs, p, macroD, ye - yb, macroC, macroC == p.srcC ? 1 : 0, 
+                                weight, bias, params, dst + yb * p.dstW * p.dstC);
                         else
-                            _convolutions[TermInterim](buf + offs, p, macroD, yEnd - yBeg, macroC, sc == 0 ? 1 : 0,
-                                weight, bias, params, dst + yBeg * p.dstW * p.dstC);
-                        yBeg = yEnd;
+                            _convolutions[TermInterim](buf + offs, p, macroD, ye - yb, macroC, sc == 0 ? 1 : 0,
+                                weight, bias, params, dst + yb * p.dstW * p.dstC);
+                        yb = ye;
                     }
                     weight += p.kernelY * p.kernelY * AlignHi(macroC, 2) * AlignHiAny(macroD, a.microD);
                 }
@@ -473,13 +483,12 @@ namespace Simd
             }
         }
 
-        void SynetConvolution32fBf16Nhwc::ForwardGemm(const float* src, uint16_t* buf, float* dst)
+        void SynetConvolution32fBf16Nhwc::ForwardGemm(const float* src, size_t yBeg, size_t yEnd, uint16_t* buf, float* dst)
         {
             const ConvParam32f& p = _param;
             const AlgParam& a = _alg;
             const uint16_t* weight = _weight.data;
             const float* bias = _bias.data, * params = _params.data;
-            size_t dstH = p.dstH * a.batch;
             for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
             {
                 size_t macroD = Simd::Min(p.dstC, dc + a.macroD) - dc;
@@ -487,10 +496,10 @@ namespace Simd
                 {
                     size_t macroC = Simd::Min(p.srcC, sc + a.macroC) - sc;
                     size_t macroK = AlignHi(macroC, 2) * p.kernelY * p.kernelX;
-                    for (size_t yBeg = 0; yBeg < dstH;)
+                    for (size_t yb = yBeg; yb < yEnd;)
                     {
-                        size_t yEnd = Simd::Min(yBeg + a.macroH, dstH);
-                        size_t offs = Offset(yBeg, sc, sc + AlignHi(macroC, 2));
+                        size_t ye = Simd::Min(yb + a.macroH, yEnd);
+                        size_t offs = Offset(yb, sc, sc + AlignHi(macroC, 2));
                         if (dc == 0)
                         {
                             if (a.batch > 1)
@@ -501,15 +510,15 @@ namespace Simd
                                     _convert(src + sc + b * dS, p, 0, p.dstH, macroC, buf + offs + b * dB);
                             }
                             else
-                                _convert(src + sc, p, yBeg, yEnd, macroC, buf + offs);
+                                _convert(src + sc, p, yb, ye, macroC, buf + offs);
                         }
                         if (sc + macroC == p.srcC)
-                            _convolutions[TermLast](buf + offs, p, macroD, yEnd - yBeg, macroK, macroC == p.srcC ? 1 : 0,
-                                weight, bias, params, dst + yBeg * p.dstW * p.dstC);
+                            _convolutions[TermLast](buf + offs, p, macroD, ye - yb, macroK, macroC == p.srcC ? 1 : 0,
+                                weight, bias, params, dst + yb * p.dstW * p.dstC);
                         else
-                            _convolutions[TermInterim](buf + offs, p, macroD, yEnd - yBeg, macroK, sc == 0 ? 1 : 0,
-                                weight, bias, params, dst + yBeg * p.dstW * p.dstC);
-                        yBeg = yEnd;
+                            _convolutions[TermInterim](buf + offs, p, macroD, ye - yb, macroK, sc == 0 ? 1 : 0,
+                                weight, bias, params, dst + yb * p.dstW * p.dstC);
+                        yb = ye;
                     }
                     weight += AlignHi(macroC, 2) * p.kernelY * p.kernelX * AlignHiAny(macroD, a.microD);
                 }
@@ -520,6 +529,15 @@ namespace Simd
             }
         }
 
+        size_t SynetConvolution32fBf16Nhwc::Stripes() const
+        {
+            const ConvParam32f& p = _param;
+            const AlgParam& a = _alg;
+            if (a.batch > 1 || p.batch >= _threads)
+                return 1;
+            return Simd::Min(DivHi(_threads, p.batch), p.dstH);
+        }
+
         size_t SynetConvolution32fBf16Nhwc::Offset(size_t yBeg, size_t cBeg, size_t cEnd)
         {
             const ConvParam32f& p = _param;
@@ -0,0 +1,290 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetInputResizer.h"
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdBFloat16.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        template<size_t C> SIMD_INLINE void InputResizerBgr(int b, int g, int r, int* dst)
+        {
+            if (C == 1)
+                dst[0] = BgrToGray(b, g, r);
+            else
+                dst[0] = b, dst[1] = g, dst[2] = r;
+        }
+
+        struct InputResizerGray8
+        {
+            template<size_t C> static SIMD_INLINE void Get(const uint8_t* const* src, size_t x, int* dst)
+            {
+                for (size_t c = 0; c < C; ++c)
+                    dst[c] = src[0][x];
+            }
+        };
+
+        template<size_t step> struct InputResizerBgr24
+        {
+            template<size_t C> static SIMD_INLINE void Get(const uint8_t* const* src, size_t x, int* dst)
+            {
+                const uint8_t* ps = src[0] + x * step;
+                InputResizerBgr<C>(ps[0], ps[1], ps[2], dst);
+            }
+        };
+
+        template<size_t step> struct InputResizerRgb24
+        {
+            template<size_t C> static SIMD_INLINE void Get(const uint8_t* const* src, size_t x, int* dst)
+            {
+                const uint8_t* ps = src[0] + x * step;
+                InputResizerBgr<C>(ps[2], ps[1], ps[0], dst);
+            }
+        };
+
+        template<class T> struct InputResizerNv12
+        {
+            template<size_t C> static SIMD_INLINE void Get(const uint8_t* const* src, size_t x, int* dst)
+            {
+                int y = src[0][x], u = src[1][x & ~size_t(1)], v = src[1][x | 1];
+                InputResizerBgr<C>(YuvToBlue<T>(y, u), YuvToGreen<T>(y, u, v), YuvToRed<T>(y, v), dst);
+            }
+        };
+
+        template<class T> struct InputResizerYuv420p
+        {
+            template<size_t C> static SIMD_INLINE void Get(const uint8_t* const* src, size_t x, int* dst)
+            {
+                int y = src[0][x], u = src[1][x >> 1], v = src[2][x >> 1];
+                InputResizerBgr<C>(YuvToBlue<T>(y, u), YuvToGreen<T>(y, u, v), YuvToRed<T>(y, v), dst);
+            }
+        };
+
+        template<class P, size_t C, bool nchw> void InputResizerHorz(const uint8_t* const* src, const int32_t* ix, const float* ax,
+            size_t width, const float* scale, const float* shift, float* dst)
+        {
+            int p0[C], p1[C];
+            for (size_t x = 0; x < width; ++x, ix += 2, ax += 2)
+            {
+                P::template Get<C>(src, ix[0], p0);
+                P::template Get<C>(src, ix[1], p1);
+                for (size_t c = 0; c < C; ++c)
+                {
+                    float value = (float(p0[c]) * ax[0] + float(p1[c]) * ax[1]) * scale[c] + shift[c];
+                    if (nchw)
+                        dst[c * width + x] = value;
+                    else
+                        dst[x * C + c] = value;
+                }
+            }
+        }
+
+        template<class P, size_t C> SynetInputResizer::HorzPtr GetInputResizerHorz(SimdTensorFormatType format)
+        {
+            return format == SimdTensorFormatNchw ? InputResizerHorz<P, C, true> : InputResizerHorz<P, C, false>;
+        }
+
+        template<class P> SynetInputResizer::HorzPtr GetInputResizerHorz(const InputResizerParam& p)
+        {
+            return p.channels == 1 ? InputResizerHorz<P, 1, false> : GetInputResizerHorz<P, 3>(p.dstFormat);
+        }
+
+        template<class T> SynetInputResizer::HorzPtr GetInputResizerHorzYuv(const InputResizerParam& p)
+        {
+            switch (p.yuvLayout)
+            {
+            case SimdYuvLayoutNv12: return GetInputResizerHorz<InputResizerNv12<T>>(p);
+            case SimdYuvLayoutYuv420p: return GetInputResizerHorz<InputResizerYuv420p<T>>(p);
+            default:
+                assert(0); return NULL;
+            }
+        }
+
+        static SynetInputResizer::HorzPtr GetInputResizerHorz(const InputResizerParam& p)
+        {
+            if (p.IsYuv())
+            {
+                if (p.yuvLayout == SimdYuvLayoutGray8)
+                    return GetInputResizerHorz<InputResizerGray8>(p);
+                switch (p.yuvType)
+                {
+                case SimdYuvBt601: return GetInputResizerHorzYuv<Bt601>(p);
+                case SimdYuvBt709: return GetInputResizerHorzYuv<Bt709>(p);
+                case SimdYuvBt2020: return GetInputResizerHorzYuv<Bt2020>(p);
+                case SimdYuvTrect871: return GetInputResizerHorzYuv<Trect871>(p);
+                default:
+                    assert(0); return NULL;
+                }
+            }
+            switch (p.srcFormat)
+            {
+            case SimdPixelFormatGray8: return GetInputResizerHorz<InputResizerGray8>(p);
+            case SimdPixelFormatBgr24: return GetInputResizerHorz<InputResizerBgr24<3>>(p);
+            case SimdPixelFormatBgra32: return GetInputResizerHorz<InputResizerBgr24<4>>(p);
+            case SimdPixelFormatRgb24: return GetInputResizerHorz<InputResizerRgb24<3>>(p);
+            case SimdPixelFormatRgba32: return GetInputResizerHorz<InputResizerRgb24<4>>(p);
+            default:
+                assert(0); return NULL;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdTensorDataType type> void InputResizerVert(const float* src0, const float* src1, float alpha, size_t size, uint8_t* dst);
+
+        template<> void InputResizerVert<SimdTensorData32f>(const float* src0, const float* src1, float alpha, size_t size, uint8_t* dst)
+        {
+            float* pd = (float*)dst;
+            for (size_t i = 0; i < size; ++i)
+                pd[i] = src0[i] + (src1[i] - src0[i]) * alpha;
+        }
+
+        template<> void InputResizerVert<SimdTensorData16b>(const float* src0, const float* src1, float alpha, size_t size, uint8_t* dst)
+        {
+            uint16_t* pd = (uint16_t*)dst;
+            for (size_t i = 0; i < size; ++i)
+                pd[i] = Float32ToBFloat16(src0[i] + (src1[i] - src0[i]) * alpha);
+        }
+
+        template<> void InputResizerVert<SimdTensorData8u>(const float* src0, const float* src1, float alpha, size_t size, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = (uint8_t)RestrictRange(Round(src0[i] + (src1[i] - src0[i]) * alpha), 0, 255);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void InputResizerIndexAlpha(size_t cropBeg, size_t cropSize, size_t dstSize, Array32i& index, Array32f& alpha, size_t alphaStep)
+        {
+            index.Resize(dstSize * 2);
+            alpha.Resize(dstSize * alphaStep);
+            float scale = float(cropSize) / float(dstSize);
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                float pos = (float(i) + 0.5f) * scale - 0.5f;
+                ptrdiff_t idx = (ptrdiff_t)::floor(pos);
+                float a = pos - float(idx);
+                if (idx < 0)
+                    idx = 0, a = 0.0f;
+                if (idx >= (ptrdiff_t)cropSize - 1)
+                    idx = cropSize - 1, a = 0.0f;
+                index[2 * i + 0] = int32_t(cropBeg + idx);
+                index[2 * i + 1] = int32_t(cropBeg + Simd::Min(size_t(idx + 1), cropSize - 1));
+                if (alphaStep == 2)
+                {
+                    alpha[2 * i + 0] = 1.0f - a;
+                    alpha[2 * i + 1] = a;
+                }
+                else
+                    alpha[i] = a;
+            }
+        }
+
+        SynetInputResizer::SynetInputResizer(const InputResizerParam& param)
+            : _param(param)
+        {
+            InputResizerIndexAlpha(_param.cropX, _param.cropW, _param.dstW, _ix, _ax, 2);
+            InputResizerIndexAlpha(_param.cropY, _param.cropH, _param.dstH, _iy, _ay, 1);
+            for (size_t c = 0; c < 3; ++c)
+                _shift[c] = -_param.mean[c] * _param.scale[c];
+            _rowSize = _param.dstW * _param.channels;
+            _rows.Resize(_rowSize * 2);
+            _horz = GetInputResizerHorz(_param);
+            switch (_param.dstType)
+            {
+            case SimdTensorData32f: _vert = InputResizerVert<SimdTensorData32f>; break;
+            case SimdTensorData16b: _vert = InputResizerVert<SimdTensorData16b>; break;
+            case SimdTensorData8u: _vert = InputResizerVert<SimdTensorData8u>; break;
+            default:
+                assert(0);
+            }
+        }
+
+        void SynetInputResizer::MakeRow(const uint8_t* const* src, const size_t* srcStride, size_t y, float* dst)
+        {
+            const uint8_t* rows[3] = { src[0] + y * srcStride[0], NULL, NULL };
+            if (_param.IsYuv())
+            {
+                if (_param.yuvLayout != SimdYuvLayoutGray8)
+                    rows[1] = src[1] + (y >> 1) * srcStride[1];
+                if (_param.yuvLayout == SimdYuvLayoutYuv420p)
+                    rows[2] = src[2] + (y >> 1) * srcStride[2];
+            }
+            _horz(rows, _ix.data, _ax.data, _param.dstW, _param.scale, _shift, dst);
+        }
+
+        void SynetInputResizer::Run(const uint8_t* const* src, const size_t* srcStride, uint8_t* dst)
+        {
+            const InputResizerParam& p = _param;
+            size_t elem = p.ElemSize(), plane = p.dstW * p.dstH * elem;
+            float* rows[2] = { _rows.data, _rows.data + _rowSize };
+            ptrdiff_t ys[2] = { -1, -1 };
+            for (size_t dy = 0; dy < p.dstH; ++dy)
+            {
+                ptrdiff_t y0 = _iy[2 * dy + 0], y1 = _iy[2 * dy + 1];
+                if (ys[0] != y0)
+                {
+                    if (ys[1] == y0)
+                    {
+                        Swap(rows[0], rows[1]);
+                        Swap(ys[0], ys[1]);
+                    }
+                    else
+                    {
+                        MakeRow(src, srcStride, y0, rows[0]);
+                        ys[0] = y0;
+                    }
+                }
+                if (ys[1] != y1)
+                {
+                    MakeRow(src, srcStride, y1, rows[1]);
+                    ys[1] = y1;
+                }
+                if (p.dstFormat == SimdTensorFormatNchw)
+                {
+                    for (size_t c = 0; c < p.channels; ++c)
+                        _vert(rows[0] + c * p.dstW, rows[1] + c * p.dstW, _ay[dy], p.dstW, dst + c * plane + dy * p.dstW * elem);
+                }
+                else
+                    _vert(rows[0], rows[1], _ay[dy], _rowSize, dst + dy * _rowSize * elem);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetInputResizerInit(SimdPixelFormatType srcFormat, SimdYuvLayoutType yuvLayout, SimdYuvType yuvType,
+            size_t cropX, size_t cropY, size_t cropWidth, size_t cropHeight, size_t dstWidth, size_t dstHeight, size_t channels,
+            const float* mean, const float* scale, SimdTensorDataType dstType, SimdTensorFormatType dstFormat)
+        {
+            InputResizerParam param(srcFormat, yuvLayout, yuvType, cropX, cropY, cropWidth, cropHeight, dstWidth, dstHeight, channels, mean, scale, dstType, dstFormat);
+            if (!param.Valid())
+                return NULL;
+            return new SynetInputResizer(param);
+        }
+    }
+#endif
+}
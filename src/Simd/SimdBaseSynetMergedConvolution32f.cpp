@@ -27,6 +27,7 @@
 #include "Simd/SimdUpdate.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -115,11 +116,14 @@ namespace Simd
 
         SynetMergedConvolution32f::SynetMergedConvolution32f(const MergConvParam32f& p)
            : Simd::SynetMergedConvolution32f(p)
+           , _threads(Base::GetThreadNumber())
+           , _context(Base::ThreadContextCurrent())
         {
             for (size_t i = 0; i < 4; ++i)
                 _convolution[i] = NULL;
             const SimdConvolutionParameters& beg = p.conv[0];
             const SimdConvolutionParameters& end = p.conv[p.count - 1];
+            _yStripe = end.dstH;
             _sizeS = beg.srcH * beg.srcW * beg.srcC;
             _sizeD = end.dstH * end.dstW * end.dstC;
             _sizeB[0] = p.conv[1].srcH * p.conv[1].srcW * p.conv[1].srcC;
@@ -146,7 +150,7 @@ namespace Simd
 
         size_t SynetMergedConvolution32f::ExternalBufferSize() const
         {
-            return _sizeB[0] + _sizeB[1];
+            return (_sizeB[0] + _sizeB[1]) * Threads();
         }
 
         size_t SynetMergedConvolution32f::InternalBufferSize() const
@@ -244,7 +248,27 @@ namespace Simd
 
         void SynetMergedConvolution32f::Forward(const float* src, float* buf, float* dst)
         {
+            ThreadContextScope scope(_context);
             const MergConvParam32f& p = _param;
+            if (_rWeight[0].data)
+            {
+                const ConvParam32f& last = p.conv[p.count - 1];
+                float* buffer = Buffer(buf);
+                size_t threads = Threads(), batch = last.batch, size = _sizeB[0] + _sizeB[1];
+                size_t stripes = DivHi(last.dstH, _yStripe), bands = Simd::Min(stripes, DivHi(threads, batch));
+                Parallel(0, batch * bands, [&](size_t thread, size_t begin, size_t end)
+                {
+                    float* buf0 = buffer + thread * size;
+                    for (size_t t = begin; t < end; ++t)
+                    {
+                        size_t b = t / bands, band = t % bands;
+                        size_t yBeg = stripes * band / bands * _yStripe;
+                        size_t yEnd = Simd::Min(stripes * (band + 1) / bands * _yStripe, last.dstH);
+                        ForwardRows(src + b * _sizeS, buf0, buf0 + _sizeB[0], yBeg, yEnd, dst + b * _sizeD);
+                    }
+                }, threads);
+                return;
+            }
             float* buf0 = Buffer(buf);
             float* buf1 = buf0 + _sizeB[0];
             for (size_t b = 0; b < p.conv[0].batch; ++b)
@@ -262,6 +286,14 @@ namespace Simd
             }
         }
 
+        size_t SynetMergedConvolution32f::Threads() const
+        {
+            if (_rWeight[0].data == NULL)
+                return 1;
+            const ConvParam32f& last = _param.conv[_param.count - 1];
+            return Simd::Max<size_t>(Simd::Min(_threads, last.batch * DivHi(last.dstH, _yStripe)), 1);
+        }
+
         //---------------------------------------------------------------------
 
         SynetMergedConvolution32fCdc::SynetMergedConvolution32fCdc(const MergConvParam32f & p)
@@ -289,6 +321,7 @@ namespace Simd
                 if ((_sizeB[0] + _sizeB[1]) * sizeof(float) <= L2)
                     break;
             }
+            _yStripe = _yStep[1];
             for (size_t i = 0; i < 3; ++i)
             {
                 size_t dstC = AlignHiAny(p.conv[i].dstC, i == 1 ? _miC : 2 * _miC);
@@ -368,42 +401,31 @@ namespace Simd
             }
         }
 
-        void SynetMergedConvolution32fCdc::Forward(const float * src, float * buf, float * dst)
+        void SynetMergedConvolution32fCdc::ForwardRows(const float * src, float * buf0, float * buf1, size_t yBeg, size_t yEnd, float * dst)
         {
-            if (_rWeight[0].data == NULL)
-            {
-                SynetMergedConvolution32f::Forward(src, buf, dst);
-                return;
-            }
             const MergConvParam32f & p = _param;
-            float * buf0 = Buffer(buf);
-            float * buf1 = buf0 + _sizeB[0];
-            for (size_t b = 0; b < p.conv[0].batch; ++b)
+            const SimdConvolutionParameters & c1 = p.conv[1];
+            for (size_t c = 0, C = c1.dstC; c < C; c += _maC)
             {
-                for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
+                size_t maC = Simd::Min(C, c + _maC) - c;
+                for (size_t yBeg1 = yBeg, yBeg0 = yBeg * c1.strideY > c1.padY ? yBeg * c1.strideY - c1.padY : 0; yBeg1 < yEnd;)
                 {
-                    size_t maC = Simd::Min(C, c + _maC) - c;
-                    for (size_t yBeg1 = 0, yBeg0 = 0; yBeg1 < p.conv[1].dstH;)
+                    size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], yEnd);
+                    size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (yEnd1 - 1)*c1.strideY + c1.kernelY - c1.padY), p.conv[0].dstH);
+                    _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
+                    _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], buf1, 1);
+                    if (p.add && c == 0)
                     {
-                        size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], p.conv[1].dstH);
-                        size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (_yStep[1] - 1)*p.conv[1].strideY + p.conv[1].kernelY - p.conv[1].padY), p.conv[0].dstH);
-                        _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
-                        _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], buf1, 1);
-                        if (p.add && c == 0)
-                        {
-                            size_t offset = yBeg1 * p.conv[2].dstW * p.conv[2].dstC, size = (yEnd1 - yBeg1)*p.conv[2].dstW * p.conv[2].dstC;
-                            memcpy(dst + offset, src + offset, sizeof(float)*size);
-                        }
-                        if(c + maC == C)
-                            _convolution[2](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst, (maC != C || p.add) ? 0 : 1);
-                        else
-                            _convolution[3](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst, (c != 0 || p.add) ? 0 : 1);
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
+                        size_t offset = yBeg1 * p.conv[2].dstW * p.conv[2].dstC, size = (yEnd1 - yBeg1)*p.conv[2].dstW * p.conv[2].dstC;
+                        memcpy(dst + offset, src + offset, sizeof(float)*size);
                     }
+                    if(c + maC == C)
+                        _convolution[2](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst, (maC != C || p.add) ? 0 : 1);
+                    else
+                        _convolution[3](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst, (c != 0 || p.add) ? 0 : 1);
+                    yBeg1 = yEnd1;
+                    yBeg0 = yEnd0;
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
@@ -437,6 +459,7 @@ namespace Simd
                 if (_sizeB[0] * sizeof(float) <= L2)
                     break;
             }
+            _yStripe = _yStep[1];
             _sizeB[1] = 0;
             for (size_t i = 0; i < 2; ++i)
             {
@@ -492,32 +515,22 @@ namespace Simd
             }
         }
 
-        void SynetMergedConvolution32fCd::Forward(const float* src, float* buf, float* dst)
+        void SynetMergedConvolution32fCd::ForwardRows(const float* src, float* buf0, float* buf1, size_t yBeg, size_t yEnd, float* dst)
         {
-            if (_rWeight[0].data == NULL)
-            {
-                SynetMergedConvolution32f::Forward(src, buf, dst);
-                return;
-            }
             const MergConvParam32f& p = _param;
-            float* buf0 = Buffer(buf);
-            for (size_t b = 0; b < p.conv[0].batch; ++b)
+            const SimdConvolutionParameters& c1 = p.conv[1];
+            for (size_t c = 0, C = c1.dstC; c < C; c += _maC)
             {
-                for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
+                size_t maC = Simd::Min(C, c + _maC) - c;
+                for (size_t yBeg1 = yBeg, yBeg0 = yBeg * c1.strideY > c1.padY ? yBeg * c1.strideY - c1.padY : 0; yBeg1 < yEnd;)
                 {
-                    size_t maC = Simd::Min(C, c + _maC) - c;
-                    for (size_t yBeg1 = 0, yBeg0 = 0; yBeg1 < p.conv[1].dstH;)
-                    {
-                        size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], p.conv[1].dstH);
-                        size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (_yStep[1] - 1) * p.conv[1].strideY + p.conv[1].kernelY - p.conv[1].padY), p.conv[0].dstH);
-                        _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
-                        _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], dst + c, 1);
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
-                    }
+                    size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], yEnd);
+                    size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (yEnd1 - 1) * c1.strideY + c1.kernelY - c1.padY), p.conv[0].dstH);
+                    _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
+                    _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], dst + c, 1);
+                    yBeg1 = yEnd1;
+                    yBeg0 = yEnd0;
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
@@ -550,6 +563,7 @@ namespace Simd
                 if (_sizeB[0]* sizeof(float) <= L2)
                     break;
             }
+            _yStripe = _yStep[0];
             _bufH[1] = _bufH[0];
             _sizeB[1] = 0;
             for (size_t i = 0; i < 2; ++i)
@@ -610,33 +624,22 @@ namespace Simd
             }
         }
 
-        void SynetMergedConvolution32fDc::Forward(const float* src, float* buf, float* dst)
+        void SynetMergedConvolution32fDc::ForwardRows(const float* src, float* buf0, float* buf1, size_t yBeg, size_t yEnd, float* dst)
         {
-            if (_rWeight[0].data == NULL)
-            {
-                SynetMergedConvolution32f::Forward(src, buf, dst);
-                return;
-            }
             const MergConvParam32f& p = _param;
-            float* buf0 = Buffer(buf);
-            for (size_t b = 0; b < p.conv[0].batch; ++b)
+            for (size_t c = 0, C = p.conv[0].dstC; c < C; c += _maC)
             {
-                for (size_t c = 0, C = p.conv[0].dstC; c < C; c += _maC)
+                size_t maC = Simd::Min(C, c + _maC) - c;
+                for (size_t yBeg0 = yBeg; yBeg0 < yEnd;)
                 {
-                    size_t maC = Simd::Min(C, c + _maC) - c;
-                    for (size_t yBeg0 = 0; yBeg0 < p.conv[0].dstH;)
-                    {
-                        size_t yEnd0 = Simd::Min(yBeg0 + _yStep[0], p.conv[0].dstH);
-                        _convolution[0](src + c, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
-                        if (c + maC == C)
-                            _convolution[1](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], dst, maC == C ? 1 : 0);
-                        else
-                            _convolution[2](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], dst, c == 0 ? 1 : 0);
-                        yBeg0 = yEnd0;
-                    }
+                    size_t yEnd0 = Simd::Min(yBeg0 + _yStep[0], yEnd);
+                    _convolution[0](src + c, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
+                    if (c + maC == C)
+                        _convolution[1](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], dst, maC == C ? 1 : 0);
+                    else
+                        _convolution[2](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], dst, c == 0 ? 1 : 0);
+                    yBeg0 = yEnd0;
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
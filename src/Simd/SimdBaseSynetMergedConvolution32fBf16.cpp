@@ -29,6 +29,7 @@
 #include "Simd/SimdBFloat16.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -173,6 +174,8 @@ namespace Simd
 
         SynetMergedConvolution32fBf16::SynetMergedConvolution32fBf16(const MergConvParam32f& p)
            : Simd::SynetMergedConvolution32f(p)
+           , _threads(Base::GetThreadNumber())
+           , _context(Base::ThreadContextCurrent())
         {
             memset(&_alg, 0, sizeof(_alg));
             _convert = NULL, _input = NULL, _depthwise = NULL, _output[0] = NULL, _output[1] = NULL;
@@ -207,10 +210,8 @@ namespace Simd
 
         size_t SynetMergedConvolution32fBf16::ExternalBufferSize() const
         {
-            if (_alg.miC)
-                return _sizeB[1] + (_sizeB[0] + _sizeB[2]) / 2 + (SIMD_ALIGN * 2 / 4);
-            else
-                return _sizeB[1] + _sizeB[0];
+            size_t size = _alg.miC ? _sizeB[1] + (_sizeB[0] + _sizeB[2]) / 2 + (SIMD_ALIGN * 2 / 4) : _sizeB[1] + _sizeB[0];
+            return AlignHi(size, SIMD_ALIGN) * Threads();
         }
 
         size_t SynetMergedConvolution32fBf16::InternalBufferSize() const
@@ -410,7 +411,38 @@ namespace Simd
 
         void SynetMergedConvolution32fBf16::Forward(const float* src, float* buf, float* dst)
         {
-            uint8_t* buffer = (uint8_t*)Buffer(buf);
+            ThreadContextScope scope(_context);
+            const ConvParam32f& last = _param.conv[_param.count - 1];
+            float* buffer = Buffer(buf);
+            size_t threads = Threads(), size = ExternalBufferSize() / threads, bands = Bands();
+            size_t stripe = _alg.miC ? _alg.yStep[2] : last.dstH, stripes = DivHi(last.dstH, stripe);
+            Parallel(0, last.batch * bands, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t t = begin; t < end; ++t)
+                {
+                    size_t b = t / bands, band = t % bands;
+                    size_t yBeg = stripes * band / bands * stripe;
+                    size_t yEnd = Simd::Min(stripes * (band + 1) / bands * stripe, last.dstH);
+                    ForwardRows(src + b * _sizeS, buffer + thread * size, yBeg, yEnd, dst + b * _sizeD);
+                }
+            }, threads);
+        }
+
+        size_t SynetMergedConvolution32fBf16::Bands() const
+        {
+            const ConvParam32f& last = _param.conv[_param.count - 1];
+            size_t stripes = _alg.miC ? DivHi(last.dstH, _alg.yStep[2]) : 1;
+            return Simd::Max<size_t>(Simd::Min(stripes, DivHi(_threads, last.batch)), 1);
+        }
+
+        size_t SynetMergedConvolution32fBf16::Threads() const
+        {
+            return Simd::Max<size_t>(Simd::Min(_threads, _param.conv[0].batch * Bands()), 1);
+        }
+
+        void SynetMergedConvolution32fBf16::ForwardRows(const float* src, float* buf, size_t yBeg, size_t yEnd, float* dst)
+        {
+            uint8_t* buffer = (uint8_t*)buf;
             float* buf0 = Allocate<float>(buffer, _sizeB[0]);
             float* buf1 = Allocate<float>(buffer, _sizeB[1]);
             const MergConvParam32f& p = _param;
@@ -418,28 +450,24 @@ namespace Simd
             const ConvParam32f& c1 = p.conv[1];
             const ConvParam32f& c2 = p.conv[2];
             const AlgParam& a = _alg;
-            for (size_t b = 0; b < c0.batch; ++b)
+            assert(yBeg == 0 && yEnd == p.conv[p.count - 1].dstH);
+            if (_dw0)
             {
-                if (_dw0)
+                _depthwise(src, c0, a, 0, 0, c0.dstH, _weightD.data, _bias[0].data, _params[0].data, (uint16_t*)buf0);
+                _output[0]((uint16_t*)buf0, c1, a, 0, 0, c1.dstH, _weightO.data, _bias[1].data, _params[1].data, dst, 0);
+            }
+            else
+            {
+                _input((uint16_t*)src, c0, a, 0, 0, c0.dstH, _weightI.data, _bias[0].data, _params[0].data, buf0);
+                if (p.count > 2)
                 {
-                    _depthwise(src, c0, a, 0, 0, c0.dstH, _weightD.data, _bias[0].data, _params[0].data, (uint16_t*)buf0);
-                    _output[0]((uint16_t*)buf0, c1, a, 0, 0, c1.dstH, _weightO.data, _bias[1].data, _params[1].data, dst, 0);
+                    _depthwise(buf0, c1, a, 0, 0, c1.dstH, _weightD.data, _bias[1].data, _params[1].data, (uint16_t*)buf1);
+                    if (p.add)
+                        memcpy(dst, src, sizeof(float) * _sizeS);
+                    _output[0]((uint16_t*)buf1, c2, a, 0, 0, c2.dstH, _weightO.data, _bias[2].data, _params[2].data, dst, 0);
                 }
                 else
-                {
-                    _input((uint16_t*)src, c0, a, 0, 0, c0.dstH, _weightI.data, _bias[0].data, _params[0].data, buf0);
-                    if (p.count > 2)
-                    {
-                        _depthwise(buf0, c1, a, 0, 0, c1.dstH, _weightD.data, _bias[1].data, _params[1].data, (uint16_t*)buf1);
-                        if (p.add)
-                            memcpy(dst, src, sizeof(float) * _sizeS);
-                        _output[0]((uint16_t*)buf1, c2, a, 0, 0, c2.dstH, _weightO.data, _bias[2].data, _params[2].data, dst, 0);
-                    }
-                    else
-                        _depthwise(buf0, c1, a, 0, 0, c1.dstH, _weightD.data, _bias[1].data, _params[1].data, (uint16_t*)dst);
-                }
-                src += _sizeS;
-                dst += _sizeD;
+                    _depthwise(buf0, c1, a, 0, 0, c1.dstH, _weightD.data, _bias[1].data, _params[1].data, (uint16_t*)dst);
             }
         };
 
@@ -450,7 +478,7 @@ namespace Simd
         {
         }
 
-        void SynetMergedConvolution32fBf16Cdc::Forward(const float* src, float* buf, float* dst)
+        void SynetMergedConvolution32fBf16Cdc::ForwardRows(const float* src, float* buf, size_t yBeg, size_t yEnd, float* dst)
         {
             const MergConvParam32f& p = _param;
             const ConvParam32f& c0 = p.conv[0];
@@ -458,46 +486,41 @@ namespace Simd
             const ConvParam32f& c2 = p.conv[2];
             const AlgParam& a = _alg;
 
-            uint8_t* buffer = (uint8_t*)Buffer(buf);
+            uint8_t* buffer = (uint8_t*)buf;
             uint16_t* buf0 = Allocate<uint16_t>(buffer, _sizeB[0]);
             SetGap(buffer);
             float* buf1 = Allocate<float>(buffer, _sizeB[1]);
             uint16_t* buf2 = Allocate<uint16_t>(buffer, _sizeB[2]);
             SetGap(buffer);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
             {
-                for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
+                size_t maC = Simd::Min(C, c + a.maC) - c;
+                for (size_t yBeg2 = yBeg, yBeg1 = SrcBegY(c1, yBeg2), yBeg0 = SrcBegY(c0, yBeg1); yBeg2 < yEnd;)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                    size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], yEnd);
+                    size_t yEnd1 = Simd::RestrictRange(Simd::Max(yBeg1 + a.yStep[1], SrcEndY(c1, yEnd2)), a.yStart[1], c1.srcH);
+                    size_t yEnd0 = Simd::RestrictRange(Simd::Max(yBeg0 + a.yStep[0], SrcEndY(c0, yEnd1)), a.yStart[0], c0.srcH);
+                    _convert(src, c0, yBeg0, yEnd0, buf0, a.bufH[0]);
+                    _input(buf0, c0, a, maC, yBeg1, yEnd1, _weightI.data + c * a.dw[0], 
+                        _bias[0].data + c, _params[0].data + c * a.dp[0], buf1);
+                    _depthwise(buf1, c1, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[1], 
+                        _bias[1].data + c, _params[1].data + c * a.dp[1], buf2);
+                    if (p.add && c == 0)
                     {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        _convert(src, c0, yBeg0, yEnd0, buf0, a.bufH[0]);
-                        _input(buf0, c0, a, maC, yBeg1, yEnd1, _weightI.data + c * a.dw[0], 
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf1);
-                        _depthwise(buf1, c1, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[1], 
-                            _bias[1].data + c, _params[1].data + c * a.dp[1], buf2);
-                        if (p.add && c == 0)
-                        {
-                            size_t offset = yBeg1 * p.conv[2].dstW * p.conv[2].dstC, size = (yEnd1 - yBeg1) * p.conv[2].dstW * p.conv[2].dstC;
-                            memcpy(dst + offset, src + offset, sizeof(float) * size);
-                        }
-                        if (c + maC == C)
-                            _output[0](buf2, c2, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[2], 
-                                _bias[2].data, _params[2].data, dst, (maC != C || p.add) ? 0 : 1);
-                        else
-                            _output[1](buf2, c2, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[2], 
-                                _bias[2].data, _params[2].data, dst, (c != 0 || p.add) ? 0 : 1);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
+                        size_t offset = yBeg2 * c2.dstW * c2.dstC, size = (yEnd2 - yBeg2) * c2.dstW * c2.dstC;
+                        memcpy(dst + offset, src + offset, sizeof(float) * size);
                     }
+                    if (c + maC == C)
+                        _output[0](buf2, c2, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[2], 
+                            _bias[2].data, _params[2].data, dst, (maC != C || p.add) ? 0 : 1);
+                    else
+                        _output[1](buf2, c2, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[2], 
+                            _bias[2].data, _params[2].data, dst, (c != 0 || p.add) ? 0 : 1);
+                    yBeg2 = yEnd2;
+                    yBeg1 = yEnd1;
+                    yBeg0 = yEnd0;
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
@@ -536,7 +559,7 @@ namespace Simd
 
                 a.yStep[0] = a.yStep[1] * c0.strideY;
                 a.yStart[0] = Simd::Min((a.yStart[1] - 1) * c0.strideY + c0.kernelY - c0.padY, c0.srcH);
-                a.bufH[0] = Pow2Hi(Simd::Max((a.yStep[1] - 1) * c0.strideY + c0.kernelY, a.yStart[0]));
+                a.bufH[0] = Pow2Hi(Simd::Max((Simd::Max(a.yStep[1], (a.yStep[2] - 1) * c1.strideY + c1.kernelY) - 1) * c0.strideY + c0.kernelY, a.yStart[0]));
 
                 _sizeB[0] = a.bufH[0] * p.conv[0].srcW * p.conv[0].srcC;
                 _sizeB[1] = a.bufH[1] * p.conv[1].srcW * a.maC;
@@ -561,40 +584,35 @@ namespace Simd
         {
         }
 
-        void SynetMergedConvolution32fBf16Cd::Forward(const float* src, float* buf, float* dst)
+        void SynetMergedConvolution32fBf16Cd::ForwardRows(const float* src, float* buf, size_t yBeg, size_t yEnd, float* dst)
         {
             const MergConvParam32f& p = _param;
             const ConvParam32f& c0 = p.conv[0];
             const ConvParam32f& c1 = p.conv[1];
             const AlgParam& a = _alg;
 
-            uint8_t* buffer = (uint8_t*)Buffer(buf);
+            uint8_t* buffer = (uint8_t*)buf;
             uint16_t* buf0 = Allocate<uint16_t>(buffer, _sizeB[0]);
             SetGap(buffer);
             float* buf1 = Allocate<float>(buffer, _sizeB[1]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
             {
-                for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
+                size_t maC = Simd::Min(C, c + a.maC) - c;
+                for (size_t yBeg2 = yBeg, yBeg1 = SrcBegY(c1, yBeg2), yBeg0 = SrcBegY(c0, yBeg1); yBeg2 < yEnd;)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
-                    {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        _convert(src, c0, yBeg0, yEnd0, buf0, a.bufH[0]);
-                        _input(buf0, c0, a, maC, yBeg1, yEnd1, _weightI.data + c * a.dw[0],
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf1);
-                        _depthwise(buf1, c1, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[1],
-                            _bias[1].data + c, _params[1].data + c * a.dp[1], (uint16_t*)dst);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
-                    }
+                    size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], yEnd);
+                    size_t yEnd1 = Simd::RestrictRange(Simd::Max(yBeg1 + a.yStep[1], SrcEndY(c1, yEnd2)), a.yStart[1], c1.srcH);
+                    size_t yEnd0 = Simd::RestrictRange(Simd::Max(yBeg0 + a.yStep[0], SrcEndY(c0, yEnd1)), a.yStart[0], c0.srcH);
+                    _convert(src, c0, yBeg0, yEnd0, buf0, a.bufH[0]);
+                    _input(buf0, c0, a, maC, yBeg1, yEnd1, _weightI.data + c * a.dw[0],
+                        _bias[0].data + c, _params[0].data + c * a.dp[0], buf1);
+                    _depthwise(buf1, c1, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[1],
+                        _bias[1].data + c, _params[1].data + c * a.dp[1], (uint16_t*)dst);
+                    yBeg2 = yEnd2;
+                    yBeg1 = yEnd1;
+                    yBeg0 = yEnd0;
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
@@ -631,7 +649,7 @@ namespace Simd
 
                 a.yStep[0] = a.yStep[1] * c0.strideY;
                 a.yStart[0] = Simd::Min((a.yStart[1] - 1) * c0.strideY + c0.kernelY - c0.padY, c0.srcH);
-                a.bufH[0] = Pow2Hi(Simd::Max((a.yStep[1] - 1) * c0.strideY + c0.kernelY, a.yStart[0]));
+                a.bufH[0] = Pow2Hi(Simd::Max((Simd::Max(a.yStep[1], (a.yStep[2] - 1) * c1.strideY + c1.kernelY) - 1) * c0.strideY + c0.kernelY, a.yStart[0]));
 
                 _sizeB[0] = a.bufH[0] * p.conv[0].srcW * p.conv[0].srcC;
                 _sizeB[1] = a.bufH[1] * p.conv[1].srcW * a.maC;
@@ -654,40 +672,35 @@ namespace Simd
         {
         }
 
-        void SynetMergedConvolution32fBf16Dc::Forward(const float* src, float* buf, float* dst)
+        void SynetMergedConvolution32fBf16Dc::ForwardRows(const float* src, float* buf, size_t yBeg, size_t yEnd, float* dst)
         {
             const MergConvParam32f& p = _param;
             const ConvParam32f& c0 = p.conv[0];
             const ConvParam32f& c1 = p.conv[1];
             const AlgParam& a = _alg;
 
-            uint8_t* buffer = (uint8_t*)Buffer(buf);
+            uint8_t* buffer = (uint8_t*)buf;
             uint16_t* buf2 = Allocate<uint16_t>(buffer, _sizeB[2]);
             SetGap(buffer);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
             {
-                for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
+                size_t maC = Simd::Min(C, c + a.maC) - c;
+                for (size_t yBeg2 = yBeg, yBeg1 = SrcBegY(c0, yBeg2); yBeg2 < yEnd;)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
-                    {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c0.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c0.srcH);
-                        _depthwise(src + c, c0, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[0], _bias[0].data + c,
-                            _params[0].data + c * a.dp[0], buf2);
-                        if (c + maC == C)
-                            _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[1],
-                                _bias[1].data, _params[1].data, dst, maC != C ? 0 : 1);
-                        else
-                            _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[1],
-                                _bias[1].data, _params[1].data, dst, c != 0 ? 0 : 1);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                    }
+                    size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], yEnd);
+                    size_t yEnd1 = Simd::RestrictRange(Simd::Max(yBeg1 + a.yStep[1], SrcEndY(c0, yEnd2)), a.yStart[1], c0.srcH);
+                    _depthwise(src + c, c0, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[0], _bias[0].data + c,
+                        _params[0].data + c * a.dp[0], buf2);
+                    if (c + maC == C)
+                        _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[1],
+                            _bias[1].data, _params[1].data, dst, maC != C ? 0 : 1);
+                    else
+                        _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[1],
+                            _bias[1].data, _params[1].data, dst, c != 0 ? 0 : 1);
+                    yBeg2 = yEnd2;
+                    yBeg1 = yEnd1;
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
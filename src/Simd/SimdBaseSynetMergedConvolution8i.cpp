@@ -23,12 +23,14 @@
 */
 #include "Simd/SimdSynetMergedConvolution8i.h"
 #include "Simd/SimdSynetConvolution8i.h"
+#include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetConvolution32fCommon.h"
 #include "Simd/SimdSynetConvolution8iCommon.h"
 #include "Simd/SimdUpdate.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -60,6 +62,8 @@ namespace Simd
 
         SynetMergedConvolution8i::SynetMergedConvolution8i(const MergConvParam8i& p)
            :  _param(p)
+           , _threads(Base::GetThreadNumber())
+           , _context(Base::ThreadContextCurrent())
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
            , _perf(NULL)
 #endif        
@@ -125,7 +129,8 @@ namespace Simd
 
         size_t SynetMergedConvolution8i::ExternalBufferSize() const
         {
-            return (_sizeB[0] + _sizeB[1] + _sizeB[4]) * 4 + _sizeB[2] + _sizeB[3] + SIMD_ALIGN;
+            size_t size = (_sizeB[0] + _sizeB[1] + _sizeB[4]) * 4 + _sizeB[2] + _sizeB[3] + SIMD_ALIGN;
+            return AlignHi(size, SIMD_ALIGN) * Threads();
         }
 
         size_t SynetMergedConvolution8i::InternalBufferSize() const
@@ -225,13 +230,44 @@ namespace Simd
         }
 
         void SynetMergedConvolution8i::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            ThreadContextScope scope(_context);
+            const ConvParam8i& last = _param.conv[_param.count - 1];
+            uint8_t* buffer = GetBuffer(buf);
+            size_t threads = Threads(), size = ExternalBufferSize() / threads, bands = Bands();
+            size_t stripe = _alg.miC ? _alg.yStep[2] : last.dstH, stripes = DivHi(last.dstH, stripe);
+            size_t sizeS = _sizeS * (_s8u ? 1 : 4), sizeD = _sizeD * (_d8u ? 1 : 4);
+            Parallel(0, last.batch * bands, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t t = begin; t < end; ++t)
+                {
+                    size_t b = t / bands, band = t % bands;
+                    size_t yBeg = stripes * band / bands * stripe;
+                    size_t yEnd = Simd::Min(stripes * (band + 1) / bands * stripe, last.dstH);
+                    ForwardRows(src + b * sizeS, buffer + thread * size, yBeg, yEnd, dst + b * sizeD);
+                }
+            }, threads);
+        }
+
+        size_t SynetMergedConvolution8i::Bands() const
+        {
+            const ConvParam8i& last = _param.conv[_param.count - 1];
+            size_t stripes = _alg.miC ? DivHi(last.dstH, _alg.yStep[2]) : 1;
+            return Simd::Max<size_t>(Simd::Min(stripes, DivHi(_threads, last.batch)), 1);
+        }
+
+        size_t SynetMergedConvolution8i::Threads() const
+        {
+            return Simd::Max<size_t>(Simd::Min(_threads, _param.conv[0].batch * Bands()), 1);
+        }
+
+        void SynetMergedConvolution8i::ForwardRows(const uint8_t* src, uint8_t* buf, size_t yBeg, size_t yEnd, uint8_t* dst)
         {
             const MergConvParam8i& p = _param;
             const ConvParam8i& c0 = p.conv[0];
             const ConvParam8i& c1 = p.conv[1];
             const ConvParam8i& c2 = p.conv[2];
 
-            buf = GetBuffer(buf);
             float* buf0 = Allocate<float>(buf, _sizeB[0]);
             float* buf1 = Allocate<float>(buf, _sizeB[1]);
             uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
@@ -243,46 +279,31 @@ namespace Simd
             float* dst32f = _d8u ? buf1 : (float*)dst;
             uint8_t* dst8u = _d8u ? dst : NULL;
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            assert(yBeg == 0 && yEnd == p.conv[p.count - 1].dstH);
+            if (_dw0)
             {
-                if (_dw0)
-                {
-                    if (_s8u)
-                    {
-                        _cvt8uTo32f(src8u, c0.srcC, 0, c0.srcH, c0.srcW, c0.srcC, _cvt[0].iScale.data, _cvt[0].iShift.data, src32f, 0, c0.compatibility);
-                        src8u += _sizeS;
-                    }
-                    _depthwise(src32f, c0, _alg, 0, 0, c0.dstH, _weight32f.data, _bias[0].data, _params[0].data, NULL, NULL, (uint8_t*)buf1);
-                    if (!_s8u)
-                        src32f += _sizeS;
-                    _cvt32fTo8u(buf1, 0, c1.srcH, c1.srcW, c1.srcC, _cvt[1].scale.data, _cvt[1].shift.data, buf2, 0, c0.compatibility);
-                    DirectConvolution8i(buf2, 1, 0, NULL, buf4, dst32f);
-                }
-                else
-                {
-                    if (!_s8u)
-                    {
-                        _cvt32fTo8u(src32f, 0, c0.srcH, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, src8u, 0, c0.compatibility);
-                        src32f += _sizeS;
-                    }                    
-                    DirectConvolution8i(src8u, 0, 0, buf3, buf4, buf0);
-                    if (_s8u)
-                        src8u += _sizeS;
-                    _depthwise(buf0, c1, _alg, 0, 0, c1.dstH, _weight32f.data, _bias[1].data, _params[1].data, NULL, NULL, (uint8_t*)(p.count == 3 ? buf1 : dst32f));
-                    if (p.count == 3)
-                    {
-                        _cvt32fTo8u(buf1, 0, c2.srcH, c2.srcW, c2.srcC, _cvt[1].scale.data, _cvt[1].shift.data, buf2, 0, c0.compatibility);
-                        DirectConvolution8i(buf2, 2, 1, NULL, buf4, dst32f);
-                    }
-                }
-                if (_d8u)
+                if (_s8u)
+                    _cvt8uTo32f(src8u, c0.srcC, 0, c0.srcH, c0.srcW, c0.srcC, _cvt[0].iScale.data, _cvt[0].iShift.data, src32f, 0, c0.compatibility);
+                _depthwise(src32f, c0, _alg, 0, 0, c0.dstH, _weight32f.data, _bias[0].data, _params[0].data, NULL, NULL, (uint8_t*)buf1);
+                _cvt32fTo8u(buf1, 0, c1.srcH, c1.srcW, c1.srcC, _cvt[1].scale.data, _cvt[1].shift.data, buf2, 0, c0.compatibility);
+                DirectConvolution8i(buf2, 1, 0, NULL, buf4, dst32f);
+            }
+            else
+            {
+                if (!_s8u)
+                    _cvt32fTo8u(src32f, 0, c0.srcH, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, src8u, 0, c0.compatibility);
+                DirectConvolution8i(src8u, 0, 0, buf3, buf4, buf0);
+                _depthwise(buf0, c1, _alg, 0, 0, c1.dstH, _weight32f.data, _bias[1].data, _params[1].data, NULL, NULL, (uint8_t*)(p.count == 3 ? buf1 : dst32f));
+                if (p.count == 3)
                 {
-                    const ConvParam8i& e = p.conv[p.count - 1];
-                    _cvt32fTo8u(dst32f, 0, e.dstH, e.dstW, e.dstC, _cvt[2].scale.data, _cvt[2].shift.data, dst8u, 0, c0.compatibility);
-                    dst8u += _sizeD;
+                    _cvt32fTo8u(buf1, 0, c2.srcH, c2.srcW, c2.srcC, _cvt[1].scale.data, _cvt[1].shift.data, buf2, 0, c0.compatibility);
+                    DirectConvolution8i(buf2, 2, 1, NULL, buf4, dst32f);
                 }
-                else
-                    dst32f += _sizeD;
+            }
+            if (_d8u)
+            {
+                const ConvParam8i& e = p.conv[p.count - 1];
+                _cvt32fTo8u(dst32f, 0, e.dstH, e.dstW, e.dstC, _cvt[2].scale.data, _cvt[2].shift.data, dst8u, 0, c0.compatibility);
             }
         }
 
@@ -497,7 +518,7 @@ namespace Simd
         {
         }
 
-        void SynetMergedConvolution8iCdc::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        void SynetMergedConvolution8iCdc::ForwardRows(const uint8_t* src, uint8_t* buf, size_t yBeg, size_t yEnd, uint8_t* dst)
         {
             const MergConvParam8i& p = _param;
             const ConvParam8i& c0 = p.conv[0];
@@ -505,41 +526,35 @@ namespace Simd
             const ConvParam8i& c2 = p.conv[2];
             const AlgParam& a = _alg;
 
-            buf = GetBuffer(buf);
             float* buf0 = Allocate<float>(buf, _sizeB[0]);
             uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
             uint8_t* buf3 = Allocate<uint8_t>(buf, _sizeB[3]);
             int32_t* buf4 = Allocate<int32_t>(buf, _sizeB[4]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
             {
-                for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
+                size_t maC = Simd::Min(C, c + a.maC) - c;
+                for (size_t yBeg2 = yBeg, yBeg1 = SrcBegY(c1, yBeg2), yBeg0 = SrcBegY(c0, yBeg1); yBeg2 < yEnd;)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
-                    {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        if (!_s8u)
-                            _cvt32fTo8u((float*)src, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
-                        _input(_s8u ? src : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c, 
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
-                        _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c, 
-                            _params[1].data + c * a.dp[1], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf3);
-                        if (c + maC == C)
-                            _output[0](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data, 
-                                _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, maC == C ? 1 : 0);
-                        else
-                            _output[1](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data,
-                                _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, c == 0 ? 1 : 0);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
-                    }
+                    size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], yEnd);
+                    size_t yEnd1 = Simd::RestrictRange(Simd::Max(yBeg1 + a.yStep[1], SrcEndY(c1, yEnd2)), a.yStart[1], c1.srcH);
+                    size_t yEnd0 = Simd::RestrictRange(Simd::Max(yBeg0 + a.yStep[0], SrcEndY(c0, yEnd1)), a.yStart[0], c0.srcH);
+                    if (!_s8u)
+                        _cvt32fTo8u((float*)src, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
+                    _input(_s8u ? src : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c, 
+                        _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
+                    _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c, 
+                        _params[1].data + c * a.dp[1], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf3);
+                    if (c + maC == C)
+                        _output[0](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data, 
+                            _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, maC == C ? 1 : 0);
+                    else
+                        _output[1](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data,
+                            _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, c == 0 ? 1 : 0);
+                    yBeg2 = yEnd2;
+                    yBeg1 = yEnd1;
+                    yBeg0 = yEnd0;
                 }
-                src += _sizeS * (_s8u ? 1 : 4);
-                dst += _sizeD * (_d8u ? 1 : 4);
             }
         }
 
@@ -577,7 +592,7 @@ namespace Simd
 
                 a.yStep[0] = a.yStep[1] * c0.strideY;
                 a.yStart[0] = Simd::Min((a.yStart[1] - 1) * c0.strideY + c0.kernelY - c0.padY, c0.srcH);
-                a.bufH[0] = Pow2Hi(Simd::Max((a.yStep[1] - 1) * c0.strideY + c0.kernelY, a.yStart[0])) * (_s8u ? 0 : 1);
+                a.bufH[0] = Pow2Hi(Simd::Max((Simd::Max(a.yStep[1], (a.yStep[2] - 1) * c1.strideY + c1.kernelY) - 1) * c0.strideY + c0.kernelY, a.yStart[0])) * (_s8u ? 0 : 1);
 
                 _sizeB[2] = a.bufH[0] * p.conv[0].srcW * p.conv[0].srcC;
                 _sizeB[0] = a.bufH[1] * p.conv[1].srcW * a.maC;
@@ -602,40 +617,34 @@ namespace Simd
         {
         }
 
-        void SynetMergedConvolution8iCd::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        void SynetMergedConvolution8iCd::ForwardRows(const uint8_t* src, uint8_t* buf, size_t yBeg, size_t yEnd, uint8_t* dst)
         {
             const MergConvParam8i& p = _param;
             const ConvParam8i& c0 = p.conv[0];
             const ConvParam8i& c1 = p.conv[1];
             const AlgParam& a = _alg;
 
-            buf = GetBuffer(buf);
             float* buf0 = Allocate<float>(buf, _sizeB[0]);
             uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
             {
-                for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
+                size_t maC = Simd::Min(C, c + a.maC) - c;
+                for (size_t yBeg2 = yBeg, yBeg1 = SrcBegY(c1, yBeg2), yBeg0 = SrcBegY(c0, yBeg1); yBeg2 < yEnd;)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
-                    {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        if (!_s8u)
-                            _cvt32fTo8u((float*)src, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
-                        _input(_s8u ? src : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c,
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
-                        _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c,
-                            _params[1].data + c * a.dp[1], _cvt[2].scale.data + c, _cvt[2].shift.data + c, dst + c);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
-                    }
+                    size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], yEnd);
+                    size_t yEnd1 = Simd::RestrictRange(Simd::Max(yBeg1 + a.yStep[1], SrcEndY(c1, yEnd2)), a.yStart[1], c1.srcH);
+                    size_t yEnd0 = Simd::RestrictRange(Simd::Max(yBeg0 + a.yStep[0], SrcEndY(c0, yEnd1)), a.yStart[0], c0.srcH);
+                    if (!_s8u)
+                        _cvt32fTo8u((float*)src, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
+                    _input(_s8u ? src : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c,
+                        _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
+                    _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c,
+                        _params[1].data + c * a.dp[1], _cvt[2].scale.data + c, _cvt[2].shift.data + c, dst + c);
+                    yBeg2 = yEnd2;
+                    yBeg1 = yEnd1;
+                    yBeg0 = yEnd0;
                 }
-                src += _sizeS * (_s8u ? 1 : 4);
-                dst += _sizeD * (_d8u ? 1 : 4);
             }
         }
 
@@ -672,7 +681,7 @@ namespace Simd
 
                 a.yStep[0] = a.yStep[1] * c0.strideY;
                 a.yStart[0] = Simd::Min((a.yStart[1] - 1) * c0.strideY + c0.kernelY - c0.padY, c0.srcH);
-                a.bufH[0] = Pow2Hi(Simd::Max((a.yStep[1] - 1) * c0.strideY + c0.kernelY, a.yStart[0])) * (_s8u ? 0 : 1);
+                a.bufH[0] = Pow2Hi(Simd::Max((Simd::Max(a.yStep[1], (a.yStep[2] - 1) * c1.strideY + c1.kernelY) - 1) * c0.strideY + c0.kernelY, a.yStart[0])) * (_s8u ? 0 : 1);
 
                 _sizeB[2] = a.bufH[0] * p.conv[0].srcW * p.conv[0].srcC;
                 _sizeB[0] = a.bufH[1] * p.conv[1].srcW * a.maC;
@@ -697,44 +706,38 @@ namespace Simd
         {
         }
 
-        void SynetMergedConvolution8iDc::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        void SynetMergedConvolution8iDc::ForwardRows(const uint8_t* src, uint8_t* buf, size_t yBeg, size_t yEnd, uint8_t* dst)
         {
             const MergConvParam8i& p = _param;
             const ConvParam8i& c0 = p.conv[0];
             const ConvParam8i& c1 = p.conv[1];
             const AlgParam& a = _alg;
 
-            buf = GetBuffer(buf);
             float* buf0 = Allocate<float>(buf, _sizeB[0]);
             uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
             int32_t* buf4 = Allocate<int32_t>(buf, _sizeB[4]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
             {
-                for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
+                size_t maC = Simd::Min(C, c + a.maC) - c;
+                for (size_t yBeg2 = yBeg, yBeg1 = SrcBegY(c0, yBeg2); yBeg2 < yEnd;)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c0.dstH;)
-                    {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c0.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c0.srcH);
-                        if (_s8u)
-                            _cvt8uTo32f(src + c, maC, yBeg1, yEnd1, c0.srcW, c0.srcC, _cvt[0].iScale.data + c, 
-                                _cvt[0].iShift.data + c, buf0, a.bufH[1], c0.compatibility);
-                        _depthwise(_s8u ? buf0 : (float*)src + c, c0, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[0], _bias[0].data + c,
-                            _params[0].data + c * a.dp[0], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf2);
-                        if (c + maC == C)
-                            _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
-                                _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, maC == C ? 1 : 0);
-                        else
-                            _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
-                                _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, c == 0 ? 1 : 0);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                    }
+                    size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], yEnd);
+                    size_t yEnd1 = Simd::RestrictRange(Simd::Max(yBeg1 + a.yStep[1], SrcEndY(c0, yEnd2)), a.yStart[1], c0.srcH);
+                    if (_s8u)
+                        _cvt8uTo32f(src + c, maC, yBeg1, yEnd1, c0.srcW, c0.srcC, _cvt[0].iScale.data + c, 
+                            _cvt[0].iShift.data + c, buf0, a.bufH[1], c0.compatibility);
+                    _depthwise(_s8u ? buf0 : (float*)src + c, c0, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[0], _bias[0].data + c,
+                        _params[0].data + c * a.dp[0], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf2);
+                    if (c + maC == C)
+                        _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
+                            _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, maC == C ? 1 : 0);
+                    else
+                        _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
+                            _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, c == 0 ? 1 : 0);
+                    yBeg2 = yEnd2;
+                    yBeg1 = yEnd1;
                 }
-                src += _sizeS * (_s8u ? 1 : 4);
-                dst += _sizeD * (_d8u ? 1 : 4);
             }
         }
 
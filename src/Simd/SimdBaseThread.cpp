@@ -23,8 +23,18 @@
 */
 #include "Simd/SimdMath.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdParallel.hpp"
 
-#include <thread>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace Simd
 {
@@ -32,14 +42,103 @@ namespace Simd
     {
         size_t g_threadNumber = 1;
 
+        class ThreadContext;
+
+        static thread_local ThreadContext * g_threadContext = NULL;
+
+        static void SetThreadAffinity(uint64_t mask)
+        {
+            if (mask == 0)
+                return;
+#if defined(_WIN32)
+            ::SetThreadAffinityMask(::GetCurrentThread(), (DWORD_PTR)mask);
+#elif defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (size_t i = 0; i < 64 && i < CPU_SETSIZE; ++i)
+                if (mask & (uint64_t(1) << i))
+                    CPU_SET(i, &set);
+            ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+#endif
+        }
+
+        class ThreadContext : public Deletable
+        {
+        public:
+            ThreadContext(size_t threadNumber, uint64_t affinity)
+                : _threadNumber(Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency()))
+                , _affinity(affinity)
+#ifndef SIMD_FUTURE_DISABLE
+                , _pool(Start, this)
+#endif
+            {
+#ifndef SIMD_FUTURE_DISABLE
+                _pool.Reserve(_threadNumber - 1);
+#endif
+            }
+
+            virtual ~ThreadContext()
+            {
+                if (g_threadContext == this)
+                    Bind(NULL);
+            }
+
+            size_t ThreadNumber() const
+            {
+                return _threadNumber;
+            }
+
+            static ThreadContext * Bind(ThreadContext * context)
+            {
+                ThreadContext * previous = g_threadContext;
+                g_threadContext = context;
+#ifndef SIMD_FUTURE_DISABLE
+                ThreadPool::Current() = context ? &context->_pool : NULL;
+#endif
+                return previous;
+            }
+
+        private:
+            size_t _threadNumber;
+            uint64_t _affinity;
+#ifndef SIMD_FUTURE_DISABLE
+            ThreadPool _pool;
+
+            static void Start(const void * context, size_t worker)
+            {
+                const ThreadContext * threadContext = (const ThreadContext*)context;
+                g_threadContext = (ThreadContext*)threadContext;
+                SetThreadAffinity(threadContext->_affinity);
+            }
+#endif
+        };
+
         size_t GetThreadNumber()
         {
-            return g_threadNumber;
+            return g_threadContext ? g_threadContext->ThreadNumber() : g_threadNumber;
         }
 
         void SetThreadNumber(size_t threadNumber)
         {
             g_threadNumber = Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency());
+#ifndef SIMD_FUTURE_DISABLE
+            ThreadPool::Global().Reserve(g_threadNumber - 1);
+#endif
+        }
+
+        void * ThreadContextCreate(size_t threadNumber, uint64_t affinity)
+        {
+            return new ThreadContext(threadNumber, affinity);
+        }
+
+        void * ThreadContextBind(void * context)
+        {
+            return ThreadContext::Bind((ThreadContext*)context);
+        }
+
+        void * ThreadContextCurrent()
+        {
+            return g_threadContext;
         }
     }
 }
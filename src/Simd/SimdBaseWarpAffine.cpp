@@ -73,6 +73,7 @@ namespace Simd
         : _param(param)
         , _first(true)
         , _threads(Base::GetThreadNumber())
+        , _context(Base::ThreadContextCurrent())
     {
     }
 
@@ -143,6 +144,7 @@ namespace Simd
 
         void WarpAffineNearest::Run(const uint8_t* src, uint8_t* dst)
         {
+            ThreadContextScope scope(_context);
             if(_first)
                 Init();
 
@@ -286,6 +288,7 @@ namespace Simd
 
         void WarpAffineByteBilinear::Run(const uint8_t* src, uint8_t* dst)
         {
+            ThreadContextScope scope(_context);
             if (_first)
                 Init();
 
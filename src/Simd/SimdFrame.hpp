@@ -407,6 +407,20 @@ namespace Simd
     */
     template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst);
 
+    /*! @ingroup cpp_frame_functions
+
+        \fn template <template<class> class A> void Resize(const Frame<A> & src, Frame<A> & dst, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear);
+
+        \short Resizes one frame to another frame.
+
+        The frames must have the same format. All planes of NV12 and YUV420P frames are resized in one call (see ::SimdResizerYuvInit).
+
+        \param [in] src - an input frame.
+        \param [out] dst - an output frame.
+        \param [in] method - a resizing method. By default it is equal to ::SimdResizeMethodBilinear.
+    */
+    template <template<class> class A> void Resize(const Frame<A> & src, Frame<A> & dst, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear);
+
     //-------------------------------------------------------------------------
 
     // struct Frame implementation:
@@ -1096,6 +1110,36 @@ namespace Simd
             assert(0);
         }
     }
+
+    template <template<class> class A> SIMD_INLINE void Resize(const Frame<A> & src, Frame<A> & dst, ::SimdResizeMethodType method)
+    {
+        assert(src.format == dst.format && src.flipped == dst.flipped);
+
+        if (EqualSize(src, dst))
+        {
+            Copy(src, dst);
+            return;
+        }
+
+        switch (src.format)
+        {
+        case Frame<A>::Nv12:
+            ResizeNv12(src.planes[0], src.planes[1], dst.planes[0], dst.planes[1], method);
+            break;
+        case Frame<A>::Yuv420p:
+            ResizeYuv420p(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], dst.planes[1], dst.planes[2], method);
+            break;
+        case Frame<A>::Bgra32:
+        case Frame<A>::Bgr24:
+        case Frame<A>::Gray8:
+        case Frame<A>::Rgb24:
+        case Frame<A>::Rgba32:
+            Resize(src.planes[0], dst.planes[0], method);
+            break;
+        default:
+            assert(0);
+        }
+    }
 }
 
 #endif//__SimdFrame_hpp__
@@ -46,8 +46,9 @@ namespace Simd
         size_t size;
         SimdImageFileType file;
         SimdPixelFormatType format;
+        size_t scale;
 
-        ImageLoaderParam(const uint8_t* d, size_t s, SimdPixelFormatType f);
+        ImageLoaderParam(const uint8_t* d, size_t s, SimdPixelFormatType f, size_t sc = 1);
 
         bool Validate();
     };
@@ -60,11 +61,36 @@ namespace Simd
         ImageLoaderParam _param;
         InputMemoryStream _stream;
         Image _image;
+        uint8_t* _target;
+        size_t _targetStride, _targetSize, _targetWidth, _targetHeight;
+
+        SIMD_INLINE bool PrepareImage(size_t width, size_t height)
+        {
+            Image::Format format = (Image::Format)_param.format;
+            if (_target)
+            {
+                _targetWidth = width;
+                _targetHeight = height;
+                size_t rowSize = width * Image::PixelSize(format);
+                if (rowSize > _targetStride || (height && (height - 1) * _targetStride + rowSize > _targetSize))
+                    return false;
+                _image.Clear();
+                _image = Image(width, height, _targetStride, format, _target);
+            }
+            else
+                _image.Recreate(width, height, format);
+            return true;
+        }
         
     public:
         ImageLoader(const ImageLoaderParam& param)
             : _param(param)
             , _stream(_param.data, _param.size)
+            , _target(NULL)
+            , _targetStride(0)
+            , _targetSize(0)
+            , _targetWidth(0)
+            , _targetHeight(0)
         {
         }
 
@@ -82,8 +108,36 @@ namespace Simd
             *format = (SimdPixelFormatType)_image.format;
             return _image.Release();
         }
+
+        SIMD_INLINE void SetTarget(uint8_t* data, size_t stride, size_t size)
+        {
+            _target = data;
+            _targetStride = stride;
+            _targetSize = size;
+        }
+
+        SIMD_INLINE void Release(size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            *width = _targetWidth;
+            *height = _targetHeight;
+            *format = _param.format;
+        }
     };
 
+    typedef ImageLoader* (*CreateImageLoaderPtr)(const ImageLoaderParam& param);
+
+    uint8_t* ImageLoadFromMemory(const CreateImageLoaderPtr create, const ImageLoaderParam& param, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+    uint8_t* ImageLoadFromFile(const CreateImageLoaderPtr create, const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+    bool ImageLoadFromMemory(const CreateImageLoaderPtr create, const ImageLoaderParam& param, uint8_t* dst, size_t dstStride, size_t dstSize, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+    bool ImageLoadFromFile(const CreateImageLoaderPtr create, const char* path, uint8_t* dst, size_t dstStride, size_t dstSize, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+    typedef uint8_t* (*ImageLoadYuvFromMemoryPtr)(const uint8_t* data, size_t size, SimdYuvLayoutType layout, uint8_t* planes[3], size_t strides[3], size_t* width, size_t* height);
+
+    uint8_t* ImageLoadYuvFromFile(const ImageLoadYuvFromMemoryPtr loader, const char* path, SimdYuvLayoutType layout, uint8_t* planes[3], size_t strides[3], size_t* width, size_t* height);
+
     namespace Base
     {
         class ImagePxmLoader : public ImageLoader
@@ -163,13 +217,13 @@ namespace Simd
             DecodeLinePtr _decodeLine[7];
             ExpandPalettePtr _expandPalette;
             ConverterPtr _converter;
+            uint32_t _width, _height, _channels, _outN;
+            uint8_t _depth, _color, _interlace, _paletteChannels, _tc[3];
             virtual void SetConverter();
 
         private:
             bool _first, _hasTrans, _iPhone;
-            uint32_t _width, _height, _channels, _outN;
             uint16_t _tc16[3];
-            uint8_t _depth, _color, _interlace, _paletteChannels, _tc[3];
             Array8u _palette, _idat, _buffer;
 
             struct Chunk
@@ -192,7 +246,7 @@ namespace Simd
             bool CreateImage(const uint8_t* data, size_t size);
             bool CreateImageRaw(const uint8_t* data, uint32_t size, uint32_t width, uint32_t height);
             void ExpandPalette();
-            void ConvertImage();
+            bool ConvertImage();
         };
 
         class ImageJpegLoader : public ImageLoader
@@ -205,7 +259,15 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ImageLoader* CreateImageLoader(const ImageLoaderParam& param);
+
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        //---------------------------------------------------------------------
+
+        bool ImageInfoFromMemory(const uint8_t* data, size_t size, SimdImageInfo* info);
+
+        bool ImageInfoFromFile(const char* path, SimdImageInfo* info);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -252,7 +314,8 @@ namespace Simd
         public:
             ImagePngLoader(const ImageLoaderParam& param);
 
-            virtual bool FromStream();
+        protected:
+            virtual void SetConverter();
         };
 
         class ImageJpegLoader : public Base::ImageJpegLoader
@@ -265,6 +328,8 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ImageLoader* CreateImageLoader(const ImageLoaderParam& param);
+
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
     }
 #endif// SIMD_SSE41_ENABLE
@@ -308,8 +373,19 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImagePngLoader : public Sse41::ImagePngLoader
+        {
+        public:
+            ImagePngLoader(const ImageLoaderParam& param);
+
+        protected:
+            virtual void SetConverter();
+        };
+
         //---------------------------------------------------------------------
 
+        ImageLoader* CreateImageLoader(const ImageLoaderParam& param);
+
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
     }
 #endif// SIMD_AVX2_ENABLE
@@ -355,6 +431,8 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ImageLoader* CreateImageLoader(const ImageLoaderParam& param);
+
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
     }
 #endif// SIMD_AVX512BW_ENABLE
@@ -400,6 +478,8 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ImageLoader* CreateImageLoader(const ImageLoaderParam& param);
+
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
     }
 #endif// SIMD_NEON_ENABLE
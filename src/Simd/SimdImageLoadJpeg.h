@@ -39,11 +39,20 @@ namespace Simd
             std::cout << "JPEG load error: " << text << ", " << type << "!" << std::endl;
             return 0;
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        uint8_t* JpegLoadYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, uint8_t* planes[3], size_t strides[3], size_t* width, size_t* height);
+
+        bool JpegLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t stride);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
     namespace Sse41
     {
+        uint8_t* JpegLoadYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, uint8_t* planes[3], size_t strides[3], size_t* width, size_t* height);
+
+        bool JpegLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t stride);
     }
 #endif
 
@@ -28,6 +28,8 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
 
+#include <vector>
+
 namespace Simd
 {
     typedef uint8_t* (*ImageSaveToMemoryPtr)(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
@@ -93,7 +95,7 @@ namespace Simd
         }
     };
 
-    class ImageSaver
+    class ImageSaver : public Deletable
     {
     protected:
         ImageSaverParam _param;
@@ -169,6 +171,8 @@ namespace Simd
         public:
             ImagePngSaver(const ImageSaverParam& param);
 
+            virtual ~ImagePngSaver();
+
             virtual bool ToStream(const uint8_t* src, size_t stride);
         protected:
             static const int COMPRESSION = 8;
@@ -176,13 +180,17 @@ namespace Simd
             static const int TYPES = 7;
             typedef void (*ConvertPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
             typedef uint32_t (*EncodePtr)(const uint8_t* src, size_t stride, size_t n, size_t size, int8_t* dst);
-            typedef void (*CompressPtr)(uint8_t* data, int size, int quality, OutputMemoryStream& stream);
+            typedef void (*DeflatePtr)(const uint8_t* data, int begin, int end, int level, bool last, OutputMemoryStream& stream);
+            typedef uint32_t (*AdlerPtr)(uint8_t* data, int size);
             ConvertPtr _convert;
             EncodePtr _encode[TYPES];
-            CompressPtr _compress;
-            size_t _channels, _size;
+            DeflatePtr _deflate;
+            AdlerPtr _adler;
+            size_t _channels, _size, _threads;
+            int _level;
             Array8u _filt, _buff;
             Array8i _line;
+            std::vector<OutputMemoryStream*> _chunks;
 
             void WriteToStream(const uint8_t* zlib, size_t zlen);
         };
@@ -192,6 +200,14 @@ namespace Simd
         public:
             ImageJpegSaver(const ImageSaverParam& param);
 
+            virtual ~ImageJpegSaver();
+
+            size_t Encode(const uint8_t* src, size_t stride, uint8_t* dst, size_t capacity);
+
+            size_t Encode(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, uint8_t* dst, size_t capacity);
+
+            size_t Encode(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, uint8_t* dst, size_t capacity);
+
             virtual bool ToStream(const uint8_t* src, size_t stride);
 
             virtual bool ToStream(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride);
@@ -210,13 +226,15 @@ namespace Simd
                 const uint8_t* u, int uStride, const uint8_t* v, int vStride, const float* fY, const float* fUv, int dc[3]);
 
             Array8u _buffer;
+            std::vector<OutputMemoryStream*> _bands;
             DeintBgrPtr _deintBgr;
             DeintBgraPtr _deintBgra;
             WriteBlockPtr _writeBlock;
             WriteNv12BlockPtr _writeNv12Block;
             WriteYuv420pBlockPtr _writeYuv420pBlock;
             bool _subSample;
-            int _quality, _block, _width;
+            int _quality, _block, _width, _restart;
+            size_t _threads, _header;
             float _fY[64], _fUv[64];
             uint8_t _uY[64], _uUv[64];
 
@@ -224,6 +242,9 @@ namespace Simd
 
             void InitParams(bool trans);
             void WriteHeader();
+            void Start();
+            size_t Export(uint8_t* dst, size_t capacity) const;
+            template<class WriteRows> void WriteData(const WriteRows& writeRows);
         };
 
         //---------------------------------------------------------------------
@@ -233,6 +254,8 @@ namespace Simd
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
+
+        void* JpegEncoderInit(size_t width, size_t height, SimdPixelFormatType format, int quality, SimdYuvType yuvType);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -284,6 +307,8 @@ namespace Simd
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
+
+        void* JpegEncoderInit(size_t width, size_t height, SimdPixelFormatType format, int quality, SimdYuvType yuvType);
     }
 #endif// SIMD_SSE41_ENABLE
 
@@ -336,6 +361,8 @@ namespace Simd
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
+
+        void* JpegEncoderInit(size_t width, size_t height, SimdPixelFormatType format, int quality, SimdYuvType yuvType);
     }
 #endif// SIMD_AVX2_ENABLE
 
@@ -388,6 +415,8 @@ namespace Simd
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
+
+        void* JpegEncoderInit(size_t width, size_t height, SimdPixelFormatType format, int quality, SimdYuvType yuvType);
     }
 #endif// SIMD_AVX512BW_ENABLE
 
@@ -440,6 +469,8 @@ namespace Simd
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
+
+        void* JpegEncoderInit(size_t width, size_t height, SimdPixelFormatType format, int quality, SimdYuvType yuvType);
     }
 #endif// SIMD_NEON_ENABLE
 }
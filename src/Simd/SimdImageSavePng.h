@@ -138,6 +138,36 @@ namespace Simd
             return i;
         }
 
+        SIMD_INLINE void ZlibMatch(int length, int distance, OutputMemoryStream& stream)
+        {
+            assert(distance <= 32768 && length <= 258);
+            int j;
+            for (j = 0; length > ZlibLenC[j + 1] - 1; ++j);
+            ZlibHuff(j + 257, stream);
+            if (ZlibLenEb[j])
+                stream.WriteBits(length - ZlibLenC[j], ZlibLenEb[j]);
+            for (j = 0; distance > ZlibDistC[j + 1] - 1; ++j);
+            stream.WriteBits(ZlibBitRev(j, 5), 5);
+            if (ZlibDistEb[j])
+                stream.WriteBits(distance - ZlibDistC[j], ZlibDistEb[j]);
+        }
+
+        SIMD_INLINE void ZlibInsert(int* hList, int basket, int pos)
+        {
+            int j = 0, half = basket / 2;
+            while (j < basket && hList[j] != -1)
+                ++j;
+            if (j == basket)
+            {
+                memcpy(hList, hList + half, half * sizeof(int));
+                memset(hList + half, -1, half * sizeof(int));
+                j = half;
+            }
+            hList[j] = pos;
+        }
+
+        uint32_t ZlibAdler32Combine(uint32_t adler1, uint32_t adler2, size_t size2);
+
         SIMD_INLINE uint8_t Paeth(int a, int b, int c)
         {
             int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
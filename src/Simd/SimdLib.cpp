@@ -66,9 +66,11 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdDescrInt.h"
 #include "Simd/SimdGaussianBlur.h"
 #include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageLoadJpeg.h"
 #include "Simd/SimdImageSave.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdResizerRoi.h"
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetDeconvolution32f.h"
@@ -76,6 +78,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdSynetMergedConvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution8i.h"
 #include "Simd/SimdSynetPermute.h"
+#include "Simd/SimdSynetInputResizer.h"
 #include "Simd/SimdSynetScale8i.h"
 #include "Simd/SimdWarpAffine.h"
 
@@ -172,6 +175,46 @@ SIMD_API const char * SimdPerformanceStatistic()
 #endif
 }
 
+SIMD_API const char * SimdPerformanceReport(SimdPerformanceReportType type)
+{
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+    switch (type)
+    {
+    case SimdPerformanceReportText: return Base::PerformanceMeasurerStorage::s_storage.PerformanceStatistic();
+    case SimdPerformanceReportJson: return Base::PerformanceMeasurerStorage::s_storage.JsonReport();
+    case SimdPerformanceReportTrace: return Base::PerformanceMeasurerStorage::s_storage.TraceReport();
+    default:
+        return "";
+    }
+#else
+    return "";
+#endif
+}
+
+SIMD_API void SimdPerformanceTrace(SimdBool enable)
+{
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+    Base::PerformanceMeasurerStorage::s_storage.SetTrace(enable == SimdTrue);
+#endif
+}
+
+SIMD_API void SimdPerformanceCounters(SimdBool enable)
+{
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+    Base::PerformanceMeasurerStorage::s_storage.SetCounters(enable == SimdTrue);
+#endif
+}
+
+SIMD_API SimdBool SimdRuntimeCacheLoad(const char * path)
+{
+    return Base::RuntimeCacheLoad(path) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdRuntimeCacheSave(const char * path)
+{
+    return Base::RuntimeCacheSave(path) ? SimdTrue : SimdFalse;
+}
+
 SIMD_API void * SimdAllocate(size_t size, size_t align)
 {
     return Allocate(size, align);
@@ -192,6 +235,16 @@ SIMD_API size_t SimdAlignment()
     return Simd::ALIGNMENT;
 }
 
+SIMD_API void SimdSetAllocationPolicy(size_t hugePageThreshold, int numaNode)
+{
+    Base::SetAllocationPolicy(hugePageThreshold, numaNode);
+}
+
+SIMD_API void SimdGetAllocationPolicy(size_t * hugePageThreshold, int * numaNode)
+{
+    Base::GetAllocationPolicy(hugePageThreshold, numaNode);
+}
+
 SIMD_API void SimdRelease(void * context)
 {
     delete (Deletable*)context;
@@ -207,6 +260,16 @@ SIMD_API void SimdSetThreadNumber(size_t threadNumber)
     Base::SetThreadNumber(threadNumber);
 }
 
+SIMD_API void * SimdThreadContextCreate(size_t threadNumber, uint64_t affinityMask)
+{
+    return Base::ThreadContextCreate(threadNumber, affinityMask);
+}
+
+SIMD_API void * SimdThreadContextBind(void * context)
+{
+    return Base::ThreadContextBind(context);
+}
+
 SIMD_API SimdBool SimdGetFastMode()
 {
 #ifdef SIMD_SSE41_ENABLE
@@ -3418,6 +3481,34 @@ SIMD_API uint8_t* SimdYuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride
     return simdYuv420pSaveAsJpegToMemory(y, yStride, u, uStride, v, vStride, width, height, yuvType, quality, size);
 }
 
+SIMD_API void * SimdJpegEncoderInit(size_t width, size_t height, SimdPixelFormatType format, int quality, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdJpegEncoderInitPtr) (size_t width, size_t height, SimdPixelFormatType format, int quality, SimdYuvType yuvType);
+    const static SimdJpegEncoderInitPtr simdJpegEncoderInit = SIMD_FUNC4(JpegEncoderInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdJpegEncoderInit(width, height, format, quality, yuvType);
+}
+
+SIMD_API size_t SimdJpegEncoderRun(void * encoder, const uint8_t * src, size_t stride, uint8_t * dst, size_t capacity)
+{
+    SIMD_EMPTY();
+    return ((Base::ImageJpegSaver*)encoder)->Encode(src, stride, dst, capacity);
+}
+
+SIMD_API size_t SimdJpegEncoderRunNv12(void * encoder, const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, uint8_t * dst, size_t capacity)
+{
+    SIMD_EMPTY();
+    return ((Base::ImageJpegSaver*)encoder)->Encode(y, yStride, uv, uvStride, dst, capacity);
+}
+
+SIMD_API size_t SimdJpegEncoderRunYuv420p(void * encoder, const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, 
+    const uint8_t * v, size_t vStride, uint8_t * dst, size_t capacity)
+{
+    SIMD_EMPTY();
+    return ((Base::ImageJpegSaver*)encoder)->Encode(y, yStride, u, uStride, v, vStride, dst, capacity);
+}
+
 SIMD_API uint8_t* SimdImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
 {
     SIMD_EMPTY();
@@ -3434,6 +3525,75 @@ SIMD_API uint8_t* SimdImageLoadFromFile(const char* path, size_t* stride, size_t
     return ImageLoadFromFile(imageLoadFromMemory, path, stride, width, height, format);
 }
 
+SIMD_API uint8_t* SimdImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    const static Simd::CreateImageLoaderPtr createImageLoader = SIMD_FUNC4(CreateImageLoader, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return ImageLoadFromMemory(createImageLoader, Simd::ImageLoaderParam(data, size, *format, scale), stride, width, height, format);
+}
+
+SIMD_API uint8_t* SimdImageLoadFromFileScaled(const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    const static Simd::CreateImageLoaderPtr createImageLoader = SIMD_FUNC4(CreateImageLoader, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return ImageLoadFromFile(createImageLoader, path, scale, stride, width, height, format);
+}
+
+SIMD_API SimdBool SimdImageLoadFromMemoryToBuffer(const uint8_t* data, size_t size, uint8_t* dst, size_t dstStride, size_t dstSize, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    const static Simd::CreateImageLoaderPtr createImageLoader = SIMD_FUNC4(CreateImageLoader, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return ImageLoadFromMemory(createImageLoader, Simd::ImageLoaderParam(data, size, *format), dst, dstStride, dstSize, width, height, format) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdImageLoadFromFileToBuffer(const char* path, uint8_t* dst, size_t dstStride, size_t dstSize, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    const static Simd::CreateImageLoaderPtr createImageLoader = SIMD_FUNC4(CreateImageLoader, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return ImageLoadFromFile(createImageLoader, path, dst, dstStride, dstSize, width, height, format) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API uint8_t* SimdImageLoadYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, uint8_t* planes[3], size_t strides[3], size_t* width, size_t* height)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageLoadYuvFromMemoryPtr jpegLoadYuvFromMemory = SIMD_FUNC1(JpegLoadYuvFromMemory, SIMD_SSE41_FUNC);
+
+    return jpegLoadYuvFromMemory(data, size, layout, planes, strides, width, height);
+}
+
+SIMD_API uint8_t* SimdImageLoadYuvFromFile(const char* path, SimdYuvLayoutType layout, uint8_t* planes[3], size_t strides[3], size_t* width, size_t* height)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageLoadYuvFromMemoryPtr jpegLoadYuvFromMemory = SIMD_FUNC1(JpegLoadYuvFromMemory, SIMD_SSE41_FUNC);
+
+    return ImageLoadYuvFromFile(jpegLoadYuvFromMemory, path, layout, planes, strides, width, height);
+}
+
+SIMD_API SimdBool SimdImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    typedef bool (*JpegLoadRoiFromMemoryPtr)(const uint8_t* data, size_t size, size_t left, size_t top, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t stride);
+    const static JpegLoadRoiFromMemoryPtr jpegLoadRoiFromMemory = SIMD_FUNC1(JpegLoadRoiFromMemory, SIMD_SSE41_FUNC);
+
+    return jpegLoadRoiFromMemory(data, size, left, top, width, height, format, dst, dstStride) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdImageInfoFromMemory(const uint8_t* data, size_t size, SimdImageInfo* info)
+{
+    SIMD_EMPTY();
+    return Base::ImageInfoFromMemory(data, size, info) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdImageInfoFromFile(const char* path, SimdImageInfo* info)
+{
+    SIMD_EMPTY();
+    return Base::ImageInfoFromFile(path, info) ? SimdTrue : SimdFalse;
+}
+
 SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
@@ -4887,7 +5047,7 @@ SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t ds
     typedef void*(*SimdResizerInitPtr) (size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     const static SimdResizerInitPtr simdResizerInit = SIMD_FUNC5(ResizerInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
 
-    return simdResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+    return Base::ResizerParallelInit(simdResizerInit, Base::GetThreadNumber(), srcX, srcY, dstX, dstY, channels, type, method);
 }
 
 SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
@@ -4896,6 +5056,76 @@ SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t s
     ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
 }
 
+SIMD_API void * SimdResizerRoiInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+{
+    SIMD_EMPTY();
+    typedef void*(*SimdResizerRoiInitPtr) (size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+    const static SimdResizerRoiInitPtr simdResizerRoiInit = SIMD_FUNC3(ResizerRoiInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdResizerRoiInit(srcX, srcY, dstX, dstY, channels, type, method);
+}
+
+SIMD_API void SimdResizerRoiRun(const void * resizer, const uint8_t * src, size_t srcStride, const float * rois, size_t count, uint8_t * dst)
+{
+    SIMD_EMPTY();
+    ((Base::ResizerRoi*)resizer)->Run(src, srcStride, rois, count, dst);
+}
+
+SIMD_API void * SimdResizerYuvInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdYuvLayoutType layout, SimdResizeMethodType method)
+{
+    SIMD_EMPTY();
+    typedef void*(*SimdResizerInitPtr) (size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+    const static SimdResizerInitPtr simdResizerInit = SIMD_FUNC5(ResizerInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return Base::ResizerYuvInit(simdResizerInit, Base::GetThreadNumber(), srcX, srcY, dstX, dstY, layout, method);
+}
+
+SIMD_API void SimdResizerYuvRun(const void * resizer, const uint8_t * const * src, const size_t * srcStride, uint8_t * const * dst, const size_t * dstStride)
+{
+    SIMD_EMPTY();
+    ((Base::ResizerYuv*)resizer)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API SimdBool SimdResizerCacheRun(const uint8_t * src, size_t srcX, size_t srcY, size_t srcStride, uint8_t * dst, size_t dstX, size_t dstY, size_t dstStride, 
+    size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+{
+    SIMD_EMPTY();
+    Base::ResizerCacheKey key(srcX, srcY, dstX, dstY, channels, type, method, Base::GetThreadNumber(), Base::ThreadContextCurrent());
+    void * resizer = Base::ResizerCacheAcquire(key);
+    if (resizer == NULL)
+        resizer = SimdResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+    if (resizer == NULL)
+        return SimdFalse;
+    ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
+    Base::ResizerCacheRelease(key, resizer);
+    return SimdTrue;
+}
+
+SIMD_API SimdBool SimdResizerYuvCacheRun(const uint8_t * const * src, size_t srcX, size_t srcY, const size_t * srcStride, uint8_t * const * dst, size_t dstX, size_t dstY, const size_t * dstStride, 
+    SimdYuvLayoutType layout, SimdResizeMethodType method)
+{
+    SIMD_EMPTY();
+    Base::ResizerCacheKey key(srcX, srcY, dstX, dstY, 0, SimdResizeChannelByte, method, Base::GetThreadNumber(), Base::ThreadContextCurrent(), layout);
+    void * resizer = Base::ResizerCacheAcquire(key);
+    if (resizer == NULL)
+        resizer = SimdResizerYuvInit(srcX, srcY, dstX, dstY, layout, method);
+    if (resizer == NULL)
+        return SimdFalse;
+    ((Base::ResizerYuv*)resizer)->Run(src, srcStride, dst, dstStride);
+    Base::ResizerCacheRelease(key, resizer);
+    return SimdTrue;
+}
+
+SIMD_API void SimdResizerCacheSetCapacity(size_t capacity)
+{
+    Base::ResizerCacheSetCapacity(capacity);
+}
+
+SIMD_API size_t SimdResizerCacheGetCapacity()
+{
+    return Base::ResizerCacheGetCapacity();
+}
+
 SIMD_API void SimdRgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
 {
     SIMD_EMPTY();
@@ -5964,6 +6194,28 @@ SIMD_API void SimdSynetConvert8uTo32f(const uint8_t* src, size_t batch, size_t c
 #endif
 }
 
+SIMD_API void * SimdSynetWorkspaceInit()
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return new SynetWorkspace();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetWorkspaceSize(const void * workspace)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetWorkspace*)workspace)->Size() * sizeof(float);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
 SIMD_API void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * params, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
@@ -6027,12 +6279,33 @@ SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src,
 #if defined(SIMD_SYNET_ENABLE)
     SynetConvolution32f * c = (SynetConvolution32f*)context;
     SIMD_PERF_EXT(c);
+    Base::ThreadContextScope scope(c->ThreadContext());
     c->Forward(src, buf, dst);
 #else
     assert(0);
 #endif
 }
 
+SIMD_API void SimdSynetConvolution32fTune(void * context, const float * src, float * buf, float * dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetConvolution32f*)context)->Tune(src, buf, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetConvolution32fSetWorkspace(void * context, void * workspace)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetConvolution32f*)context)->SetWorkspace((SynetWorkspace*)workspace);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void* SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
@@ -6171,6 +6444,26 @@ SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src
 #endif
 }
 
+SIMD_API void SimdSynetDeconvolution32fTune(void * context, const float * src, float * buf, float * dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetDeconvolution32f*)context)->Tune(src, buf, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetDeconvolution32fSetWorkspace(void * context, void * workspace)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetDeconvolution32f*)context)->SetWorkspace((SynetWorkspace*)workspace);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst)
 {
     SIMD_EMPTY();
@@ -6482,6 +6775,16 @@ SIMD_API void SimdSynetMergedConvolution32fForward(void * context, const float *
 #endif
 }
 
+SIMD_API void SimdSynetMergedConvolution32fSetWorkspace(void * context, void * workspace)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetMergedConvolution32f*)context)->SetWorkspace((SynetWorkspace*)workspace);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void* SimdSynetMergedConvolution8iInit(size_t batch, const SimdConvolutionParameters* convs, size_t count, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
@@ -6819,6 +7122,34 @@ SIMD_API void SimdSynetSetInput(const uint8_t * src, size_t width, size_t height
 #endif
 }
 
+SIMD_API void* SimdSynetInputResizerInit(SimdPixelFormatType srcFormat, SimdYuvLayoutType yuvLayout, SimdYuvType yuvType,
+    size_t cropX, size_t cropY, size_t cropWidth, size_t cropHeight, size_t dstWidth, size_t dstHeight, size_t channels,
+    const float* mean, const float* scale, SimdTensorDataType dstType, SimdTensorFormatType dstFormat)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetInputResizerInitPtr) (SimdPixelFormatType srcFormat, SimdYuvLayoutType yuvLayout, SimdYuvType yuvType,
+        size_t cropX, size_t cropY, size_t cropWidth, size_t cropHeight, size_t dstWidth, size_t dstHeight, size_t channels,
+        const float* mean, const float* scale, SimdTensorDataType dstType, SimdTensorFormatType dstFormat);
+    const static SimdSynetInputResizerInitPtr simdSynetInputResizerInit = SIMD_FUNC3(SynetInputResizerInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdSynetInputResizerInit(srcFormat, yuvLayout, yuvType, cropX, cropY, cropWidth, cropHeight, dstWidth, dstHeight, channels, mean, scale, dstType, dstFormat);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetInputResizerRun(const void* context, const uint8_t* const* src, const size_t* srcStride, uint8_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((Base::SynetInputResizer*)context)->Run(src, srcStride, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetShuffleLayerForward(const float* src0, const float* src1, size_t channels0, size_t channels1, size_t spatial, float* dst0, float* dst1, SimdTensorFormatType format, int type)
 {
     SIMD_EMPTY();
@@ -252,6 +252,16 @@ typedef enum
     SimdCpuInfoNeon, /*!< Availability of NEON (ARM). */
 } SimdCpuInfoType;
 
+/*! @ingroup c_types
+    Describes formats of internal performance report which can return function ::SimdPerformanceReport.
+*/
+typedef enum
+{
+    SimdPerformanceReportText, /*!< A plain text table (the same as ::SimdPerformanceStatistic returns). */
+    SimdPerformanceReportJson, /*!< A JSON with per-thread breakdown, GFLOPS and p50/p90/p99 latencies of every measured function. */
+    SimdPerformanceReportTrace, /*!< A Chrome trace-event timeline (JSON). It contains only spans measured when tracing is enabled by function ::SimdPerformanceTrace. */
+} SimdPerformanceReportType;
+
 /*! @ingroup c_types
     Describes types and flags to get information about classifier cascade with using function ::SimdDetectionInfo.
     \note This type is used for implementation of Simd::Detection.
@@ -291,6 +301,70 @@ typedef enum
     SimdImageFileJpeg,
 } SimdImageFileType;
 
+/*! @ingroup image_io
+    Describes chroma subsampling of image file. It is used in structure ::SimdImageInfo.
+*/
+typedef enum
+{
+    /*! Image has no chroma subsampling (grayscale or RGB image). */
+    SimdImageSubsamplingNone = 0,
+    /*! Chroma planes have full resolution (4:4:4). */
+    SimdImageSubsampling444,
+    /*! Chroma planes have half horizontal resolution (4:2:2). */
+    SimdImageSubsampling422,
+    /*! Chroma planes have half horizontal and half vertical resolution (4:2:0). */
+    SimdImageSubsampling420,
+    /*! Chroma planes have half vertical resolution (4:4:0). */
+    SimdImageSubsampling440,
+    /*! Chroma planes have quarter horizontal resolution (4:1:1). */
+    SimdImageSubsampling411,
+    /*! Other (nonstandard) chroma subsampling. */
+    SimdImageSubsamplingOther,
+} SimdImageSubsamplingType;
+
+/*! @ingroup image_io
+    Describes image parameters which are read from image file header. It is used in ::SimdImageInfoFromMemory and ::SimdImageInfoFromFile.
+*/
+typedef struct SimdImageInfo
+{
+    /*!
+        A format of image file.
+    */
+    SimdImageFileType file;
+    /*!
+        An image width.
+    */
+    size_t width;
+    /*!
+        An image height.
+    */
+    size_t height;
+    /*!
+        A number of channels (color components) of image. For PNG image with palette it is 3 (or 4 if the palette has transparency).
+    */
+    size_t channels;
+    /*!
+        A number of bits per channel.
+    */
+    size_t depth;
+    /*!
+        A chroma subsampling of JPEG image. It is equal to ::SimdImageSubsamplingNone for PNG images.
+    */
+    SimdImageSubsamplingType subsampling;
+    /*!
+        A flag of progressive JPEG or interlaced (Adam7) PNG image.
+    */
+    SimdBool progressive;
+    /*!
+        A restart interval (in MCUs) of JPEG image. It is equal to 0 if image has no restart markers.
+    */
+    size_t restartInterval;
+    /*!
+        An EXIF orientation (from 1 to 8). It is equal to 1 if image has no EXIF orientation tag.
+    */
+    int orientation;
+} SimdImageInfo;
+
 /*! @ingroup c_types
     Describes types of binary operation between two images performed by function ::SimdOperationBinary8u.
     Images must have the same format (unsigned 8-bit integer for every channel).
@@ -433,6 +507,8 @@ typedef enum
     SimdResizeMethodArea,
     /*! Area method for previously reduced in 2 times image. */
     SimdResizeMethodAreaFast,
+    /*! Lanczos method (windowed sinc filter with 3 lobes). */
+    SimdResizeMethodLanczos,
 } SimdResizeMethodType;
 
 /*! @ingroup synet_types
@@ -568,6 +644,16 @@ typedef enum
     SimdYuvTrect871, /*!< Corresponds to T-REC-T.871 standard. Uses Kr=0.299, Kb=0.114. Y, U and V use full range [0..255]. */
 } SimdYuvType;
 
+/*! @ingroup image_io
+    Describes layout of planar YUV image returned by functions ::SimdImageLoadYuvFromMemory and ::SimdImageLoadYuvFromFile.
+*/
+typedef enum
+{
+    SimdYuvLayoutGray8 = 0, /*!< Only Y plane. */
+    SimdYuvLayoutNv12, /*!< Y plane and interleaved UV plane. UV plane has half width and half height of Y plane. */
+    SimdYuvLayoutYuv420p, /*!< Y, U and V planes. U and V planes have half width and half height of Y plane. */
+} SimdYuvLayoutType;
+
 /*! @ingroup synet_types
     Describes convolution (deconvolution) parameters. It is used in ::SimdSynetConvolution32fInit, ::SimdSynetConvolution8iInit, 
     ::SimdSynetDeconvolution32fInit, ::SimdSynetMergedConvolution32fInit and ::SimdSynetMergedConvolution8iInit.
@@ -769,6 +855,73 @@ extern "C"
     */
     SIMD_API const char * SimdPerformanceStatistic();
 
+    /*! @ingroup info
+
+        \fn const char * SimdPerformanceReport(SimdPerformanceReportType type);
+
+        \short Gets internal performance statistics of %Simd Library in given format.
+
+        \note %Simd Library have to be build with defined SIMD_PERFORMANCE_STATISTIC macro.
+
+        \param [in] type - a format of the report (see ::SimdPerformanceReportType).
+        \return string with internal performance statistics of %Simd Library. It is valid until next call of this function or ::SimdPerformanceStatistic.
+    */
+    SIMD_API const char * SimdPerformanceReport(SimdPerformanceReportType type);
+
+    /*! @ingroup info
+
+        \fn void SimdPerformanceTrace(SimdBool enable);
+
+        \short Enables or disables recording of timeline of internal performance measurements (see ::SimdPerformanceReportTrace).
+
+        \note %Simd Library have to be build with defined SIMD_PERFORMANCE_STATISTIC macro. Tracing is disabled by default.
+
+        \param [in] enable - a flag to enable tracing.
+    */
+    SIMD_API void SimdPerformanceTrace(SimdBool enable);
+
+    /*! @ingroup info
+
+        \fn void SimdPerformanceCounters(SimdBool enable);
+
+        \short Enables or disables sampling of hardware counters (cycles, instructions, L1D and LLC cache misses, branch misses) in internal performance measurements.
+
+        If enabled, reports of ::SimdPerformanceStatistic and ::SimdPerformanceReport contain IPC and numbers of misses per call.
+
+        \note %Simd Library have to be build with defined SIMD_PERFORMANCE_STATISTIC macro. It is supported only on Linux (with using of perf_event_open).
+            Unavailable counters are reported as zero. Sampling is disabled by default.
+
+        \param [in] enable - a flag to enable sampling of hardware counters.
+    */
+    SIMD_API void SimdPerformanceCounters(SimdBool enable);
+
+    /*! @ingroup info
+
+        \fn SimdBool SimdRuntimeCacheLoad(const char * path);
+
+        \short Loads cache of runtime autotuning decisions from file.
+
+        Some algorithms of %Simd Library (for example ::SimdGemm32fNN, ::SimdSynetConvolution32fForward, ::SimdSynetDeconvolution32fForward) 
+        choose the fastest implementation by measurement at first calls. The cache stores these decisions and allows to skip measurement 
+        in next runs. The cache is shared by all threads. Entries which were saved on other CPU model are ignored.
+        A malformed file is rejected as a whole and does not change the cache.
+
+        \param [in] path - a path to the cache file.
+        \return a result of the operation.
+    */
+    SIMD_API SimdBool SimdRuntimeCacheLoad(const char * path);
+
+    /*! @ingroup info
+
+        \fn SimdBool SimdRuntimeCacheSave(const char * path);
+
+        \short Saves cache of runtime autotuning decisions to file (see ::SimdRuntimeCacheLoad).
+
+        \param [in] path - a path to the cache file.
+        \return a result of the operation.
+    */
+    SIMD_API SimdBool SimdRuntimeCacheSave(const char * path);
+
     /*! @ingroup memory
 
         \fn void * SimdAllocate(size_t size, size_t align);
@@ -819,6 +972,34 @@ extern "C"
     */
     SIMD_API size_t SimdAlignment();
 
+    /*! @ingroup memory
+
+        \fn void SimdSetAllocationPolicy(size_t hugePageThreshold, int numaNode);
+
+        \short Sets policy of memory allocation used by function ::SimdAllocate and by all internal buffers of %Simd Library 
+            (image buffers of Simd::View and Simd::Frame, weights and temporary buffers of Synet algorithms and others).
+
+        Memory blocks which are not less then given threshold are placed into 2 MB aligned memory regions and marked as candidates for transparent huge pages. 
+        Memory blocks which are not less then 2 MB are bound to given NUMA node. The policy does not affect memory which was allocated earlier.
+
+        \note It is supported only on Linux (with using of madvise and mbind). On other platforms the policy is ignored.
+
+        \param [in] hugePageThreshold - a minimal size of memory block (in bytes) which uses huge pages. Zero value disables usage of huge pages (it is default value).
+        \param [in] numaNode - an index of NUMA node. Negative value disables binding to NUMA node (it is default value).
+    */
+    SIMD_API void SimdSetAllocationPolicy(size_t hugePageThreshold, int numaNode);
+
+    /*! @ingroup memory
+
+        \fn void SimdGetAllocationPolicy(size_t * hugePageThreshold, int * numaNode);
+
+        \short Gets current policy of memory allocation (see ::SimdSetAllocationPolicy).
+
+        \param [out] hugePageThreshold - a pointer to minimal size of memory block which uses huge pages. Can be NULL.
+        \param [out] numaNode - a pointer to index of NUMA node. Can be NULL.
+    */
+    SIMD_API void SimdGetAllocationPolicy(size_t * hugePageThreshold, int * numaNode);
+
     /*! @ingroup memory
 
         \fn void SimdRelease(void * context);
@@ -837,6 +1018,8 @@ extern "C"
 
         \short Gets number of threads used by Simd Library to parallelize some algorithms.
 
+        \note If a thread context is bound to the calling thread (see ::SimdThreadContextBind), the function returns thread number of this context.
+
         \return current thread number.
     */
     SIMD_API size_t SimdGetThreadNumber();
@@ -847,10 +1030,43 @@ extern "C"
 
         \short Sets number of threads used by Simd Library to parallelize some algorithms.
 
+        \note Simd Library uses a process-wide pool of persistent worker threads. This function starts required number of worker threads in advance.
+
         \param [in] threadNumber - a number of threads.
     */
     SIMD_API void SimdSetThreadNumber(size_t threadNumber);
 
+    /*! @ingroup thread
+
+        \fn void * SimdThreadContextCreate(size_t threadNumber, uint64_t affinityMask);
+
+        \short Creates thread context: own pool of worker threads and own thread number.
+
+        Several independent pipelines in one process can use separate thread contexts instead of global thread number (see ::SimdSetThreadNumber).
+        Bind the context to the calling thread with function ::SimdThreadContextBind. Objects created by functions ::SimdWarpAffineInit, ::SimdResizerInit, 
+        ::SimdSynetConvolution32fInit, ::SimdSynetMergedConvolution32fInit and others capture the bound context at creation. 
+        They use thread number and worker threads of this context independently of the thread which runs them.
+        All multithreaded algorithms (::SimdGemm32fNN and others) called from a thread with bound context use worker threads of this context.
+
+        \note The context must be released by function ::SimdRelease. Release the context only when no thread uses it and all objects created with it are released.
+
+        \param [in] threadNumber - a number of threads of the context (including the calling thread).
+        \param [in] affinityMask - a mask of logical CPUs which worker threads of the context are bound to. Zero value means no affinity.
+        \return a pointer to thread context. 
+    */
+    SIMD_API void * SimdThreadContextCreate(size_t threadNumber, uint64_t affinityMask);
+
+    /*! @ingroup thread
+
+        \fn void * SimdThreadContextBind(void * context);
+
+        \short Binds thread context to the calling thread.
+
+        \param [in] context - a thread context created by function ::SimdThreadContextCreate. NULL value restores use of global thread number and global worker threads.
+        \return a previous thread context bound to the calling thread (NULL if there was no bound context).
+    */
+    SIMD_API void * SimdThreadContextBind(void * context);
+
     /*! @ingroup cpu_flags
 
         \fn void SimdEmpty();
@@ -4148,6 +4364,7 @@ extern "C"
             Supported pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
         \param [in] file - a format of output image file. To auto choise format of output file set this parameter to ::SimdImageFileUndefined.
         \param [in] quality - a parameter of compression quality (if file format supports it).
+            For PNG it is a compression level in range [1..9] (1 - the fastest, 9 - the best compression), other values select default level 8.
         \param [out] size - a pointer to the size of output image file in bytes.
         \return a pointer to memory buffer with output image file. 
             It has to be deleted after use by function ::SimdFree. On error it returns NULL.
@@ -4168,6 +4385,7 @@ extern "C"
             Supported pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
         \param [in] file - a format of output image file. To auto choise format of output file set this parameter to ::SimdImageFileUndefined.
         \param [in] quality - a parameter of compression quality (if file format supports it).
+            For PNG it is a compression level in range [1..9] (1 - the fastest, 9 - the best compression), other values select default level 8.
         \param [in] path - a path to output image file.
         \return result of the operation.
     */
@@ -4216,6 +4434,95 @@ extern "C"
     SIMD_API uint8_t* SimdYuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, 
         size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
+    /*! @ingroup image_io
+
+        \fn void * SimdJpegEncoderInit(size_t width, size_t height, SimdPixelFormatType format, int quality, SimdYuvType yuvType);
+
+        \short Creates JPEG encoder context for a sequence of images of the same size and format (for example MJPEG stream).
+
+        The context keeps quantization tables, file header, internal buffers and thread number (see ::SimdGetThreadNumber) between calls,
+        so encoding of every next frame with functions ::SimdJpegEncoderRun, ::SimdJpegEncoderRunNv12 and ::SimdJpegEncoderRunYuv420p 
+        does not allocate memory.
+
+        An using example (encoding of NV12 stream):
+        \verbatim
+        void * encoder = SimdJpegEncoderInit(width, height, SimdPixelFormatNone, 85, SimdYuvTrect871);
+        if (encoder)
+        {
+            for(size_t i = 0; i < frames; ++i)
+            {
+                size_t size = SimdJpegEncoderRunNv12(encoder, y[i], yStride, uv[i], uvStride, dst, capacity);
+                ...
+            }
+            SimdRelease(encoder);
+        }
+        \endverbatim
+
+        \note The context must be released by function ::SimdRelease.
+
+        \param [in] width - a width of input image.
+        \param [in] height - a height of input image.
+        \param [in] format - a pixel format of input image (used if yuvType is ::SimdYuvUnknown). 
+            Supported formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
+        \param [in] quality - a parameter of compression quality.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). 
+            ::SimdYuvUnknown means that input image has given pixel format. Otherwise only ::SimdYuvTrect871 is supported and width and height must be even.
+        \return a pointer to JPEG encoder context. On error it returns NULL.
+    */
+    SIMD_API void * SimdJpegEncoderInit(size_t width, size_t height, SimdPixelFormatType format, int quality, SimdYuvType yuvType);
+
+    /*! @ingroup image_io
+
+        \fn size_t SimdJpegEncoderRun(void * encoder, const uint8_t * src, size_t stride, uint8_t * dst, size_t capacity);
+
+        \short Encodes image to JPEG with using of context created by function ::SimdJpegEncoderInit (with yuvType equal to ::SimdYuvUnknown).
+
+        \param [in, out] encoder - a JPEG encoder context.
+        \param [in] src - a pointer to pixels data of input image.
+        \param [in] stride - a row size of input image in bytes.
+        \param [out] dst - a pointer to output buffer. Can be NULL.
+        \param [in] capacity - a size of output buffer in bytes.
+        \return a size of output JPEG file in bytes. If it is greater than capacity the output buffer is not changed. On error it returns 0.
+    */
+    SIMD_API size_t SimdJpegEncoderRun(void * encoder, const uint8_t * src, size_t stride, uint8_t * dst, size_t capacity);
+
+    /*! @ingroup image_io
+
+        \fn size_t SimdJpegEncoderRunNv12(void * encoder, const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, uint8_t * dst, size_t capacity);
+
+        \short Encodes image in NV12 format to JPEG with using of context created by function ::SimdJpegEncoderInit (with yuvType equal to ::SimdYuvTrect871).
+
+        \param [in, out] encoder - a JPEG encoder context.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 8-bit image with UV color plane.
+        \param [in] uvStride - a row size of the uv image.
+        \param [out] dst - a pointer to output buffer. Can be NULL.
+        \param [in] capacity - a size of output buffer in bytes.
+        \return a size of output JPEG file in bytes. If it is greater than capacity the output buffer is not changed. On error it returns 0.
+    */
+    SIMD_API size_t SimdJpegEncoderRunNv12(void * encoder, const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, uint8_t * dst, size_t capacity);
+
+    /*! @ingroup image_io
+
+        \fn size_t SimdJpegEncoderRunYuv420p(void * encoder, const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, uint8_t * dst, size_t capacity);
+
+        \short Encodes image in YUV420P format to JPEG with using of context created by function ::SimdJpegEncoderInit (with yuvType equal to ::SimdYuvTrect871).
+
+        \param [in, out] encoder - a JPEG encoder context.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [out] dst - a pointer to output buffer. Can be NULL.
+        \param [in] capacity - a size of output buffer in bytes.
+        \return a size of output JPEG file in bytes. If it is greater than capacity the output buffer is not changed. On error it returns 0.
+    */
+    SIMD_API size_t SimdJpegEncoderRunYuv420p(void * encoder, const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, 
+        const uint8_t * v, size_t vStride, uint8_t * dst, size_t capacity);
+
     /*! @ingroup image_io
 
         \fn uint8_t* SimdImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
@@ -4241,6 +4548,8 @@ extern "C"
 
         \short Loads an image from file.
 
+        The input file is mapped into memory (where the platform supports it) and decoded directly from the mapping without an intermediate copy.
+
         \param [in] path - a path to input image file.
         \param [out] stride - a pointer to row size of output image in bytes.
         \param [out] width - a pointer to width of output image.
@@ -4253,6 +4562,190 @@ extern "C"
     */
     SIMD_API uint8_t* SimdImageLoadFromFile(const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
 
+    /*! @ingroup image_io
+
+        \fn uint8_t* SimdImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+        \short Loads an image from memory buffer with reduction of its size in given number of times.
+
+        For JPEG images the reduction is performed in DCT domain (reduced 4x4, 2x2 or 1x1 IDCT instead of full 8x8 one), 
+        so it is much faster than decoding of full image and its following resizing.
+
+        \param [in] data - a pointer to memory buffer with input image file.
+        \param [in] size - a size of input image file in bytes.
+        \param [in] scale - a scale denominator. It can be 1, 2, 4 or 8. Values 2, 4 and 8 are supported only for JPEG.
+            The size of output image is equal to (input_width + scale - 1) / scale x (input_height + scale - 1) / scale.
+        \param [out] stride - a pointer to row size of output image in bytes.
+        \param [out] width - a pointer to width of output image.
+        \param [out] height - a pointer to height of output image.
+        \param [in, out] format - a pointer to pixel format of output image.
+            Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \return a pointer to pixels data of output image.
+            It has to be deleted after use by function ::SimdFree. On error it returns NULL.
+    */
+    SIMD_API uint8_t* SimdImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+    /*! @ingroup image_io
+
+        \fn uint8_t* SimdImageLoadFromFileScaled(const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+        \short Loads an image from file with reduction of its size in given number of times.
+
+        For JPEG images the reduction is performed in DCT domain (see ::SimdImageLoadFromMemoryScaled).
+
+        \param [in] path - a path to input image file.
+        \param [in] scale - a scale denominator. It can be 1, 2, 4 or 8. Values 2, 4 and 8 are supported only for JPEG.
+        \param [out] stride - a pointer to row size of output image in bytes.
+        \param [out] width - a pointer to width of output image.
+        \param [out] height - a pointer to height of output image.
+        \param [in, out] format - a pointer to pixel format of output image.
+            Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \return a pointer to pixels data of output image.
+            It has to be deleted after use by function ::SimdFree. On error it returns NULL.
+    */
+    SIMD_API uint8_t* SimdImageLoadFromFileScaled(const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageLoadFromMemoryToBuffer(const uint8_t* data, size_t size, uint8_t* dst, size_t dstStride, size_t dstSize, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+        \short Loads an image from memory buffer into output buffer allocated by caller.
+
+        \param [in] data - a pointer to memory buffer with input image file.
+        \param [in] size - a size of input image file in bytes.
+        \param [out] dst - a pointer to pixels data of output image.
+        \param [in] dstStride - a row size of output image in bytes.
+        \param [in] dstSize - a size of output buffer in bytes.
+        \param [out] width - a pointer to width of output image.
+        \param [out] height - a pointer to height of output image.
+        \param [in, out] format - a pointer to pixel format of output image.
+            Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \return a result of the operation. It returns ::SimdFalse if the image can't be decoded or if output buffer is too small 
+            (row size of the image is greater than dstStride or (height - 1) * dstStride + row size is greater than dstSize).
+            In the last case the output buffer is not changed, and width, height and format contain parameters of the image, so the buffer can be reallocated.
+    */
+    SIMD_API SimdBool SimdImageLoadFromMemoryToBuffer(const uint8_t* data, size_t size, uint8_t* dst, size_t dstStride, size_t dstSize, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageLoadFromFileToBuffer(const char* path, uint8_t* dst, size_t dstStride, size_t dstSize, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+        \short Loads an image from file into output buffer allocated by caller (see ::SimdImageLoadFromMemoryToBuffer).
+
+        \param [in] path - a path to input image file.
+        \param [out] dst - a pointer to pixels data of output image.
+        \param [in] dstStride - a row size of output image in bytes.
+        \param [in] dstSize - a size of output buffer in bytes.
+        \param [out] width - a pointer to width of output image.
+        \param [out] height - a pointer to height of output image.
+        \param [in, out] format - a pointer to pixel format of output image.
+            Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \return a result of the operation. It returns ::SimdFalse if the file can't be read or decoded or if output buffer is too small.
+            In the last case width, height and format contain parameters of the image.
+    */
+    SIMD_API SimdBool SimdImageLoadFromFileToBuffer(const char* path, uint8_t* dst, size_t dstStride, size_t dstSize, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+    /*! @ingroup image_io
+
+        \fn uint8_t* SimdImageLoadYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, uint8_t* planes[3], size_t strides[3], size_t* width, size_t* height);
+
+        \short Loads JPEG image from memory buffer directly into planar YUV image.
+
+        The function returns native Y, Cb and Cr planes of JPEG image, so it skips upsampling of chroma planes and YUV to RGB conversion.
+        Output planes have full range ::SimdYuvTrect871 format. 
+        Layouts ::SimdYuvLayoutNv12 and ::SimdYuvLayoutYuv420p require YCbCr image with 4:2:0 subsampling. 
+        Layout ::SimdYuvLayoutGray8 requires image with luma plane of full resolution. 
+        Grayscale JPEG images are compatible with all layouts (U and V planes are filled by 128).
+
+        \param [in] data - a pointer to memory buffer with input JPEG image.
+        \param [in] size - a size of input image in bytes.
+        \param [in] layout - a layout of output planes (see ::SimdYuvLayoutType).
+        \param [out] planes - an array with pointers to output planes. 
+            ::SimdYuvLayoutGray8 uses only planes[0] (Y), ::SimdYuvLayoutNv12 uses planes[0] (Y) and planes[1] (UV), 
+            ::SimdYuvLayoutYuv420p uses planes[0] (Y), planes[1] (U) and planes[2] (V). Unused planes are set to NULL.
+        \param [out] strides - an array with row sizes of output planes in bytes.
+        \param [out] width - a pointer to width of output image (Y plane). U and V planes have (width + 1) / 2 width.
+        \param [out] height - a pointer to height of output image (Y plane). U and V planes have (height + 1) / 2 height.
+        \return a pointer to memory buffer with all output planes (it is equal to planes[0]).
+            It has to be deleted after use by function ::SimdFree. It returns NULL on error or if the image is not compatible with given layout.
+    */
+    SIMD_API uint8_t* SimdImageLoadYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, uint8_t* planes[3], size_t strides[3], size_t* width, size_t* height);
+
+    /*! @ingroup image_io
+
+        \fn uint8_t* SimdImageLoadYuvFromFile(const char* path, SimdYuvLayoutType layout, uint8_t* planes[3], size_t strides[3], size_t* width, size_t* height);
+
+        \short Loads JPEG image from file directly into planar YUV image (see ::SimdImageLoadYuvFromMemory).
+
+        \param [in] path - a path to input JPEG image file.
+        \param [in] layout - a layout of output planes (see ::SimdYuvLayoutType).
+        \param [out] planes - an array with pointers to output planes.
+        \param [out] strides - an array with row sizes of output planes in bytes.
+        \param [out] width - a pointer to width of output image (Y plane).
+        \param [out] height - a pointer to height of output image (Y plane).
+        \return a pointer to memory buffer with all output planes (it is equal to planes[0]).
+            It has to be deleted after use by function ::SimdFree. It returns NULL on error or if the image is not compatible with given layout.
+    */
+    SIMD_API uint8_t* SimdImageLoadYuvFromFile(const char* path, SimdYuvLayoutType layout, uint8_t* planes[3], size_t strides[3], size_t* width, size_t* height);
+
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t dstStride);
+
+        \short Loads region of interest of JPEG image from memory buffer into given output image.
+
+        The function skips IDCT, upsampling and color conversion for MCUs outside of region of interest (with margin of one MCU) 
+        and stops decoding after the last MCU row of the region. 
+        If JPEG image has restart markers then restart intervals outside of region of interest are skipped without entropy decoding.
+        The result is identical to corresponding region of whole decoded image.
+
+        \param [in] data - a pointer to memory buffer with input JPEG image.
+        \param [in] size - a size of input image in bytes.
+        \param [in] left - a left bound of region of interest.
+        \param [in] top - a top bound of region of interest.
+        \param [in] width - a width of region of interest (and output image).
+        \param [in] height - a height of region of interest (and output image).
+        \param [in] format - a pixel format of output image. It can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
+        \param [out] dst - a pointer to pixels data of output image. Its size must be at least width x height.
+        \param [in] dstStride - a row size of output image in bytes. Bytes after the end of each output row are not changed.
+        \return ::SimdTrue on success and ::SimdFalse on error (in particular if region of interest is out of the image).
+    */
+    SIMD_API SimdBool SimdImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t dstStride);
+
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageInfoFromMemory(const uint8_t* data, size_t size, SimdImageInfo* info);
+
+        \short Gets parameters of JPEG or PNG image from memory buffer without image decoding.
+
+        The function parses only headers of image file (SOF, DRI and APP1 (EXIF) segments of JPEG, IHDR, tRNS and eXIf chunks of PNG).
+        It allows to reject or route images and to preallocate buffers before decoding.
+
+        \param [in] data - a pointer to memory buffer with input image file. 
+        \param [in] size - a size of input image file in bytes. It can be less then size of whole file: only headers have to be in the buffer.
+        \param [out] info - a pointer to structure with image parameters (see ::SimdImageInfo).
+        \return ::SimdTrue on success and ::SimdFalse if the buffer doesn't contain valid JPEG or PNG headers.
+    */
+    SIMD_API SimdBool SimdImageInfoFromMemory(const uint8_t* data, size_t size, SimdImageInfo* info);
+
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageInfoFromFile(const char* path, SimdImageInfo* info);
+
+        \short Gets parameters of JPEG or PNG image from file without image decoding (see ::SimdImageInfoFromMemory).
+
+        The function reads only beginning of the file if it contains all headers.
+
+        \param [in] path - a path to input image file.
+        \param [out] info - a pointer to structure with image parameters (see ::SimdImageInfo).
+        \return ::SimdTrue on success and ::SimdFalse on error.
+    */
+    SIMD_API SimdBool SimdImageInfoFromFile(const char* path, SimdImageInfo* info);
+
     /*! @ingroup other_conversion
 
         \fn void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
@@ -5721,6 +6214,9 @@ extern "C"
         }
         \endverbatim
 
+        \note The context uses the current thread number (see ::SimdSetThreadNumber). If the output image is large enough, 
+            it is split into horizontal bands which are processed in parallel by function ::SimdResizerRun.
+
         \param [in] srcX - a width of the input image.
         \param [in] srcY - a height of the input image.
         \param [in] dstX - a width of the output image.
@@ -5748,6 +6244,188 @@ extern "C"
     */
     SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup resizing
+
+        \fn void * SimdResizerRoiInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        \short Creates context of batched crop and resize of regions of interest (ROIAlign-style).
+
+        The context crops several rectangles of one input image and resizes each of them to the same output size.
+        An using example (crop of 100 boxes of BGR24 image to 112x112 patches):
+        \verbatim
+        void * resizer = SimdResizerRoiInit(srcX, srcY, 112, 112, 3, SimdResizeChannelByte, SimdResizeMethodBilinear);
+        if (resizer)
+        {
+             SimdResizerRoiRun(resizer, src, srcStride, rois, 100, dst);
+             SimdRelease(resizer);
+        }
+        \endverbatim
+
+        \note The context uses the current thread number (see ::SimdSetThreadNumber). The rectangles are distributed between threads by function ::SimdResizerRoiRun.
+
+        \param [in] srcX - a width of the input image.
+        \param [in] srcY - a height of the input image.
+        \param [in] dstX - a width of every output image.
+        \param [in] dstY - a height of every output image.
+        \param [in] channels - a channel number of input and output images.
+        \param [in] type - a type of input and output image channel. It can be ::SimdResizeChannelByte or ::SimdResizeChannelFloat.
+        \param [in] method - a method used in order to resize images. Now only ::SimdResizeMethodBilinear is supported.
+        \return a pointer to ROI resize context. On error it returns NULL. 
+                This pointer is used in functions ::SimdResizerRoiRun. 
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdResizerRoiInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizerRoiRun(const void * resizer, const uint8_t * src, size_t srcStride, const float * rois, size_t count, uint8_t * dst);
+
+        \short Performs batched crop and resize of regions of interest.
+
+        Every rectangle is given by 4 float values (left, top, right, bottom) in pixel coordinates of the input image.
+        Output pixel (x, y) of a rectangle samples the input image at point (left + (x + 0.5)*(right - left)/dstX - 0.5, top + (y + 0.5)*(bottom - top)/dstY - 0.5) 
+        with using of bilinear interpolation. Points outside of the input image are clamped to its border.
+        Interpolation coefficients are estimated once for every rectangle.
+
+        \param [in] resizer - a ROI resize context. It must be created by function ::SimdResizerRoiInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in] rois - a pointer to array of rectangles (4 * count float values).
+        \param [in] count - a number of rectangles.
+        \param [out] dst - a pointer to output batch tensor (NHWC format). It is a contiguous array of count output images with size dstY x dstX x channels each.
+    */
+    SIMD_API void SimdResizerRoiRun(const void * resizer, const uint8_t * src, size_t srcStride, const float * rois, size_t count, uint8_t * dst);
+
+    /*! @ingroup resizing
+
+        \fn void * SimdResizerYuvInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdYuvLayoutType layout, SimdResizeMethodType method);
+
+        \short Creates context of planar YUV image resizing (NV12 or YUV420P image is resized as a whole).
+
+        Chroma planes have size ((width + 1) / 2) x ((height + 1) / 2) and are resized with the same geometry as luma plane, 
+        so every chroma sample stays at the center of its 2x2 block of luma samples (the same siting is used by YUV to BGR conversion functions).
+        An using example (resize of NV12 frame):
+        \verbatim
+        void * resizer = SimdResizerYuvInit(srcX, srcY, dstX, dstY, SimdYuvLayoutNv12, SimdResizeMethodArea);
+        if (resizer)
+        {
+             const uint8_t * src[2] = { srcY, srcUv };
+             size_t srcStride[2] = { srcYStride, srcUvStride };
+             uint8_t * dst[2] = { dstY, dstUv };
+             size_t dstStride[2] = { dstYStride, dstUvStride };
+             SimdResizerYuvRun(resizer, src, srcStride, dst, dstStride);
+             SimdRelease(resizer);
+        }
+        \endverbatim
+
+        \note The context uses the current thread number (see ::SimdSetThreadNumber). All planes are split into horizontal bands 
+            which are processed in parallel by one call of function ::SimdResizerYuvRun.
+
+        \param [in] srcX - a width of the input image (Y plane).
+        \param [in] srcY - a height of the input image (Y plane).
+        \param [in] dstX - a width of the output image (Y plane).
+        \param [in] dstY - a height of the output image (Y plane).
+        \param [in] layout - a layout of image planes (see ::SimdYuvLayoutType).
+        \param [in] method - a method used in order to resize image.
+        \return a pointer to YUV resize context. On error it returns NULL. 
+                This pointer is used in functions ::SimdResizerYuvRun. 
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdResizerYuvInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdYuvLayoutType layout, SimdResizeMethodType method);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizerYuvRun(const void * resizer, const uint8_t * const * src, const size_t * srcStride, uint8_t * const * dst, const size_t * dstStride);
+
+        \short Performs resizing of planar YUV image.
+
+        \param [in] resizer - a YUV resize context. It must be created by function ::SimdResizerYuvInit and released by function ::SimdRelease.
+        \param [in] src - an array with pointers to input planes. 
+            ::SimdYuvLayoutGray8 uses only src[0] (Y), ::SimdYuvLayoutNv12 uses src[0] (Y) and src[1] (UV), 
+            ::SimdYuvLayoutYuv420p uses src[0] (Y), src[1] (U) and src[2] (V).
+        \param [in] srcStride - an array with row sizes (in bytes) of input planes.
+        \param [out] dst - an array with pointers to output planes (the same layout as input planes).
+        \param [in] dstStride - an array with row sizes (in bytes) of output planes.
+    */
+    SIMD_API void SimdResizerYuvRun(const void * resizer, const uint8_t * const * src, const size_t * srcStride, uint8_t * const * dst, const size_t * dstStride);
+
+    /*! @ingroup resizing
+
+        \fn SimdBool SimdResizerCacheRun(const uint8_t * src, size_t srcX, size_t srcY, size_t srcStride, uint8_t * dst, size_t dstX, size_t dstY, size_t dstStride, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        \short Performs image resizing with using of process-wide cache of resize contexts.
+
+        The function takes a resize context with the same parameters (input and output sizes, channels, type, method and current thread number) 
+        from the cache or creates it with using of function ::SimdResizerInit. After resizing the context is returned to the cache, 
+        so repeated resizing with the same geometry does not estimate interpolation tables and does not allocate memory. 
+        The cache is thread safe: a context is used by one thread at a time. Least recently used contexts are released 
+        when the cache is full (see ::SimdResizerCacheSetCapacity).
+
+        \note This function is used in C++ wrapper Simd::Resize(const View<A> & src, View<A> & dst, ::SimdResizeMethodType method).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcX - a width of the input image.
+        \param [in] srcY - a height of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the resized output image.
+        \param [in] dstX - a width of the output image.
+        \param [in] dstY - a height of the output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+        \param [in] channels - a channel number of input and output image.
+        \param [in] type - a type of input and output image channel.
+        \param [in] method - a method used in order to resize image.
+        \return result of the operation. It returns ::SimdFalse if the parameters are not supported.
+    */
+    SIMD_API SimdBool SimdResizerCacheRun(const uint8_t * src, size_t srcX, size_t srcY, size_t srcStride, uint8_t * dst, size_t dstX, size_t dstY, size_t dstStride, 
+        size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+    /*! @ingroup resizing
+
+        \fn SimdBool SimdResizerYuvCacheRun(const uint8_t * const * src, size_t srcX, size_t srcY, const size_t * srcStride, uint8_t * const * dst, size_t dstX, size_t dstY, const size_t * dstStride, SimdYuvLayoutType layout, SimdResizeMethodType method);
+
+        \short Performs planar YUV image resizing with using of process-wide cache of resize contexts.
+
+        It is analogue of function ::SimdResizerCacheRun for contexts created by function ::SimdResizerYuvInit.
+
+        \note This function is used in C++ wrappers Simd::ResizeNv12 and Simd::ResizeYuv420p.
+
+        \param [in] src - an array with pointers to input planes (see ::SimdResizerYuvRun).
+        \param [in] srcX - a width of the input image (Y plane).
+        \param [in] srcY - a height of the input image (Y plane).
+        \param [in] srcStride - an array with row sizes (in bytes) of input planes.
+        \param [out] dst - an array with pointers to output planes.
+        \param [in] dstX - a width of the output image (Y plane).
+        \param [in] dstY - a height of the output image (Y plane).
+        \param [in] dstStride - an array with row sizes (in bytes) of output planes.
+        \param [in] layout - a layout of image planes (see ::SimdYuvLayoutType).
+        \param [in] method - a method used in order to resize image.
+        \return result of the operation. It returns ::SimdFalse if the parameters are not supported.
+    */
+    SIMD_API SimdBool SimdResizerYuvCacheRun(const uint8_t * const * src, size_t srcX, size_t srcY, const size_t * srcStride, uint8_t * const * dst, size_t dstX, size_t dstY, const size_t * dstStride, 
+        SimdYuvLayoutType layout, SimdResizeMethodType method);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizerCacheSetCapacity(size_t capacity);
+
+        \short Sets maximal number of resize contexts in the cache used by functions ::SimdResizerCacheRun and ::SimdResizerYuvCacheRun.
+
+        Least recently used contexts are released if the cache contains more contexts. Zero capacity disables caching. Default capacity is 16.
+
+        \param [in] capacity - a maximal number of cached resize contexts.
+    */
+    SIMD_API void SimdResizerCacheSetCapacity(size_t capacity);
+
+    /*! @ingroup resizing
+
+        \fn size_t SimdResizerCacheGetCapacity();
+
+        \short Gets maximal number of resize contexts in the cache used by functions ::SimdResizerCacheRun and ::SimdResizerYuvCacheRun.
+
+        \return a capacity of the cache.
+    */
+    SIMD_API size_t SimdResizerCacheGetCapacity();
+
     /*! @ingroup rgb_conversion
 
         \fn void SimdRgbToBgra(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -6722,6 +7400,33 @@ extern "C"
     */
     SIMD_API void SimdSynetConvert8uTo32f(const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility);
 
+    /*! @ingroup synet_other
+
+        \fn void * SimdSynetWorkspaceInit();
+
+        \short Creates workspace which can be shared between several Synet layers.
+
+        Layers are bound to the workspace by functions ::SimdSynetConvolution32fSetWorkspace, ::SimdSynetDeconvolution32fSetWorkspace 
+        and ::SimdSynetMergedConvolution32fSetWorkspace. Every bound layer uses the same temporary buffer of the workspace when its Forward 
+        is called with NULL external buffer, so the size of the buffer is equal to maximal requirement of the layers instead of their sum.
+
+        \note Layers which share a workspace must not be executed at the same time. The workspace must be released after all bound layers.
+
+        \return a pointer to workspace. It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdSynetWorkspaceInit();
+
+    /*! @ingroup synet_other
+
+        \fn size_t SimdSynetWorkspaceSize(const void * workspace);
+
+        \short Gets size (in bytes) of temporary buffer required by layers bound to the workspace.
+
+        \param [in] workspace - a pointer to workspace. It must be created by function ::SimdSynetWorkspaceInit and released by function ::SimdRelease.
+        \return size of temporary buffer in bytes.
+    */
+    SIMD_API size_t SimdSynetWorkspaceSize(const void * workspace);
+
     /*! @ingroup synet_convolution_fp32
 
         \fn void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -6797,6 +7502,32 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void SimdSynetConvolution32fTune(void * context, const float * src, float * buf, float * dst);
+
+        \short Performs forward propagation of FP32 convolution algorithm several times until all its runtime-autotuned parts choose their implementation.
+
+        It allows to exclude autotuning from time critical path. The chosen implementations are stored in runtime cache (see ::SimdRuntimeCacheSave).
+
+        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetConvolution32fExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to output tensor.
+    */
+    SIMD_API void SimdSynetConvolution32fTune(void * context, const float * src, float * buf, float * dst);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void SimdSynetConvolution32fSetWorkspace(void * context, void * workspace);
+
+        \short Sets shared workspace which is used instead of internal buffer when Forward is called with NULL external buffer.
+
+        \param [in, out] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] workspace - a pointer to shared workspace. It must be created by function ::SimdSynetWorkspaceInit. It can be NULL (it restores usage of internal buffer).
+    */
+    SIMD_API void SimdSynetConvolution32fSetWorkspace(void * context, void * workspace);
+
     /*! @ingroup synet_convolution_int8
 
         \fn void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -6947,6 +7678,32 @@ extern "C"
     */
     SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_deconvolution_fp32
+
+        \fn void SimdSynetDeconvolution32fTune(void * context, const float * src, float * buf, float * dst);
+
+        \short Performs forward propagation of FP32 deconvolution algorithm several times until all its runtime-autotuned parts choose their implementation.
+
+        It allows to exclude autotuning from time critical path. The chosen implementations are stored in runtime cache (see ::SimdRuntimeCacheSave).
+
+        \param [in] context - a pointer to FP32 deconvolution context. It must be created by function ::SimdSynetDeconvolution32fInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetDeconvolution32fExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to output tensor.
+    */
+    SIMD_API void SimdSynetDeconvolution32fTune(void * context, const float * src, float * buf, float * dst);
+
+    /*! @ingroup synet_deconvolution_fp32
+
+        \fn void SimdSynetDeconvolution32fSetWorkspace(void * context, void * workspace);
+
+        \short Sets shared workspace which is used instead of internal buffer when Forward is called with NULL external buffer.
+
+        \param [in, out] context - a pointer to FP32 deconvolution context. It must be created by function ::SimdSynetDeconvolution32fInit and released by function ::SimdRelease.
+        \param [in] workspace - a pointer to shared workspace. It must be created by function ::SimdSynetWorkspaceInit. It can be NULL (it restores usage of internal buffer).
+    */
+    SIMD_API void SimdSynetDeconvolution32fSetWorkspace(void * context, void * workspace);
+
     /*! @ingroup synet_other
 
         \fn void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
@@ -7528,6 +8285,17 @@ extern "C"
     */
     SIMD_API void SimdSynetMergedConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_merged_convolution_fp32
+
+        \fn void SimdSynetMergedConvolution32fSetWorkspace(void * context, void * workspace);
+
+        \short Sets shared workspace which is used instead of internal buffer when Forward is called with NULL external buffer.
+
+        \param [in, out] context - a pointer to FP32 merged convolution context. It must be created by function ::SimdSynetMergedConvolution32fInit and released by function ::SimdRelease.
+        \param [in] workspace - a pointer to shared workspace. It must be created by function ::SimdSynetWorkspaceInit. It can be NULL (it restores usage of internal buffer).
+    */
+    SIMD_API void SimdSynetMergedConvolution32fSetWorkspace(void * context, void * workspace);
+
     /*! @ingroup synet_merged_convolution_int8
 
         \fn void * SimdSynetMergedConvolution8iInit(size_t batch, const SimdConvolutionParameters* convs, size_t count, SimdSynetCompatibilityType compatibility);
@@ -8055,6 +8823,65 @@ extern "C"
     SIMD_API void SimdSynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat, 
         const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
 
+    /*! @ingroup synet_conversion
+
+        \fn void * SimdSynetInputResizerInit(SimdPixelFormatType srcFormat, SimdYuvLayoutType yuvLayout, SimdYuvType yuvType, size_t cropX, size_t cropY, size_t cropWidth, size_t cropHeight, size_t dstWidth, size_t dstHeight, size_t channels, const float * mean, const float * scale, SimdTensorDataType dstType, SimdTensorFormatType dstFormat);
+
+        \short Initilizes context of fused conversion of image to the input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        The context crops given rectangle of input image, resizes it to the size of the output tensor (bilinear interpolation), 
+        converts pixel format, normalizes values and stores them in the output tensor with required layout and data type. 
+        All these steps are performed in one pass without intermediate images (see ::SimdSynetInputResizerRun).
+
+        Algorithm's details (example for NCHW tensor format):
+        \verbatim
+        for(c = 0; c < channels; ++c)
+            for(y = 0; y < dstHeight; ++y)
+                for(x = 0; x < dstWidth; ++x)
+                    dst[(c*dstHeight + y)*dstWidth + x] = Cast((Bilinear(crop, x, y, c) - mean[c])*scale[c]);
+        \endverbatim
+
+        Where Bilinear(crop, x, y, c) is a value of channel c (in BGR order, or gray for 1-channel output) of cropped image resized with bilinear interpolation, 
+        Cast is a conversion to output data type (rounding and saturation for ::SimdTensorData8u). 
+        Note that quantization with zero point Z is performed if mean[c] is set to (mean[c] - Z/scale[c]).
+
+        \param [in] srcFormat - a pixel format of input image. There are supported following pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, 
+            ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32. ::SimdPixelFormatNone means planar YUV input image with given layout.
+        \param [in] yuvLayout - a layout of planar YUV input image (::SimdYuvLayoutGray8, ::SimdYuvLayoutNv12 or ::SimdYuvLayoutYuv420p). It is used only if srcFormat is ::SimdPixelFormatNone.
+        \param [in] yuvType - a type of YUV to BGR conversion. It is used only for ::SimdYuvLayoutNv12 and ::SimdYuvLayoutYuv420p.
+        \param [in] cropX - a left column of cropped rectangle of input image.
+        \param [in] cropY - a top row of cropped rectangle of input image.
+        \param [in] cropWidth - a width of cropped rectangle of input image.
+        \param [in] cropHeight - a height of cropped rectangle of input image.
+        \param [in] dstWidth - a width of output image tensor.
+        \param [in] dstHeight - a height of output image tensor.
+        \param [in] channels - a number of channels in the output image tensor. It can be 1 or 3.
+        \param [in] mean - a pointer to the array with mean values of channels. Can be NULL (zero mean).
+        \param [in] scale - a pointer to the array with scale of channels. Can be NULL (unit scale).
+        \param [in] dstType - a data type of output tensor. It can be ::SimdTensorData32f, ::SimdTensorData16b or ::SimdTensorData8u.
+        \param [in] dstFormat - a format of output image tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \return a pointer to context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in function ::SimdSynetInputResizerRun.
+    */
+    SIMD_API void * SimdSynetInputResizerInit(SimdPixelFormatType srcFormat, SimdYuvLayoutType yuvLayout, SimdYuvType yuvType, 
+        size_t cropX, size_t cropY, size_t cropWidth, size_t cropHeight, size_t dstWidth, size_t dstHeight, size_t channels,
+        const float * mean, const float * scale, SimdTensorDataType dstType, SimdTensorFormatType dstFormat);
+
+    /*! @ingroup synet_conversion
+
+        \fn void SimdSynetInputResizerRun(const void * context, const uint8_t * const * src, const size_t * srcStride, uint8_t * dst);
+
+        \short Performs fused crop, resize, conversion and normalization of image to the input of neural network.
+
+        \param [in] context - a context created by function ::SimdSynetInputResizerInit.
+        \param [in] src - a pointer to the array of pointers to planes of input image (coordinates of cropped rectangle are relative to them). 
+            Packed pixel formats and ::SimdYuvLayoutGray8 use src[0], ::SimdYuvLayoutNv12 uses src[0] (Y) and src[1] (UV), 
+            ::SimdYuvLayoutYuv420p uses src[0] (Y), src[1] (U) and src[2] (V).
+        \param [in] srcStride - a pointer to the array of row sizes of planes of input image.
+        \param [out] dst - a pointer to the output image tensor.
+    */
+    SIMD_API void SimdSynetInputResizerRun(const void * context, const uint8_t * const * src, const size_t * srcStride, uint8_t * dst);
+
     /*! @ingroup synet_other
 
         \fn void SimdSynetShuffleLayerForward(const float * src0, const float * src1, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format, int type);
@@ -3367,6 +3367,8 @@ namespace Simd
 
         All images must have the same format.
 
+        \note This function is a C++ wrapper for function ::SimdResizerCacheRun (resize contexts are reused between calls with the same geometry).
+
         \param [in] src - an original input image.
         \param [out] dst - a resized output image.
         \param [in] method - a resizing method. By default it is equal to ::SimdResizeMethodBilinear.
@@ -3382,13 +3384,7 @@ namespace Simd
         else
         {
             SimdResizeChannelType type = src.format == View<A>::Float ? SimdResizeChannelFloat : (src.ChannelSize() == 2 ? SimdResizeChannelShort : SimdResizeChannelByte);
-            void * resizer = SimdResizerInit(src.width, src.height, dst.width, dst.height, src.ChannelCount(), type, method);
-            if (resizer)
-            {
-                SimdResizerRun(resizer, src.data, src.stride, dst.data, dst.stride);
-                SimdRelease(resizer);
-            }
-            else
+            if (!SimdResizerCacheRun(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride, src.ChannelCount(), type, method))
                 assert(0);
         }
     }
@@ -3425,6 +3421,68 @@ namespace Simd
         }
     }
 
+    /*! @ingroup resizing
+
+        \fn void ResizeNv12(const View<A>& srcY, const View<A>& srcUv, View<A>& dstY, View<A>& dstUv, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear)
+
+        \short Performs resizing of NV12 image (all planes in one call).
+
+        Y planes must have 8-bit gray format, UV planes must have 16-bit UV format and size ((width + 1) / 2) x ((height + 1) / 2) of corresponding Y plane.
+
+        \note This function is a C++ wrapper for function ::SimdResizerYuvCacheRun.
+
+        \param [in] srcY - an input 8-bit Y plane.
+        \param [in] srcUv - an input 16-bit UV plane.
+        \param [out] dstY - an output 8-bit Y plane.
+        \param [out] dstUv - an output 16-bit UV plane.
+        \param [in] method - a resizing method. By default it is equal to ::SimdResizeMethodBilinear.
+    */
+    template<template<class> class A> SIMD_INLINE void ResizeNv12(const View<A>& srcY, const View<A>& srcUv, View<A>& dstY, View<A>& dstUv, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear)
+    {
+        assert(srcY.format == View<A>::Gray8 && srcUv.format == View<A>::Uv16 && dstY.format == View<A>::Gray8 && dstUv.format == View<A>::Uv16);
+        assert(srcUv.width == (srcY.width + 1) / 2 && srcUv.height == (srcY.height + 1) / 2 && dstUv.width == (dstY.width + 1) / 2 && dstUv.height == (dstY.height + 1) / 2);
+
+        const uint8_t* src[2] = { srcY.data, srcUv.data };
+        size_t srcStride[2] = { srcY.stride, srcUv.stride };
+        uint8_t* dst[2] = { dstY.data, dstUv.data };
+        size_t dstStride[2] = { dstY.stride, dstUv.stride };
+        if (!SimdResizerYuvCacheRun(src, srcY.width, srcY.height, srcStride, dst, dstY.width, dstY.height, dstStride, SimdYuvLayoutNv12, method))
+            assert(0);
+    }
+
+    /*! @ingroup resizing
+
+        \fn void ResizeYuv420p(const View<A>& srcY, const View<A>& srcU, const View<A>& srcV, View<A>& dstY, View<A>& dstU, View<A>& dstV, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear)
+
+        \short Performs resizing of YUV420P image (all planes in one call).
+
+        All planes must have 8-bit gray format. U and V planes must have size ((width + 1) / 2) x ((height + 1) / 2) of corresponding Y plane.
+
+        \note This function is a C++ wrapper for function ::SimdResizerYuvCacheRun.
+
+        \param [in] srcY - an input 8-bit Y plane.
+        \param [in] srcU - an input 8-bit U plane.
+        \param [in] srcV - an input 8-bit V plane.
+        \param [out] dstY - an output 8-bit Y plane.
+        \param [out] dstU - an output 8-bit U plane.
+        \param [out] dstV - an output 8-bit V plane.
+        \param [in] method - a resizing method. By default it is equal to ::SimdResizeMethodBilinear.
+    */
+    template<template<class> class A> SIMD_INLINE void ResizeYuv420p(const View<A>& srcY, const View<A>& srcU, const View<A>& srcV, View<A>& dstY, View<A>& dstU, View<A>& dstV, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear)
+    {
+        assert(srcY.format == View<A>::Gray8 && srcU.format == View<A>::Gray8 && srcV.format == View<A>::Gray8);
+        assert(dstY.format == View<A>::Gray8 && dstU.format == View<A>::Gray8 && dstV.format == View<A>::Gray8);
+        assert(EqualSize(srcU, srcV) && srcU.width == (srcY.width + 1) / 2 && srcU.height == (srcY.height + 1) / 2);
+        assert(EqualSize(dstU, dstV) && dstU.width == (dstY.width + 1) / 2 && dstU.height == (dstY.height + 1) / 2);
+
+        const uint8_t* src[3] = { srcY.data, srcU.data, srcV.data };
+        size_t srcStride[3] = { srcY.stride, srcU.stride, srcV.stride };
+        uint8_t* dst[3] = { dstY.data, dstU.data, dstV.data };
+        size_t dstStride[3] = { dstY.stride, dstU.stride, dstV.stride };
+        if (!SimdResizerYuvCacheRun(src, srcY.width, srcY.height, srcStride, dst, dstY.width, dstY.height, dstStride, SimdYuvLayoutYuv420p, method))
+            assert(0);
+    }
+
     /*! @ingroup rgb_conversion
 
         \fn void RgbToBgr(const View<A> & rgb, View<A> & bgr)
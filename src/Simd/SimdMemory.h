@@ -108,6 +108,17 @@ namespace Simd
     const uint8_t NO_MANS_LAND_WATERMARK = 0x55;
 #endif
 
+    namespace Base
+    {
+        void SetAllocationPolicy(size_t hugePageThreshold, int numaNode);
+
+        void GetAllocationPolicy(size_t * hugePageThreshold, int * numaNode);
+
+        size_t AllocationAlign(size_t size, size_t align);
+
+        void AllocationAdvise(void * ptr, size_t size);
+    }
+
     SIMD_INLINE void* Allocate(size_t size, size_t align = SIMD_ALIGN)
     {
 #ifdef SIMD_NO_MANS_LAND
@@ -119,11 +130,13 @@ namespace Simd
 #elif defined(__MINGW32__) || defined(__MINGW64__)
         ptr = __mingw_aligned_malloc(size, align);
 #elif defined(__GNUC__)
-        align = AlignHi(align, sizeof(void*));
+        align = AlignHi(Base::AllocationAlign(size, align), sizeof(void*));
         size = AlignHi(size, align);
         int result = ::posix_memalign(&ptr, align, size);
         if (result != 0)
             ptr = NULL;
+        else
+            Base::AllocationAdvise(ptr, size);
 #else
         ptr = malloc(size);
 #endif
@@ -269,6 +269,21 @@ namespace Simd
             }
         }
 
+        SIMD_INLINE void FillBitsFast()
+        {
+#if !defined(SIMD_BIG_ENDIAN)
+            static const size_t bufferBits = sizeof(_bitBuffer) * 8;
+            if (_pos + sizeof(_bitBuffer) <= _size)
+            {
+                _bitBuffer |= *(const decltype(_bitBuffer)*)(_data + _pos) << _bitCount;
+                _pos += (bufferBits - 1 - _bitCount) >> 3;
+                _bitCount |= bufferBits - 8;
+            }
+            else
+#endif
+                FillBits();
+        }
+
         SIMD_INLINE void ClearBits()
         {
             _pos -= _bitCount / 8;
@@ -26,13 +26,244 @@
 
 #include <vector>
 #include <thread>
+#include <algorithm>
 #ifndef SIMD_FUTURE_DISABLE
-#include <future>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
 #endif
 
 namespace Simd
 {
-    template<class Function> inline void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockAlign = 1)
+#ifndef SIMD_FUTURE_DISABLE
+    /*! \short ThreadPool is a pool of persistent worker threads used by function Simd::Parallel.
+
+        Every call of ThreadPool::Run splits a range into blocks, distributes blocks between logical threads and
+        lets idle logical threads steal blocks of other ones. The calling thread participates in the work and
+        executes logical threads which were not picked up by workers, so nested and concurrent calls never block each other.
+        Besides global pool there can be pools bound to separate threads (see ThreadPool::Current).
+    */
+    class ThreadPool
+    {
+    public:
+        typedef void(*Task)(const void * context, size_t thread, size_t begin, size_t end);
+        typedef void(*Start)(const void * context, size_t worker);
+
+        /*!
+            Gets process-wide thread pool.
+
+            \return a reference to global thread pool.
+        */
+        static ThreadPool & Global()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        /*!
+            Gets a reference to pointer to thread pool bound to the calling thread.
+            Worker threads are bound to their own pool. NULL value means global pool.
+
+            \return a reference to pointer to thread pool bound to the calling thread.
+        */
+        static ThreadPool *& Current()
+        {
+            static thread_local ThreadPool * current = NULL;
+            return current;
+        }
+
+        /*!
+            Gets thread pool bound to the calling thread or global thread pool.
+
+            \return a reference to thread pool.
+        */
+        static ThreadPool & Instance()
+        {
+            ThreadPool * current = Current();
+            return current ? *current : Global();
+        }
+
+        /*!
+            Creates thread pool.
+
+            \param [in] start - a pointer to function which is called by every worker thread at its start. It can be NULL.
+            \param [in] context - a pointer to context of start function.
+        */
+        ThreadPool(Start start = NULL, const void * context = NULL)
+            : _stop(false)
+            , _start(start)
+            , _context(context)
+        {
+        }
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _wake.notify_all();
+            for (size_t i = 0; i < _workers.size(); ++i)
+                _workers[i].join();
+        }
+
+        /*!
+            Gets current number of worker threads.
+
+            \return a number of worker threads.
+        */
+        size_t Size()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _workers.size();
+        }
+
+        /*!
+            Starts additional worker threads if current number of workers is less then given value.
+
+            \param [in] size - a required number of worker threads.
+        */
+        void Reserve(size_t size)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            while (_workers.size() < size)
+                _workers.push_back(std::thread(&ThreadPool::Work, this, _workers.size()));
+        }
+
+        /*!
+            Executes task for range [begin, end) split into blocks of given size.
+
+            \param [in] begin - a begin of the range.
+            \param [in] end - an end of the range.
+            \param [in] blockSize - a size of block (the last block can be smaller).
+            \param [in] threadNumber - a number of logical threads. Every logical thread is executed at most by one system thread at the same time.
+            \param [in] task - a pointer to task function which is called for every block.
+            \param [in] context - a pointer to context of the task.
+        */
+        void Run(size_t begin, size_t end, size_t blockSize, size_t threadNumber, Task task, const void * context)
+        {
+            Job job(begin, end, blockSize, threadNumber, task, context);
+            if (job.threads > 1)
+            {
+                Reserve(job.threads - 1);
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _jobs.push_back(&job);
+                }
+                for (size_t i = 1; i < job.threads; ++i)
+                    _wake.notify_one();
+            }
+            for (size_t thread; (thread = job.claimed.fetch_add(1)) < job.threads;)
+                job.Execute(thread);
+            if (job.threads > 1)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                std::deque<Job*>::iterator it = std::find(_jobs.begin(), _jobs.end(), &job);
+                if (it != _jobs.end())
+                    _jobs.erase(it);
+            }
+            job.Wait();
+        }
+
+    private:
+        struct Slot
+        {
+            std::atomic<size_t> next;
+            size_t last;
+            char pad[64];
+        };
+
+        struct Job
+        {
+            size_t begin, end, blockSize, blocks, threads, done;
+            Task task;
+            const void * context;
+            std::vector<Slot> slots;
+            std::atomic<size_t> claimed;
+            std::mutex mutex;
+            std::condition_variable finished;
+
+            Job(size_t b, size_t e, size_t s, size_t t, Task f, const void * c)
+                : begin(b), end(e), blockSize(s), blocks((e - b + s - 1) / s)
+                , threads(std::max<size_t>(std::min(t, blocks), 1)), done(0)
+                , task(f), context(c), slots(threads), claimed(0)
+            {
+                for (size_t i = 0; i < threads; ++i)
+                {
+                    slots[i].next = blocks * i / threads;
+                    slots[i].last = blocks * (i + 1) / threads;
+                }
+            }
+
+            void Execute(size_t thread)
+            {
+                for (size_t i = 0; i < threads; ++i)
+                {
+                    Slot & slot = slots[(thread + i) % threads];
+                    for (size_t block; (block = slot.next.fetch_add(1)) < slot.last;)
+                    {
+                        size_t blockBegin = begin + block * blockSize;
+                        task(context, thread, blockBegin, std::min(blockBegin + blockSize, end));
+                    }
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                if (++done == threads)
+                    finished.notify_one();
+            }
+
+            void Wait()
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                finished.wait(lock, [this] { return done == threads; });
+            }
+        };
+
+        void Work(size_t worker)
+        {
+            Current() = this;
+            if (_start)
+                _start(_context, worker);
+            std::unique_lock<std::mutex> lock(_mutex);
+            for (;;)
+            {
+                _wake.wait(lock, [this] { return _stop || !_jobs.empty(); });
+                if (_stop)
+                    return;
+                Job * job = _jobs.front();
+                size_t thread = job->claimed.fetch_add(1);
+                if (thread + 1 >= job->threads)
+                    _jobs.pop_front();
+                if (thread >= job->threads)
+                    continue;
+                lock.unlock();
+                job->Execute(thread);
+                lock.lock();
+            }
+        }
+
+        bool _stop;
+        Start _start;
+        const void * _context;
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::deque<Job*> _jobs;
+        std::vector<std::thread> _workers;
+    };
+#endif
+
+    /*! \fn void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockAlign = 1, size_t granularity = 1)
+
+        \short Executes function for range [begin, end) in parallel with using of ThreadPool bound to the calling thread (global ThreadPool by default).
+
+        \param [in] begin - a begin of the range.
+        \param [in] end - an end of the range.
+        \param [in] function - a function with signature void(size_t thread, size_t begin, size_t end).
+        \param [in] threadNumber - a maximal number of threads. Parameter thread of the function is always less then this value.
+        \param [in] blockAlign - an alignment of block size. By default it is equal to 1.
+        \param [in] granularity - a number of blocks per thread. Greater values improve load balancing by work stealing. By default it is equal to 1.
+    */
+    template<class Function> inline void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockAlign = 1, size_t granularity = 1)
     {
 #ifdef SIMD_FUTURE_DISABLE
         function(0, begin, end);
@@ -43,22 +274,17 @@ namespace Simd
             function(0, begin, end);
         else
         {
-            std::vector<std::future<void>> futures;
-
-            size_t blockSize = (end - begin + threadNumber - 1) / threadNumber;
+            size_t blockNumber = threadNumber * std::max<size_t>(granularity, 1);
+            size_t blockSize = (end - begin + blockNumber - 1) / blockNumber;
             blockSize = (blockSize + blockAlign - 1) / blockAlign * blockAlign;
-            size_t blockBegin = begin;
-            size_t blockEnd = blockBegin + blockSize;
-
-            for (size_t thread = 0; thread < threadNumber && blockBegin < end; ++thread)
+            struct Caller
             {
-                futures.push_back(std::move(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function] { function(thread, blockBegin, blockEnd); })));
-                blockBegin += blockSize;
-                blockEnd = std::min(blockBegin + blockSize, end);
-            }
-
-            for (size_t i = 0; i < futures.size(); ++i)
-                futures[i].wait();
+                static void Call(const void * context, size_t thread, size_t begin, size_t end)
+                {
+                    (*(const Function*)context)(thread, begin, end);
+                }
+            };
+            ThreadPool::Instance().Run(begin, end, blockSize, threadNumber, Caller::Call, &function);
         }
 #endif
     }
@@ -50,8 +50,10 @@ namespace Simd
 #include <iomanip>
 #include <memory>
 #include <map>
+#include <vector>
 #include <thread>
 #include <mutex>
+#include <atomic>
 #include <algorithm>
 
 namespace Simd
@@ -60,10 +62,35 @@ namespace Simd
     {
         class PerformanceMeasurer
         {
+        public:
+            struct Span
+            {
+                int64_t start, finish;
+                Span(int64_t s = 0, int64_t f = 0) : start(s), finish(f) {}
+            };
+            typedef std::vector<Span> Spans;
+
+            enum Counter
+            {
+                Cycles,
+                Instructions,
+                L1dMisses,
+                LlcMisses,
+                BranchMisses,
+                CounterSize
+            };
+
+            static const size_t HIST_SIZE = 256;
+            static const size_t TRACE_MAX = 65536;
+
+        private:
             String	_name;
             int64_t _start, _current, _total, _min, _max;
             int64_t _count, _flop;
-            bool _entered, _paused;
+            bool _entered, _paused, _counted;
+            int64_t _hist[HIST_SIZE];
+            int64_t _counterStart[CounterSize], _counters[CounterSize];
+            Spans _trace;
 
         public:
             PerformanceMeasurer(const String& name = "Unknown", int64_t flop = 0);
@@ -76,11 +103,19 @@ namespace Simd
 
             String Statistic() const;
 
+            String Json() const;
+
             void Combine(const PerformanceMeasurer& other);
 
+            SIMD_INLINE const String & Name() const { return _name; }
+
+            SIMD_INLINE const Spans & Trace() const { return _trace; }
+
         private:
             double Average() const;
             double GFlops() const;
+            double Percentile(double p) const;
+            double PerCall(Counter counter) const;
         };
 
         class PerformanceMeasurerHolder
@@ -123,6 +158,7 @@ namespace Simd
 
             ThreadMap _map;
             mutable std::mutex _mutex;
+            std::atomic<bool> _trace, _counters;
             String _report;
 
             SIMD_INLINE FunctionMap & ThisThread()
@@ -140,6 +176,8 @@ namespace Simd
             static PerformanceMeasurerStorage s_storage;
 
             PerformanceMeasurerStorage()
+                : _trace(false)
+                , _counters(false)
             {
             }
 
@@ -163,7 +201,31 @@ namespace Simd
                 return Get(func + "{ " + desc + " }", flop);
             }
 
+            SIMD_INLINE void SetTrace(bool trace)
+            {
+                _trace = trace;
+            }
+
+            SIMD_INLINE bool Tracing() const
+            {
+                return _trace;
+            }
+
+            SIMD_INLINE void SetCounters(bool counters)
+            {
+                _counters = counters;
+            }
+
+            SIMD_INLINE bool Counting() const
+            {
+                return _counters;
+            }
+
             const char* PerformanceStatistic();
+
+            const char* JsonReport();
+
+            const char* TraceReport();
         };
     }
 }
@@ -27,6 +27,8 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdMath.h"
 
+#include <vector>
+
 #define SIMD_RESIZER_BICUBIC_BITS 7 // 7, 11
 
 namespace Simd
@@ -88,6 +90,12 @@ namespace Simd
                 DivHi(srcW, 2) >= dstW && DivHi(srcH, 2) >= dstH;
         }
 
+        bool IsFilter() const
+        {
+            return method == SimdResizeMethodLanczos || (type != SimdResizeChannelByte && 
+                (method == SimdResizeMethodBicubic || method == SimdResizeMethodArea || method == SimdResizeMethodAreaFast));
+        }
+
         size_t ChannelSize() const
         {
             static const size_t sizes[3] = { 1, 2, 4 };
@@ -107,13 +115,40 @@ namespace Simd
     public:
         Resizer(const ResParam & param)
             : _param(param)
+            , _bands(1)
+            , _bandSize(0)
+        {
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
         {
+            Run(src, srcStride, dst, dstStride, 0, _param.dstH, 0);
         }
 
-        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
+        //Processes output rows [yBeg, yEnd) with using of row buffers of given band. Different bands can be processed in parallel.
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band) = 0;
+
+        void SetBands(size_t bands)
+        {
+            _bands = Simd::Max<size_t>(bands, 1);
+            _buffer.Resize(_bandSize * _bands, true, _param.align);
+        }
 
     protected:
         ResParam _param;
+        size_t _bands, _bandSize;
+        Array8u _buffer;
+
+        void SetBandSize(size_t size)
+        {
+            _bandSize = AlignHi(size, _param.align);
+            _buffer.Resize(_bandSize * _bands, true, _param.align);
+        }
+
+        uint8_t * Buffer(size_t band)
+        {
+            return _buffer.data + band * _bandSize;
+        }
     };
 
     //---------------------------------------------------------------------------------------------
@@ -122,8 +157,8 @@ namespace Simd
     {
         class ResizerNearest : public Resizer
         {
-            void Resize(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
-            template<size_t N> void Resize(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            void Resize(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
+            template<size_t N> void Resize(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
         protected:
             size_t _pixelSize;
             Array32i _ix, _iy;
@@ -134,7 +169,7 @@ namespace Simd
         public:
             ResizerNearest(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -142,13 +177,13 @@ namespace Simd
         class ResizerByteBilinear : public Resizer
         {
         protected:
-            Array32i _ax, _ix, _ay, _iy, _bx[2];
+            Array32i _ax, _ix, _ay, _iy;
 
             void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, int32_t * alphas);
         public:
             ResizerByteBilinear(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -157,19 +192,19 @@ namespace Simd
         {
         protected:
             Array32i _ix, _iy;
-            Array32f _ax, _ay, _bx[2];
+            Array32f _ax, _ay;
 
             void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t* indices, float* alphas);
 
-            template<size_t N> void RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
-            template<size_t N> void RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+            template<size_t N> void RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
+            template<size_t N> void RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
 
-            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
 
         public:
             ResizerShortBilinear(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -178,16 +213,16 @@ namespace Simd
         {
         protected:
             Array32i _ix, _iy;
-            Array32f _ax, _ay, _bx[2];
+            Array32f _ax, _ay;
 
             void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, float * alphas);
 
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride, size_t yBeg, size_t yEnd, float * buf);
 
         public:
             ResizerFloatBilinear(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -199,19 +234,19 @@ namespace Simd
         class ResizerByteBicubic : public Resizer
         {
         protected:
-            Array32i _ix, _iy, _ax, _ay, _bx[4];
+            Array32i _ix, _iy, _ax, _ay;
             size_t _xn, _xt, _sxl;
 
             void EstimateIndexAlpha(size_t sizeS, size_t sizeD, size_t N, Array32i& index, Array32i& alpha);
 
             void Init(bool sparse);
 
-            template<int N> void RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
-            template<int N> void RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            template<int N> void RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
+            template<int N> void RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf);
         public:
             ResizerByteBicubic(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -223,7 +258,7 @@ namespace Simd
         class ResizerByteArea : public Resizer
         {
         protected:
-            Array32i _ax, _ix, _ay, _iy, _by;
+            Array32i _ax, _ix, _ay, _iy;
 
             void EstimateParams(size_t srcSize, size_t dstSize, size_t range, int32_t* alpha, int32_t* index);
         public:
@@ -235,11 +270,11 @@ namespace Simd
         class ResizerByteArea1x1 : public ResizerByteArea
         {
         protected:
-            template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, int32_t* by);
         public:
             ResizerByteArea1x1(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
         
         //---------------------------------------------------------------------------------------------
@@ -247,16 +282,123 @@ namespace Simd
         class ResizerByteArea2x2 : public ResizerByteArea
         {
         protected:
-            template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, int32_t* by);
         public:
             ResizerByteArea2x2(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
+        };
+
+        //---------------------------------------------------------------------------------------------
+
+        const int RESIZER_LANCZOS_SIZE = 3;
+        const size_t RESIZER_FILTER_ALIGN = 4;
+
+        class ResizerFilter : public Resizer
+        {
+        public:
+            typedef void(*RowVertPtr)(const uint8_t* src, size_t srcStride, size_t size, const float* ay, size_t ky, float* dst);
+            typedef void(*RowHorzPtr)(const float* src, size_t width, const int32_t* ix, const float* ax, size_t kx, uint8_t* dst);
+
+            ResizerFilter(const ResParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
+
+        protected:
+            size_t _kx, _ky;
+            Array32i _ix, _iy;
+            Array32f _ax, _ay;
+            RowVertPtr _rowVert;
+            RowHorzPtr _rowHorz;
+
+            void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, size_t align, Array32i& index, Array32f& alpha, size_t& kernel);
         };
 
         //---------------------------------------------------------------------------------------------
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        //---------------------------------------------------------------------------------------------
+
+        typedef void* (*ResizerInitPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        class ResizerParallel : public Resizer
+        {
+        public:
+            ResizerParallel(const ResParam& param, ResizerInitPtr init, size_t threads);
+            virtual ~ResizerParallel();
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
+
+            size_t Bands() const { return _resizer ? _threads : 0; }
+
+        protected:
+            Resizer* _resizer;
+            size_t _threads;
+            void* _context;
+        };
+
+        void * ResizerParallelInit(ResizerInitPtr init, size_t threads, size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        //---------------------------------------------------------------------------------------------
+
+        class ResizerYuv : public Deletable
+        {
+        public:
+            ResizerYuv(ResizerInitPtr init, size_t threads, size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdYuvLayoutType layout, SimdResizeMethodType method);
+            virtual ~ResizerYuv();
+
+            void Run(const uint8_t* const* src, const size_t* srcStride, uint8_t* const* dst, const size_t* dstStride);
+
+            bool Valid() const { return _valid; }
+
+        protected:
+            struct Band
+            {
+                Resizer* resizer;
+                size_t plane, yBeg, yEnd, band;
+            };
+            std::vector<Resizer*> _resizers;
+            std::vector<Band> _bands;
+            size_t _threads;
+            void* _context;
+            bool _valid;
+
+            void AddPlane(ResizerInitPtr init, size_t plane, size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method);
+        };
+
+        void * ResizerYuvInit(ResizerInitPtr init, size_t threads, size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdYuvLayoutType layout, SimdResizeMethodType method);
+
+        //---------------------------------------------------------------------------------------------
+
+        struct ResizerCacheKey
+        {
+            size_t srcX, srcY, dstX, dstY, channels, threads;
+            const void* context;
+            SimdResizeChannelType type;
+            SimdResizeMethodType method;
+            int layout;
+
+            ResizerCacheKey(size_t sx, size_t sy, size_t dx, size_t dy, size_t c, SimdResizeChannelType t, SimdResizeMethodType m, size_t th, const void* cx, int l = -1)
+                : srcX(sx), srcY(sy), dstX(dx), dstY(dy), channels(c), threads(th), context(cx), type(t), method(m), layout(l)
+            {
+            }
+
+            bool operator == (const ResizerCacheKey& other) const
+            {
+                return srcX == other.srcX && srcY == other.srcY && dstX == other.dstX && dstY == other.dstY && channels == other.channels &&
+                    threads == other.threads && context == other.context && type == other.type && method == other.method && layout == other.layout;
+            }
+        };
+
+        void* ResizerCacheAcquire(const ResizerCacheKey& key);
+
+        void ResizerCacheRelease(const ResizerCacheKey& key, void* resizer);
+
+        void ResizerCacheSetCapacity(size_t capacity);
+
+        size_t ResizerCacheGetCapacity();
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -276,12 +418,12 @@ namespace Simd
 
             size_t BlockCountMax(size_t align);
             void EstimateParams();
-            void Shuffle16x1(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
-            void Resize12(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            void Shuffle16x1(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
+            void Resize12(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
         public:
             ResizerNearest(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };   
 
         //---------------------------------------------------------------------------------------------
@@ -290,7 +432,6 @@ namespace Simd
         {
         protected:
             Array8u _ax;
-            Array8u _bx[2];
             size_t _blocks;
             struct Idx
             {
@@ -301,12 +442,12 @@ namespace Simd
 
             size_t BlockCountMax(size_t align);
             void EstimateParams();
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
-            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf);
+            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf);
         public:
             ResizerByteBilinear(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };  
 
         //---------------------------------------------------------------------------------------------
@@ -314,10 +455,10 @@ namespace Simd
         class ResizerShortBilinear : public Base::ResizerShortBilinear
         {
         protected:
-            template<size_t N> void RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
-            template<size_t N> void RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+            template<size_t N> void RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
+            template<size_t N> void RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
 
-            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
         public:
             ResizerShortBilinear(const ResParam& param);
         };
@@ -334,12 +475,12 @@ namespace Simd
 
             void Init(bool sparse);
 
-            template<int N> void RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
-            template<int N> void RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            template<int N> void RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
+            template<int N> void RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf);
         public:
             ResizerByteBicubic(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -347,11 +488,11 @@ namespace Simd
         class ResizerByteArea1x1 : public Base::ResizerByteArea1x1
         {
         protected:
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, int32_t* by);
         public:
             ResizerByteArea1x1(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -359,11 +500,19 @@ namespace Simd
         class ResizerByteArea2x2 : public Base::ResizerByteArea2x2
         {
         protected:
-            template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, int32_t* by);
         public:
             ResizerByteArea2x2(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
+        };
+
+        //---------------------------------------------------------------------------------------------
+
+        class ResizerFilter : public Base::ResizerFilter
+        {
+        public:
+            ResizerFilter(const ResParam& param);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -377,7 +526,7 @@ namespace Simd
     {
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
@@ -395,14 +544,14 @@ namespace Simd
         {
         protected:
             void EstimateParams();
-            void Gather2(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
-            void Gather3(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
-            void Gather4(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
-            void Gather8(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            void Gather2(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
+            void Gather3(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
+            void Gather4(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
+            void Gather8(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
         public:
             ResizerNearest(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -418,28 +567,28 @@ namespace Simd
             Array<Idx> _ixg;
 
             void EstimateParams();
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
-            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf);
+            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf);
         public:
             ResizerByteBilinear(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         class ResizerShortBilinear : public Sse41::ResizerShortBilinear
         {
         protected:
-            template<size_t N> void RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
-            template<size_t N> void RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+            template<size_t N> void RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
+            template<size_t N> void RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
 
-            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
         public:
             ResizerShortBilinear(const ResParam& param);
         };
 
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
@@ -449,12 +598,12 @@ namespace Simd
         class ResizerByteBicubic : public Sse41::ResizerByteBicubic
         {
         protected:
-            template<int N> void RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
-            template<int N> void RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            template<int N> void RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
+            template<int N> void RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf);
         public:
             ResizerByteBicubic(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -462,11 +611,11 @@ namespace Simd
         class ResizerByteArea1x1 : public Sse41::ResizerByteArea1x1
         {
         protected:
-            template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, int32_t* by);
         public:
             ResizerByteArea1x1(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -474,11 +623,19 @@ namespace Simd
         class ResizerByteArea2x2 : public Sse41::ResizerByteArea2x2
         {
         protected:
-            template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, int32_t* by);
         public:
             ResizerByteArea2x2(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
+        };
+
+        //---------------------------------------------------------------------------------------------
+
+        class ResizerFilter : public Sse41::ResizerFilter
+        {
+        public:
+            ResizerFilter(const ResParam& param);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -502,15 +659,15 @@ namespace Simd
             Array<__mmask32> _tail32x2;
 
             void EstimateParams();
-            void Shuffle32x2(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
-            void Gather4(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
-            void Gather8(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            void Shuffle32x2(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
+            void Gather4(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
+            void Gather8(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
         public:
             ResizerNearest(const ResParam& param);
 
             static bool Preferable(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -518,28 +675,28 @@ namespace Simd
         class ResizerByteBilinear : public Avx2::ResizerByteBilinear
         {
         protected:
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
-            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf);
+            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf);
         public:
             ResizerByteBilinear(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         class ResizerShortBilinear : public Avx2::ResizerShortBilinear
         {
         protected:
-            template<size_t N> void RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
-            template<size_t N> void RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+            template<size_t N> void RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
+            template<size_t N> void RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
 
-            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
         public:
             ResizerShortBilinear(const ResParam& param);
         };
 
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
@@ -549,12 +706,12 @@ namespace Simd
         class ResizerByteBicubic : public Avx2::ResizerByteBicubic
         {
         protected:
-            template<int N> void RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
-            template<int N> void RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            template<int N> void RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
+            template<int N> void RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf);
         public:
             ResizerByteBicubic(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -562,11 +719,11 @@ namespace Simd
         class ResizerByteArea1x1 : public Avx2::ResizerByteArea1x1
         {
         protected:
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, int32_t* by);
         public:
             ResizerByteArea1x1(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -574,11 +731,19 @@ namespace Simd
         class ResizerByteArea2x2 : public Avx2::ResizerByteArea2x2
         {
         protected:
-            template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, int32_t* by);
         public:
             ResizerByteArea2x2(const ResParam& param);
 
-            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
+        };
+
+        //---------------------------------------------------------------------------------------------
+
+        class ResizerFilter : public Avx2::ResizerFilter
+        {
+        public:
+            ResizerFilter(const ResParam& param);
         };
 
         //---------------------------------------------------------------------------------------------
@@ -593,7 +758,7 @@ namespace Simd
         class ResizerByteBilinear : public Base::ResizerByteBilinear
         {
         protected:
-            Array8u _ax, _bx[2];
+            Array8u _ax;
             size_t _blocks;
             struct Idx
             {
@@ -604,38 +769,38 @@ namespace Simd
 
             size_t BlockCountMax(size_t align);
             void EstimateParams();
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
-            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf);
+            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, uint8_t* buf);
         public:
             ResizerByteBilinear(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         class ResizerByteArea1x1 : public Base::ResizerByteArea1x1
         {
         protected:
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, int32_t* by);
         public:
             ResizerByteArea1x1(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band);
         };
 
         class ResizerShortBilinear : public Base::ResizerShortBilinear
         {
         protected:
-            template<size_t N> void RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
-            template<size_t N> void RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+            template<size_t N> void RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
+            template<size_t N> void RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd);
 
-            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
         public:
             ResizerShortBilinear(const ResParam& param);
         };
 
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride, size_t yBeg, size_t yEnd, float* buf);
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
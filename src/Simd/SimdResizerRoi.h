@@ -0,0 +1,148 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdResizerRoi_h__
+#define __SimdResizerRoi_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        struct RoiResParam
+        {
+            size_t srcW, srcH, dstW, dstH, channels;
+            SimdResizeChannelType type;
+            SimdResizeMethodType method;
+
+            SIMD_INLINE RoiResParam(size_t sw, size_t sh, size_t dw, size_t dh, size_t c, SimdResizeChannelType t, SimdResizeMethodType m)
+                : srcW(sw), srcH(sh), dstW(dw), dstH(dh), channels(c), type(t), method(m)
+            {
+            }
+
+            SIMD_INLINE bool Valid() const
+            {
+                if (srcW == 0 || srcH == 0 || dstW == 0 || dstH == 0 || channels == 0)
+                    return false;
+                if (type != SimdResizeChannelByte && type != SimdResizeChannelFloat)
+                    return false;
+                return method == SimdResizeMethodBilinear;
+            }
+
+            SIMD_INLINE size_t ChannelSize() const
+            {
+                return type == SimdResizeChannelFloat ? 4 : 1;
+            }
+
+            SIMD_INLINE size_t DstSize() const
+            {
+                return dstW * dstH * channels * ChannelSize();
+            }
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerRoi : public Deletable
+        {
+        public:
+            ResizerRoi(const RoiResParam& param);
+
+            void Run(const uint8_t* src, size_t srcStride, const float* rois, size_t count, uint8_t* dst);
+
+            typedef void (*VertPtr)(const uint8_t* src0, const uint8_t* src1, float alpha, size_t size, float* dst);
+            typedef void (*HorzPtr)(const float* src, const int32_t* ix, const float* ax, size_t width, size_t channels, float* buf, uint8_t* dst);
+
+        protected:
+            struct Buffer
+            {
+                Array32i ix, iy;
+                Array32f ax, ay, row, tmp;
+            };
+
+            void RunRoi(const uint8_t* src, size_t srcStride, const float* roi, uint8_t* dst, Buffer& buf);
+
+            RoiResParam _param;
+            size_t _threads;
+            void* _context;
+            std::vector<Buffer> _buffers;
+            VertPtr _vert;
+            HorzPtr _horz;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerRoiInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class ResizerRoi : public Base::ResizerRoi
+        {
+        public:
+            ResizerRoi(const Base::RoiResParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerRoiInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class ResizerRoi : public Sse41::ResizerRoi
+        {
+        public:
+            ResizerRoi(const Base::RoiResParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerRoiInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        class ResizerRoi : public Avx2::ResizerRoi
+        {
+        public:
+            ResizerRoi(const Base::RoiResParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerRoiInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+    }
+#endif
+}
+
+#endif
@@ -31,8 +31,8 @@
 #include <limits>
 #include <algorithm>
 #include <string>
-#ifdef SIMD_RUNTIME_STATISTIC
 #include <sstream>
+#ifdef SIMD_RUNTIME_STATISTIC
 #include <iostream>
 #include <iomanip>
 #endif
@@ -41,10 +41,24 @@ namespace Simd
 {
     typedef ::std::string String;
 
+    namespace Base
+    {
+        bool RuntimeCacheFind(const String & key, String & name);
+
+        void RuntimeCacheStore(const String & key, const String & name);
+
+        bool RuntimeCacheLoad(const char * path);
+
+        bool RuntimeCacheSave(const char * path);
+
+        void RuntimeCacheClear();
+    }
+
     template <class Func, class Args> struct Runtime
     {
         SIMD_INLINE Runtime()
             : _best(NULL)
+            , _cached(false)
         {
         }
 
@@ -80,6 +94,7 @@ namespace Simd
             for (size_t i = 0; i < funcs.size(); ++i)
                 _candidates.push_back(Candidate(funcs[i]));
             _best = funcs.size() == 1 ? &_candidates[0].func : NULL;
+            _cached = false;
         }
 
         SIMD_INLINE void Run(const Args & args)
@@ -90,6 +105,11 @@ namespace Simd
                 Test(args);
         }
 
+        SIMD_INLINE bool Tuned() const
+        {
+            return _best != NULL || _candidates.empty();
+        }
+
         SIMD_INLINE size_t Size() const
         {
             return _candidates.size();
@@ -140,11 +160,17 @@ namespace Simd
 
         Func * _best;
         Candidates _candidates;
-        String _info;
+        String _info, _key;
+        bool _cached;
 
         SIMD_INLINE void Test(const Args & args)
         {
             assert(_candidates.size());
+            if (!_cached && Cached(args))
+            {
+                _best->Run(args);
+                return;
+            }
             Candidate * current = Current();
             if (current)
             {
@@ -159,10 +185,34 @@ namespace Simd
             else
             {
                 _best = &Best()->func;
+                Base::RuntimeCacheStore(_key, _best->Name());
                 _best->Run(args);
             }
         }
 
+        SIMD_INLINE bool Cached(const Args & args)
+        {
+            _cached = true;
+            std::stringstream key;
+            key << _candidates[0].func.Info(args);
+            for (size_t i = 0; i < _candidates.size(); ++i)
+                key << (i ? "," : " : ") << _candidates[i].func.Name();
+            _key = key.str();
+            String name;
+            if (Base::RuntimeCacheFind(_key, name))
+            {
+                for (size_t i = 0; i < _candidates.size(); ++i)
+                {
+                    if (_candidates[i].func.Name() == name)
+                    {
+                        _best = &_candidates[i].func;
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
         SIMD_INLINE Candidate * Current()
         {
             size_t min = TEST_COUNT;
@@ -222,14 +272,12 @@ namespace Simd
             _func(args.M, args.N, args.K, args.alpha, args.A, args.lda, args.B, args.ldb, args.beta, args.C, args.ldc);
         }
 
-#ifdef SIMD_RUNTIME_STATISTIC
         SIMD_INLINE String Info(const GemmArgs & args) const
         {
             std::stringstream ss;
             ss << "Gemm [" << args.M << ", " << args.N << ", " << args.K << "]";
             return ss.str();
         }
-#endif
 
     private:
         Func _func;
@@ -280,14 +328,12 @@ namespace Simd
             _run(args.M, args.N, args.K, args.A, args.pB, args.C, _type, _type != GemmKernelAny);
         }
 
-#ifdef SIMD_RUNTIME_STATISTIC
         SIMD_INLINE String Info(const GemmCbArgs & args) const
         {
             std::stringstream ss;
             ss << "GemmCb [" << args.M << ", " << args.N << ", " << args.K << "]";
             return ss.str();
         }
-#endif 
         
         SIMD_INLINE GemmKernelType Type() const { return _type; }
 
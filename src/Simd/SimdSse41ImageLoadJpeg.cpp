@@ -26,6 +26,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 #include "Simd/SimdSse41.h"
 
 namespace Simd
@@ -290,6 +291,8 @@ namespace Simd
                 jpeg_uc* linebuf;
                 short* coeff;   // progressive only
                 int      coeff_w, coeff_h; // number of 8x8 coefficient blocks
+                int      block; // size of block produced by IDCT (less then 8 in case of scaled decoding)
+                void (*idct)(jpeg_uc* out, int out_stride, short data[64]);
             } img_comp[4];
 
             jpeg__uint32   code_buffer; // jpeg entropy-coded buffer
@@ -309,6 +312,11 @@ namespace Simd
 
             int scan_n, order[4];
             int restart_interval, todo;
+            int threads; // number of threads for decoding of restart intervals and color conversion
+            int scale; // output scale denominator (1, 2, 4 or 8) for decoding with reduced IDCT
+            int bgr; // swap red and blue channels of output
+            int roi_x, roi_y, roi_w, roi_h; // region of interest in output pixels (roi_w == 0 - whole image)
+            int roi_mcu_x0, roi_mcu_y0, roi_mcu_x1, roi_mcu_y1; // MCUs which have to be decoded to produce region of interest
 
             // kernels
             void (*idct_block_kernel)(jpeg_uc* out, int out_stride, short data[64]);
@@ -820,6 +828,48 @@ namespace Simd
             }
         }
 
+        // reduced IDCT for scaled decoding: NxN output samples (N = 4 or 2) are computed from top-left NxN coefficients,
+        // k[x][u] = 2048 * C(u) / 2 * cos((2 * x + 1) * u * PI / (2 * N))
+        static const int jpeg__idct_4x4_k[16] = { 724, 946, 724, 392, 724, 392, -724, -946, 724, -392, -724, 946, 724, -946, 724, -392 };
+        static const int jpeg__idct_2x2_k[4] = { 724, 724, 724, -724 };
+
+        static void jpeg__idct_reduced(jpeg_uc* out, int out_stride, const short* data, const int* k, int n)
+        {
+            int i, j, u, tmp[16];
+            for (j = 0; j < n; ++j) {
+                for (i = 0; i < n; ++i) {
+                    int sum = 0;
+                    for (u = 0; u < n; ++u)
+                        sum += k[i * n + u] * data[j * 8 + u];
+                    tmp[j * n + i] = (sum + 1024) >> 11;
+                }
+            }
+            for (j = 0; j < n; ++j, out += out_stride) {
+                for (i = 0; i < n; ++i) {
+                    int sum = 0;
+                    for (u = 0; u < n; ++u)
+                        sum += k[j * n + u] * tmp[u * n + i];
+                    out[i] = jpeg__clamp(((sum + 1024) >> 11) + 128);
+                }
+            }
+        }
+
+        static void jpeg__idct_4x4(jpeg_uc* out, int out_stride, short data[64])
+        {
+            jpeg__idct_reduced(out, out_stride, data, jpeg__idct_4x4_k, 4);
+        }
+
+        static void jpeg__idct_2x2(jpeg_uc* out, int out_stride, short data[64])
+        {
+            jpeg__idct_reduced(out, out_stride, data, jpeg__idct_2x2_k, 2);
+        }
+
+        static void jpeg__idct_1x1(jpeg_uc* out, int out_stride, short data[64])
+        {
+            JPEG_NOTUSED(out_stride);
+            out[0] = jpeg__clamp(((data[0] + 4) >> 3) + 128);
+        }
+
 #ifdef JPEG_SSE2
         // sse2 integer IDCT. not the fastest possible implementation but it
         // produces bit-identical results to the generic C version so it's
@@ -1035,10 +1085,205 @@ namespace Simd
             // since we don't even allow 1<<30 pixels
         }
 
+        // minimal number of rows in a band of parallel color conversion
+#define JPEG_BAND_MIN 16
+
+        // checks if block (bx, by) of component n belongs to MCUs of region of interest
+        SIMD_INLINE static int jpeg__roi_block(const jpeg__jpeg* z, int n, int bx, int by)
+        {
+            return bx >= z->roi_mcu_x0 * z->img_comp[n].h && bx < z->roi_mcu_x1 * z->img_comp[n].h &&
+                by >= z->roi_mcu_y0 * z->img_comp[n].v && by < z->roi_mcu_y1 * z->img_comp[n].v;
+        }
+
+        // checks if MCUs (blocks for non-interleaved scan) [first, last) intersect MCUs of region of interest
+        static int jpeg__roi_mcus(const jpeg__jpeg* z, int first, int last)
+        {
+            int w, x0, x1, y0, y1, j;
+            if (z->scan_n == 1) {
+                int n = z->order[0];
+                w = (z->img_comp[n].x + 7) >> 3;
+                x0 = z->roi_mcu_x0 * z->img_comp[n].h, x1 = z->roi_mcu_x1 * z->img_comp[n].h;
+                y0 = z->roi_mcu_y0 * z->img_comp[n].v, y1 = z->roi_mcu_y1 * z->img_comp[n].v;
+            }
+            else {
+                w = z->img_mcu_x;
+                x0 = z->roi_mcu_x0, x1 = z->roi_mcu_x1, y0 = z->roi_mcu_y0, y1 = z->roi_mcu_y1;
+            }
+            for (j = first / w; j <= (last - 1) / w; ++j) {
+                int i0 = j == first / w ? first % w : 0;
+                int i1 = j == (last - 1) / w ? (last - 1) % w : w - 1;
+                if (j >= y0 && j < y1 && i0 < x1 && i1 >= x0)
+                    return 1;
+            }
+            return 0;
+        }
+
+        // skips the rest of entropy-coded data of current scan (up to the first marker which is not RST)
+        static void jpeg__skip_entropy_coded_data(jpeg__jpeg* z)
+        {
+            jpeg__context* s = z->s;
+            if (z->marker != JPEG__MARKER_none && !JPEG__RESTART(z->marker))
+                return;
+            z->marker = JPEG__MARKER_none;
+            for (;;) {
+                if (s->img_buffer >= s->img_buffer_end) {
+                    if (!s->read_from_callbacks)
+                        return;
+                    jpeg__refill_buffer(s);
+                }
+                const jpeg_uc* p = (const jpeg_uc*)memchr(s->img_buffer, 0xff, s->img_buffer_end - s->img_buffer);
+                if (p == NULL) {
+                    s->img_buffer = s->img_buffer_end;
+                    continue;
+                }
+                s->img_buffer = (jpeg_uc*)p + 1;
+                int x = jpeg__get8(s);
+                while (x == 0xff)
+                    x = jpeg__get8(s);
+                if (x != 0x00 && !JPEG__RESTART(x)) {
+                    z->marker = (unsigned char)x;
+                    return;
+                }
+            }
+        }
+
+        // decode MCUs [begin, end) of non-progressive scan (restart markers have to be handled by caller)
+        static int jpeg__decode_mcus(jpeg__jpeg* z, int begin, int end)
+        {
+            int m, k, x, y;
+            JPEG_SIMD_ALIGN(short, data[64]);
+            if (z->scan_n == 1) {
+                int n = z->order[0];
+                int w = (z->img_comp[n].x + 7) >> 3;
+                int ha = z->img_comp[n].ha;
+                for (m = begin; m < end; ++m) {
+                    int i = m % w, j = m / w;
+                    if (!jpeg__jpeg_decode_block(z, data, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
+                    if (jpeg__roi_block(z, n, i, j))
+                        z->img_comp[n].idct(z->img_comp[n].data + (z->img_comp[n].w2 * j + i) * z->img_comp[n].block, z->img_comp[n].w2, data);
+                }
+            }
+            else {
+                for (m = begin; m < end; ++m) {
+                    int i = m % z->img_mcu_x, j = m / z->img_mcu_x;
+                    for (k = 0; k < z->scan_n; ++k) {
+                        int n = z->order[k];
+                        for (y = 0; y < z->img_comp[n].v; ++y) {
+                            for (x = 0; x < z->img_comp[n].h; ++x) {
+                                int x2 = (i * z->img_comp[n].h + x) * z->img_comp[n].block;
+                                int y2 = (j * z->img_comp[n].v + y) * z->img_comp[n].block;
+                                int ha = z->img_comp[n].ha;
+                                if (!jpeg__jpeg_decode_block(z, data, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
+                                if (jpeg__roi_block(z, n, i * z->img_comp[n].h + x, j * z->img_comp[n].v + y))
+                                    z->img_comp[n].idct(z->img_comp[n].data + z->img_comp[n].w2 * y2 + x2, z->img_comp[n].w2, data);
+                            }
+                        }
+                    }
+                }
+            }
+            return 1;
+        }
+
+        // non-progressive scan with restart markers consists of independent intervals: their offsets are found 
+        // by pre-scan of entropy-coded data and then they are decoded (with IDCT) in parallel.
+        // intervals which don't intersect region of interest are skipped.
+        // returns -1 if scan can't be split (it has to be decoded serially), 0 on error, 1 on success.
+        static int jpeg__parse_entropy_coded_data_parallel(jpeg__jpeg* z)
+        {
+            jpeg__context* s = z->s;
+            if (!s->read_from_callbacks || s->io_user_data == NULL)
+                return -1;
+            InputMemoryStream* stream = (InputMemoryStream*)s->io_user_data;
+            const jpeg_uc* data_beg = stream->Data() + stream->Pos() - (s->img_buffer_end - s->img_buffer);
+            const jpeg_uc* data_end = stream->Data() + stream->Size();
+
+            int total, ri = z->restart_interval;
+            if (z->scan_n == 1) {
+                int n = z->order[0];
+                total = ((z->img_comp[n].x + 7) >> 3) * ((z->img_comp[n].y + 7) >> 3);
+            }
+            else
+                total = z->img_mcu_x * z->img_mcu_y;
+            int intervals = (total + ri - 1) / ri;
+            if (intervals < 2)
+                return -1;
+
+            std::vector<const jpeg_uc*> starts, stops;
+            starts.reserve(intervals);
+            stops.reserve(intervals);
+            starts.push_back(data_beg);
+            const jpeg_uc* p = data_beg;
+            int marker = JPEG__MARKER_none;
+            while (p < data_end) {
+                p = (const jpeg_uc*)memchr(p, 0xff, data_end - p);
+                if (p == NULL)
+                    break;
+                const jpeg_uc* q = p + 1;
+                while (q < data_end && *q == 0xff)
+                    q++; // fill bytes
+                if (q == data_end)
+                    break;
+                if (*q == 0x00) { // stuffed byte
+                    p = q + 1;
+                    continue;
+                }
+                stops.push_back(p);
+                p = q + 1;
+                if (!JPEG__RESTART(*q)) {
+                    marker = *q;
+                    break;
+                }
+                if ((int)starts.size() == intervals)
+                    return -1;
+                starts.push_back(p);
+            }
+            if (marker == JPEG__MARKER_none || (int)starts.size() != intervals)
+                return -1;
+
+            std::vector<jpeg_uc> status(intervals, 0);
+            Simd::Parallel(0, intervals, [&](size_t thread, size_t begin, size_t end)
+            {
+                jpeg__context c = *s;
+                c.io.read = NULL;
+                c.read_from_callbacks = 0;
+                jpeg__jpeg* t = (jpeg__jpeg*)jpeg__malloc(sizeof(jpeg__jpeg));
+                if (!t)
+                    return;
+                *t = *z;
+                t->s = &c;
+                for (size_t i = begin; i < end; ++i) {
+                    int first = (int)i * ri, last = first + ri < total ? first + ri : total;
+                    if (!jpeg__roi_mcus(z, first, last)) {
+                        status[i] = 1;
+                        continue;
+                    }
+                    c.img_buffer = (jpeg_uc*)starts[i];
+                    c.img_buffer_end = (jpeg_uc*)stops[i];
+                    jpeg__jpeg_reset(t);
+                    status[i] = (jpeg_uc)jpeg__decode_mcus(t, first, last);
+                }
+                JPEG_FREE(t);
+            }, z->threads, 1, 4);
+            for (int i = 0; i < intervals; ++i)
+                if (!status[i])
+                    return 0;
+
+            // continue reading of the stream after marker which terminates the scan
+            stream->Seek(p - stream->Data());
+            jpeg__refill_buffer(s);
+            z->marker = (unsigned char)marker;
+            return 1;
+        }
+
         static int jpeg__parse_entropy_coded_data(jpeg__jpeg* z)
         {
             jpeg__jpeg_reset(z);
             if (!z->progressive) {
+                if (z->restart_interval && (z->threads > 1 || z->roi_w)) {
+                    int result = jpeg__parse_entropy_coded_data_parallel(z);
+                    if (result >= 0)
+                        return result;
+                }
                 if (z->scan_n == 1) {
                     int i, j;
                     JPEG_SIMD_ALIGN(short, data[64]);
@@ -1050,10 +1295,15 @@ namespace Simd
                     int w = (z->img_comp[n].x + 7) >> 3;
                     int h = (z->img_comp[n].y + 7) >> 3;
                     for (j = 0; j < h; ++j) {
+                        if (j >= z->roi_mcu_y1 * z->img_comp[n].v) {
+                            jpeg__skip_entropy_coded_data(z);
+                            return 1;
+                        }
                         for (i = 0; i < w; ++i) {
                             int ha = z->img_comp[n].ha;
                             if (!jpeg__jpeg_decode_block(z, data, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
-                            z->idct_block_kernel(z->img_comp[n].data + z->img_comp[n].w2 * j * 8 + i * 8, z->img_comp[n].w2, data);
+                            if (jpeg__roi_block(z, n, i, j))
+                                z->img_comp[n].idct(z->img_comp[n].data + (z->img_comp[n].w2 * j + i) * z->img_comp[n].block, z->img_comp[n].w2, data);
                             // every data block is an MCU, so countdown the restart interval
                             if (--z->todo <= 0) {
                                 if (z->code_bits < 24) jpeg__grow_buffer_unsafe(z);
@@ -1070,6 +1320,10 @@ namespace Simd
                     int i, j, k, x, y;
                     JPEG_SIMD_ALIGN(short, data[64]);
                     for (j = 0; j < z->img_mcu_y; ++j) {
+                        if (j >= z->roi_mcu_y1) {
+                            jpeg__skip_entropy_coded_data(z);
+                            return 1;
+                        }
                         for (i = 0; i < z->img_mcu_x; ++i) {
                             // scan an interleaved mcu... process scan_n components in order
                             for (k = 0; k < z->scan_n; ++k) {
@@ -1078,11 +1332,12 @@ namespace Simd
                                 // by the basic H and V specified for the component
                                 for (y = 0; y < z->img_comp[n].v; ++y) {
                                     for (x = 0; x < z->img_comp[n].h; ++x) {
-                                        int x2 = (i * z->img_comp[n].h + x) * 8;
-                                        int y2 = (j * z->img_comp[n].v + y) * 8;
+                                        int x2 = (i * z->img_comp[n].h + x) * z->img_comp[n].block;
+                                        int y2 = (j * z->img_comp[n].v + y) * z->img_comp[n].block;
                                         int ha = z->img_comp[n].ha;
                                         if (!jpeg__jpeg_decode_block(z, data, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
-                                        z->idct_block_kernel(z->img_comp[n].data + z->img_comp[n].w2 * y2 + x2, z->img_comp[n].w2, data);
+                                        if (jpeg__roi_block(z, n, i * z->img_comp[n].h + x, j * z->img_comp[n].v + y))
+                                            z->img_comp[n].idct(z->img_comp[n].data + z->img_comp[n].w2 * y2 + x2, z->img_comp[n].w2, data);
                                     }
                                 }
                             }
@@ -1109,6 +1364,10 @@ namespace Simd
                     int w = (z->img_comp[n].x + 7) >> 3;
                     int h = (z->img_comp[n].y + 7) >> 3;
                     for (j = 0; j < h; ++j) {
+                        if (j >= z->roi_mcu_y1 * z->img_comp[n].v) {
+                            jpeg__skip_entropy_coded_data(z);
+                            return 1;
+                        }
                         for (i = 0; i < w; ++i) {
                             short* data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
                             if (z->spec_start == 0) {
@@ -1133,6 +1392,10 @@ namespace Simd
                 else { // interleaved
                     int i, j, k, x, y;
                     for (j = 0; j < z->img_mcu_y; ++j) {
+                        if (j >= z->roi_mcu_y1) {
+                            jpeg__skip_entropy_coded_data(z);
+                            return 1;
+                        }
                         for (i = 0; i < z->img_mcu_x; ++i) {
                             // scan an interleaved mcu... process scan_n components in order
                             for (k = 0; k < z->scan_n; ++k) {
@@ -1181,8 +1444,10 @@ namespace Simd
                     for (j = 0; j < h; ++j) {
                         for (i = 0; i < w; ++i) {
                             short* data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
+                            if (!jpeg__roi_block(z, n, i, j))
+                                continue;
                             jpeg__jpeg_dequantize(data, z->dequant[z->img_comp[n].tq]);
-                            z->idct_block_kernel(z->img_comp[n].data + z->img_comp[n].w2 * j * 8 + i * 8, z->img_comp[n].w2, data);
+                            z->img_comp[n].idct(z->img_comp[n].data + (z->img_comp[n].w2 * j + i) * z->img_comp[n].block, z->img_comp[n].w2, data);
                         }
                     }
                 }
@@ -1406,6 +1671,25 @@ namespace Simd
             z->img_mcu_x = (s->img_x + z->img_mcu_w - 1) / z->img_mcu_w;
             z->img_mcu_y = (s->img_y + z->img_mcu_h - 1) / z->img_mcu_h;
 
+            // MCUs of region of interest with margin of one MCU for chroma upsampling
+            if (z->roi_w) {
+                int mw = z->img_mcu_w / z->scale, mh = z->img_mcu_h / z->scale;
+                if (z->roi_x < 0 || z->roi_y < 0 || z->roi_h <= 0 || z->roi_w < 0 ||
+                    (jpeg__uint32)(z->roi_x + z->roi_w) > (s->img_x + z->scale - 1) / z->scale ||
+                    (jpeg__uint32)(z->roi_y + z->roi_h) > (s->img_y + z->scale - 1) / z->scale)
+                    return JpegLoadError("bad ROI", "Region of interest is out of image");
+                z->roi_mcu_x0 = z->roi_x / mw > 0 ? z->roi_x / mw - 1 : 0;
+                z->roi_mcu_y0 = z->roi_y / mh > 0 ? z->roi_y / mh - 1 : 0;
+                z->roi_mcu_x1 = (z->roi_x + z->roi_w + mw - 1) / mw + 1 < z->img_mcu_x ? (z->roi_x + z->roi_w + mw - 1) / mw + 1 : z->img_mcu_x;
+                z->roi_mcu_y1 = (z->roi_y + z->roi_h + mh - 1) / mh + 1 < z->img_mcu_y ? (z->roi_y + z->roi_h + mh - 1) / mh + 1 : z->img_mcu_y;
+            }
+            else {
+                z->roi_mcu_x0 = 0;
+                z->roi_mcu_y0 = 0;
+                z->roi_mcu_x1 = z->img_mcu_x;
+                z->roi_mcu_y1 = z->img_mcu_y;
+            }
+
             for (i = 0; i < s->img_n; ++i) {
                 // number of effective pixels (e.g. for non-interleaved MCU)
                 z->img_comp[i].x = (s->img_x * z->img_comp[i].h + h_max - 1) / h_max;
@@ -1417,8 +1701,21 @@ namespace Simd
                 //
                 // img_mcu_x, img_mcu_y: <=17 bits; comp[i].h and .v are <=4 (checked earlier)
                 // so these muls can't overflow with 32-bit ints (which we require)
-                z->img_comp[i].w2 = z->img_mcu_x * z->img_comp[i].h * 8;
-                z->img_comp[i].h2 = z->img_mcu_y * z->img_comp[i].v * 8;
+                // in case of scaled decoding subsampled components use larger IDCT blocks (if it is possible) to avoid upsampling
+                z->img_comp[i].block = 8 / z->scale;
+                if (h_max / z->img_comp[i].h == v_max / z->img_comp[i].v && h_max % z->img_comp[i].h == 0 && v_max % z->img_comp[i].v == 0) {
+                    int ratio = h_max / z->img_comp[i].h;
+                    if ((ratio == 2 || ratio == 4) && z->img_comp[i].block * ratio <= 8)
+                        z->img_comp[i].block *= ratio;
+                }
+                switch (z->img_comp[i].block) {
+                case 1: z->img_comp[i].idct = jpeg__idct_1x1; break;
+                case 2: z->img_comp[i].idct = jpeg__idct_2x2; break;
+                case 4: z->img_comp[i].idct = jpeg__idct_4x4; break;
+                default: z->img_comp[i].idct = z->idct_block_kernel; break;
+                }
+                z->img_comp[i].w2 = z->img_mcu_x * z->img_comp[i].h * z->img_comp[i].block;
+                z->img_comp[i].h2 = z->img_mcu_y * z->img_comp[i].v * z->img_comp[i].block;
                 z->img_comp[i].coeff = 0;
                 z->img_comp[i].raw_coeff = 0;
                 z->img_comp[i].linebuf = NULL;
@@ -1428,10 +1725,10 @@ namespace Simd
                 // align blocks for idct using mmx/sse
                 z->img_comp[i].data = (jpeg_uc*)(((size_t)z->img_comp[i].raw_data + 15) & ~15);
                 if (z->progressive) {
-                    // w2, h2 are multiples of 8 (see above)
-                    z->img_comp[i].coeff_w = z->img_comp[i].w2 / 8;
-                    z->img_comp[i].coeff_h = z->img_comp[i].h2 / 8;
-                    z->img_comp[i].raw_coeff = jpeg__malloc_mad3(z->img_comp[i].w2, z->img_comp[i].h2, sizeof(short), 15);
+                    // coefficients are stored for full 8x8 blocks (also in case of scaled decoding)
+                    z->img_comp[i].coeff_w = z->img_mcu_x * z->img_comp[i].h;
+                    z->img_comp[i].coeff_h = z->img_mcu_y * z->img_comp[i].v;
+                    z->img_comp[i].raw_coeff = jpeg__malloc_mad3(z->img_comp[i].coeff_w * 64, z->img_comp[i].coeff_h, sizeof(short), 15);
                     if (z->img_comp[i].raw_coeff == NULL)
                         return jpeg__free_jpeg_components(z, i + 1, JpegLoadError("outofmem", "Out of memory"));
                     z->img_comp[i].coeff = (short*)(((size_t)z->img_comp[i].raw_coeff + 15) & ~15);
@@ -1891,6 +2188,10 @@ namespace Simd
         // set up the kernels
         static void jpeg__setup_jpeg(jpeg__jpeg* j)
         {
+            j->threads = 1;
+            j->scale = 1;
+            j->bgr = 0;
+            j->roi_x = j->roi_y = j->roi_w = j->roi_h = 0;
             j->idct_block_kernel = jpeg__idct_block;
             j->YCbCr_to_RGB_kernel = jpeg__YCbCr_to_RGB_row;
             j->resample_row_hv_2_kernel = jpeg__resample_row_hv_2;
@@ -1922,6 +2223,8 @@ namespace Simd
             jpeg_uc* line0, * line1;
             int hs, vs;   // expansion factor in each axis
             int w_lores; // horizontal pixels pre-expansion
+            int x0;      // first pre-expansion pixel (for region of interest)
+            int offset;  // offset of first output pixel in expanded row (for region of interest)
             int ystep;   // how far through vertical expansion we are
             int ypos;    // which pre-expansion row we're on
         } jpeg__resample;
@@ -1933,181 +2236,260 @@ namespace Simd
             return (jpeg_uc)((t + (t >> 8)) >> 8);
         }
 
-        static jpeg_uc* load_jpeg_image(jpeg__jpeg* z, int* out_x, int* out_y, int* comp, int req_comp)
+        static void jpeg__resample_skip(jpeg__jpeg* z, jpeg__resample* r, int k, unsigned int rows)
         {
-            int n, decode_n, is_rgb;
-            z->s->img_n = 0; // make jpeg__cleanup_jpeg safe
-
-            // validate req_comp
-            if (req_comp < 0 || req_comp > 4) return jpeg__errpuc("bad req_comp", "Internal error");
-
-            // load a jpeg image from whichever source, but leave in YCbCr format
-            if (!jpeg__decode_jpeg_image(z)) { jpeg__cleanup_jpeg(z); return NULL; }
-
-            // determine actual number of components to generate
-            n = req_comp ? req_comp : z->s->img_n >= 3 ? 3 : 1;
-
-            is_rgb = z->s->img_n == 3 && (z->rgb == 3 || (z->app14_color_transform == 0 && !z->jfif));
-
-            if (z->s->img_n == 3 && n < 3 && !is_rgb)
-                decode_n = 1;
-            else
-                decode_n = z->s->img_n;
+            unsigned int j;
+            for (j = 0; j < rows; ++j) {
+                if (++r->ystep >= r->vs) {
+                    r->ystep = 0;
+                    r->line0 = r->line1;
+                    if (++r->ypos < z->img_comp[k].y)
+                        r->line1 += z->img_comp[k].w2;
+                }
+            }
+        }
 
-            // resample and color-convert
-            {
-                int k;
-                unsigned int i, j;
-                jpeg_uc* output;
-                jpeg_uc* coutput[4] = { NULL, NULL, NULL, NULL };
+        // resample and color-convert rows [begin, end) of output image (or its region of interest).
+        // 3-channel conversion writes one byte after the end of row, so the last row of band and rows 
+        // of output with padding (which may belong to caller) are converted into temporary buffer tmp.
+        static void jpeg__convert_rows(jpeg__jpeg* z, const jpeg__resample* res_init, jpeg_uc** linebuf, jpeg_uc* tmp, jpeg_uc* output, size_t stride,
+            int n, int decode_n, int is_rgb, unsigned int width, unsigned int begin, unsigned int end)
+        {
+            int k;
+            unsigned int i, j;
+            jpeg_uc* coutput[4] = { NULL, NULL, NULL, NULL };
+            jpeg__resample res_comp[4];
 
-                jpeg__resample res_comp[4];
+            for (k = 0; k < decode_n; ++k) {
+                res_comp[k] = res_init[k];
+                jpeg__resample_skip(z, &res_comp[k], k, begin + z->roi_y);
+            }
 
+            for (j = begin; j < end; ++j) {
+                jpeg_uc* dst = n == 3 && (j + 1 == end || stride != 3 * (size_t)width) ? tmp : output + stride * j;
+                jpeg_uc* out = dst;
                 for (k = 0; k < decode_n; ++k) {
                     jpeg__resample* r = &res_comp[k];
-
-                    // allocate line buffer big enough for upsampling off the edges
-                    // with upsample factor of 4
-                    z->img_comp[k].linebuf = (jpeg_uc*)jpeg__malloc(z->s->img_x + 3);
-                    if (!z->img_comp[k].linebuf) { jpeg__cleanup_jpeg(z); return jpeg__errpuc("outofmem", "Out of memory"); }
-
-                    r->hs = z->img_h_max / z->img_comp[k].h;
-                    r->vs = z->img_v_max / z->img_comp[k].v;
-                    r->ystep = r->vs >> 1;
-                    r->w_lores = (z->s->img_x + r->hs - 1) / r->hs;
-                    r->ypos = 0;
-                    r->line0 = r->line1 = z->img_comp[k].data;
-
-                    if (r->hs == 1 && r->vs == 1) r->resample = resample_row_1;
-                    else if (r->hs == 1 && r->vs == 2) r->resample = jpeg__resample_row_v_2;
-                    else if (r->hs == 2 && r->vs == 1) r->resample = jpeg__resample_row_h_2;
-                    else if (r->hs == 2 && r->vs == 2) r->resample = z->resample_row_hv_2_kernel;
-                    else                               r->resample = jpeg__resample_row_generic;
-                }
-
-                // can't error after this so, this is safe
-                output = (jpeg_uc*)jpeg__malloc_mad3(n, z->s->img_x, z->s->img_y, 1);
-                if (!output) { jpeg__cleanup_jpeg(z); return jpeg__errpuc("outofmem", "Out of memory"); }
-
-                // now go ahead and resample
-                for (j = 0; j < z->s->img_y; ++j) {
-                    jpeg_uc* out = output + n * z->s->img_x * j;
-                    for (k = 0; k < decode_n; ++k) {
-                        jpeg__resample* r = &res_comp[k];
-                        int y_bot = r->ystep >= (r->vs >> 1);
-                        coutput[k] = r->resample(z->img_comp[k].linebuf,
-                            y_bot ? r->line1 : r->line0,
-                            y_bot ? r->line0 : r->line1,
-                            r->w_lores, r->hs);
-                        if (++r->ystep >= r->vs) {
-                            r->ystep = 0;
-                            r->line0 = r->line1;
-                            if (++r->ypos < z->img_comp[k].y)
-                                r->line1 += z->img_comp[k].w2;
-                        }
+                    int y_bot = r->ystep >= (r->vs >> 1);
+                    coutput[k] = r->resample(linebuf[k],
+                        (y_bot ? r->line1 : r->line0) + r->x0,
+                        (y_bot ? r->line0 : r->line1) + r->x0,
+                        r->w_lores, r->hs) + r->offset;
+                    if (++r->ystep >= r->vs) {
+                        r->ystep = 0;
+                        r->line0 = r->line1;
+                        if (++r->ypos < z->img_comp[k].y)
+                            r->line1 += z->img_comp[k].w2;
                     }
-                    if (n >= 3) {
-                        jpeg_uc* y = coutput[0];
-                        if (z->s->img_n == 3) {
-                            if (is_rgb) {
-                                for (i = 0; i < z->s->img_x; ++i) {
-                                    out[0] = y[i];
-                                    out[1] = coutput[1][i];
-                                    out[2] = coutput[2][i];
-                                    out[3] = 255;
-                                    out += n;
-                                }
-                            }
-                            else {
-                                z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
+                }
+                if (n >= 3) {
+                    jpeg_uc* y = coutput[0];
+                    if (z->s->img_n == 3) {
+                        if (is_rgb) {
+                            for (i = 0; i < width; ++i) {
+                                out[0] = y[i];
+                                out[1] = coutput[1][i];
+                                out[2] = coutput[2][i];
+                                out[3] = 255;
+                                out += n;
                             }
                         }
-                        else if (z->s->img_n == 4) {
-                            if (z->app14_color_transform == 0) { // CMYK
-                                for (i = 0; i < z->s->img_x; ++i) {
-                                    jpeg_uc m = coutput[3][i];
-                                    out[0] = jpeg__blinn_8x8(coutput[0][i], m);
-                                    out[1] = jpeg__blinn_8x8(coutput[1][i], m);
-                                    out[2] = jpeg__blinn_8x8(coutput[2][i], m);
-                                    out[3] = 255;
-                                    out += n;
-                                }
-                            }
-                            else if (z->app14_color_transform == 2) { // YCCK
-                                z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-                                for (i = 0; i < z->s->img_x; ++i) {
-                                    jpeg_uc m = coutput[3][i];
-                                    out[0] = jpeg__blinn_8x8(255 - out[0], m);
-                                    out[1] = jpeg__blinn_8x8(255 - out[1], m);
-                                    out[2] = jpeg__blinn_8x8(255 - out[2], m);
-                                    out += n;
-                                }
-                            }
-                            else { // YCbCr + alpha?  Ignore the fourth channel for now
-                                z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-                            }
+                        else {
+                            z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], width, n);
                         }
-                        else
-                            for (i = 0; i < z->s->img_x; ++i) {
-                                out[0] = out[1] = out[2] = y[i];
-                                out[3] = 255; // not used if n==3
-                                out += n;
-                            }
                     }
-                    else {
-                        if (is_rgb) {
-                            if (n == 1)
-                                for (i = 0; i < z->s->img_x; ++i)
-                                    *out++ = jpeg__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
-                            else {
-                                for (i = 0; i < z->s->img_x; ++i, out += 2) {
-                                    out[0] = jpeg__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
-                                    out[1] = 255;
-                                }
+                    else if (z->s->img_n == 4) {
+                        if (z->app14_color_transform == 0) { // CMYK
+                            for (i = 0; i < width; ++i) {
+                                jpeg_uc m = coutput[3][i];
+                                out[0] = jpeg__blinn_8x8(coutput[0][i], m);
+                                out[1] = jpeg__blinn_8x8(coutput[1][i], m);
+                                out[2] = jpeg__blinn_8x8(coutput[2][i], m);
+                                out[3] = 255;
+                                out += n;
                             }
                         }
-                        else if (z->s->img_n == 4 && z->app14_color_transform == 0) {
-                            for (i = 0; i < z->s->img_x; ++i) {
+                        else if (z->app14_color_transform == 2) { // YCCK
+                            z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], width, n);
+                            for (i = 0; i < width; ++i) {
                                 jpeg_uc m = coutput[3][i];
-                                jpeg_uc r = jpeg__blinn_8x8(coutput[0][i], m);
-                                jpeg_uc g = jpeg__blinn_8x8(coutput[1][i], m);
-                                jpeg_uc b = jpeg__blinn_8x8(coutput[2][i], m);
-                                out[0] = jpeg__compute_y(r, g, b);
-                                out[1] = 255;
+                                out[0] = jpeg__blinn_8x8(255 - out[0], m);
+                                out[1] = jpeg__blinn_8x8(255 - out[1], m);
+                                out[2] = jpeg__blinn_8x8(255 - out[2], m);
                                 out += n;
                             }
                         }
-                        else if (z->s->img_n == 4 && z->app14_color_transform == 2) {
-                            for (i = 0; i < z->s->img_x; ++i) {
-                                out[0] = jpeg__blinn_8x8(255 - coutput[0][i], coutput[3][i]);
+                        else { // YCbCr + alpha?  Ignore the fourth channel for now
+                            z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], width, n);
+                        }
+                    }
+                    else
+                        for (i = 0; i < width; ++i) {
+                            out[0] = out[1] = out[2] = y[i];
+                            out[3] = 255; // not used if n==3
+                            out += n;
+                        }
+                }
+                else {
+                    if (is_rgb) {
+                        if (n == 1)
+                            for (i = 0; i < width; ++i)
+                                *out++ = jpeg__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
+                        else {
+                            for (i = 0; i < width; ++i, out += 2) {
+                                out[0] = jpeg__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
                                 out[1] = 255;
-                                out += n;
                             }
                         }
-                        else {
-                            jpeg_uc* y = coutput[0];
-                            if (n == 1)
-                                for (i = 0; i < z->s->img_x; ++i) out[i] = y[i];
-                            else
-                                for (i = 0; i < z->s->img_x; ++i) { *out++ = y[i]; *out++ = 255; }
+                    }
+                    else if (z->s->img_n == 4 && z->app14_color_transform == 0) {
+                        for (i = 0; i < width; ++i) {
+                            jpeg_uc m = coutput[3][i];
+                            jpeg_uc r = jpeg__blinn_8x8(coutput[0][i], m);
+                            jpeg_uc g = jpeg__blinn_8x8(coutput[1][i], m);
+                            jpeg_uc b = jpeg__blinn_8x8(coutput[2][i], m);
+                            out[0] = jpeg__compute_y(r, g, b);
+                            out[1] = 255;
+                            out += n;
                         }
                     }
+                    else if (z->s->img_n == 4 && z->app14_color_transform == 2) {
+                        for (i = 0; i < width; ++i) {
+                            out[0] = jpeg__blinn_8x8(255 - coutput[0][i], coutput[3][i]);
+                            out[1] = 255;
+                            out += n;
+                        }
+                    }
+                    else {
+                        jpeg_uc* y = coutput[0];
+                        if (n == 1)
+                            for (i = 0; i < width; ++i) out[i] = y[i];
+                        else
+                            for (i = 0; i < width; ++i) { *out++ = y[i]; *out++ = 255; }
+                    }
+                }
+                if (z->bgr && n >= 3) {
+                    for (i = 0, out = dst; i < width; ++i, out += n) {
+                        jpeg_uc t = out[0];
+                        out[0] = out[2];
+                        out[2] = t;
+                    }
+                }
+                if (dst == tmp)
+                    memcpy(output + stride * j, tmp, 3 * (size_t)width);
+            }
+        }
+
+        // resample and color-convert decoded image (or its region of interest) to output with n channels
+        static int jpeg__convert_image(jpeg__jpeg* z, int n, jpeg_uc* output, size_t stride)
+        {
+            int k, decode_n, is_rgb;
+            jpeg_uc* linebuf;
+            size_t linebuf_size = z->s->img_x + 3;
+            int threads = z->threads;
+            unsigned int width = z->roi_w ? z->roi_w : z->s->img_x;
+            unsigned int height = z->roi_w ? z->roi_h : z->s->img_y;
+            jpeg__resample res_comp[4];
+
+            is_rgb = z->s->img_n == 3 && (z->rgb == 3 || (z->app14_color_transform == 0 && !z->jfif));
+
+            if (z->s->img_n == 3 && n < 3 && !is_rgb)
+                decode_n = 1;
+            else
+                decode_n = z->s->img_n;
+
+            for (k = 0; k < decode_n; ++k) {
+                jpeg__resample* r = &res_comp[k];
+
+                r->hs = z->img_h_max / z->img_comp[k].h * 8 / z->scale / z->img_comp[k].block;
+                r->vs = z->img_v_max / z->img_comp[k].v * 8 / z->scale / z->img_comp[k].block;
+                r->ystep = r->vs >> 1;
+                r->w_lores = (z->s->img_x + r->hs - 1) / r->hs;
+                r->ypos = 0;
+                r->line0 = r->line1 = z->img_comp[k].data;
+                r->x0 = 0;
+                r->offset = 0;
+                if (z->roi_w) {
+                    // only decoded MCUs are resampled, their edges are far enough from region of interest
+                    int x1 = z->roi_mcu_x1 * z->img_comp[k].h * z->img_comp[k].block;
+                    r->x0 = z->roi_mcu_x0 * z->img_comp[k].h * z->img_comp[k].block;
+                    r->w_lores = (x1 < r->w_lores ? x1 : r->w_lores) - r->x0;
+                    r->offset = z->roi_x - r->x0 * r->hs;
+                    if ((size_t)r->w_lores * r->hs + 3 > linebuf_size)
+                        linebuf_size = (size_t)r->w_lores * r->hs + 3;
+                }
+
+                if (r->hs == 1 && r->vs == 1) r->resample = resample_row_1;
+                else if (r->hs == 1 && r->vs == 2) r->resample = jpeg__resample_row_v_2;
+                else if (r->hs == 2 && r->vs == 1) r->resample = jpeg__resample_row_h_2;
+                else if (r->hs == 2 && r->vs == 2) r->resample = z->resample_row_hv_2_kernel;
+                else                               r->resample = jpeg__resample_row_generic;
+            }
+
+            // allocate line buffers big enough for upsampling off the edges with upsample factor of 4
+            // for every component and every thread (they are stored in the first component to be freed by cleanup)
+            linebuf = (jpeg_uc*)jpeg__malloc_mad3(threads, decode_n, (int)linebuf_size, 0);
+            if (!linebuf) { jpeg__cleanup_jpeg(z); return JpegLoadError("outofmem", "Out of memory"); }
+            z->img_comp[0].linebuf = linebuf;
+
+            // now go ahead and resample, horizontal bands of output are independent
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                jpeg_uc* lines[4];
+                for (int c = 0; c < decode_n; ++c)
+                    lines[c] = linebuf + (thread * decode_n + c) * linebuf_size;
+                std::vector<jpeg_uc> tmp(n == 3 ? 4 * (size_t)width : 0);
+                jpeg__convert_rows(z, res_comp, lines, tmp.data(), output, stride, n, decode_n, is_rgb, width, (unsigned int)begin, (unsigned int)end);
+            }, threads, JPEG_BAND_MIN);
+            jpeg__cleanup_jpeg(z);
+            return 1;
+        }
+
+        static jpeg_uc* load_jpeg_image(jpeg__jpeg* z, int* out_x, int* out_y, int* comp, int req_comp)
+        {
+            int n;
+            jpeg_uc* output;
+            z->s->img_n = 0; // make jpeg__cleanup_jpeg safe
+
+            // validate req_comp
+            if (req_comp < 0 || req_comp > 4) return jpeg__errpuc("bad req_comp", "Internal error");
+
+            // load a jpeg image from whichever source, but leave in YCbCr format
+            if (!jpeg__decode_jpeg_image(z)) { jpeg__cleanup_jpeg(z); return NULL; }
+
+            // determine actual number of components to generate
+            n = req_comp ? req_comp : z->s->img_n >= 3 ? 3 : 1;
+
+            // reduced IDCT has produced components of scaled size
+            if (z->scale > 1) {
+                int c;
+                z->s->img_x = (z->s->img_x + z->scale - 1) / z->scale;
+                z->s->img_y = (z->s->img_y + z->scale - 1) / z->scale;
+                for (c = 0; c < z->s->img_n; ++c) {
+                    z->img_comp[c].x = (z->img_comp[c].x * z->img_comp[c].block + 7) / 8;
+                    z->img_comp[c].y = (z->img_comp[c].y * z->img_comp[c].block + 7) / 8;
                 }
-                jpeg__cleanup_jpeg(z);
-                *out_x = z->s->img_x;
-                *out_y = z->s->img_y;
-                if (comp) *comp = z->s->img_n >= 3 ? 3 : 1; // report original components, not output
-                return output;
             }
+
+            output = (jpeg_uc*)jpeg__malloc_mad3(n, z->s->img_x, z->s->img_y, 1);
+            if (!output) { jpeg__cleanup_jpeg(z); return jpeg__errpuc("outofmem", "Out of memory"); }
+
+            if (!jpeg__convert_image(z, n, output, (size_t)n * z->s->img_x)) { JPEG_FREE(output); return NULL; }
+            *out_x = z->s->img_x;
+            *out_y = z->s->img_y;
+            if (comp) *comp = z->s->img_n >= 3 ? 3 : 1; // report original components, not output
+            return output;
         }
 
-        static void* jpeg__jpeg_load(jpeg__context* s, int* x, int* y, int* comp, int req_comp, jpeg__result_info* ri)
+        static void* jpeg__jpeg_load(jpeg__context* s, int* x, int* y, int* comp, int req_comp, int threads, int scale, jpeg__result_info* ri)
         {
             unsigned char* result;
             jpeg__jpeg* j = (jpeg__jpeg*)jpeg__malloc(sizeof(jpeg__jpeg));
             JPEG_NOTUSED(ri);
             j->s = s;
             jpeg__setup_jpeg(j);
+            j->threads = threads > 1 ? threads : 1;
+            j->scale = scale > 1 ? scale : 1;
             result = load_jpeg_image(j, x, y, comp, req_comp);
             JPEG_FREE(j);
             return result;
@@ -2167,6 +2549,129 @@ namespace Simd
             return stream->Pos() == stream->Size() ? 1 : 0;
         }
 
+        static void jpeg__start_stream(jpeg__context* s, InputMemoryStream* stream)
+        {
+            s->io.eof = jpeg__stdio_eof;
+            s->io.read = jpeg__stdio_read;
+            s->io.skip = jpeg__stdio_skip;
+            s->io_user_data = stream;
+            s->buflen = sizeof(s->buffer_start);
+            s->read_from_callbacks = 1;
+            s->callback_already_read = 0;
+            s->img_buffer = s->img_buffer_original = s->buffer_start;
+            jpeg__refill_buffer(s);
+            s->img_buffer_original_end = s->img_buffer_end;
+        }
+
+        //---------------------------------------------------------------------
+
+        static bool jpeg__yuv_compatible(const jpeg__jpeg* z, SimdYuvLayoutType layout)
+        {
+            int n = z->s->img_n;
+            if (n == 1)
+                return true;
+            if (n != 3 || z->rgb == 3 || (z->app14_color_transform == 0 && !z->jfif))
+                return false;
+            if (layout == SimdYuvLayoutGray8)
+                return z->img_comp[0].h == z->img_h_max && z->img_comp[0].v == z->img_v_max;
+            return z->img_comp[0].h == 2 && z->img_comp[0].v == 2 && z->img_h_max == 2 && z->img_v_max == 2 &&
+                z->img_comp[1].h == 1 && z->img_comp[1].v == 1 && z->img_comp[2].h == 1 && z->img_comp[2].v == 1;
+        }
+
+        uint8_t* JpegLoadYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, uint8_t* planes[3], size_t strides[3], size_t* width, size_t* height)
+        {
+            if (data == NULL || size < 2 || data[0] != 0xFF || data[1] != 0xD8 || planes == NULL || strides == NULL || width == NULL || height == NULL ||
+                (layout != SimdYuvLayoutGray8 && layout != SimdYuvLayoutNv12 && layout != SimdYuvLayoutYuv420p))
+                return NULL;
+            InputMemoryStream stream(data, size);
+            jpeg__context s;
+            jpeg__start_stream(&s, &stream);
+            jpeg__jpeg* z = (jpeg__jpeg*)jpeg__malloc(sizeof(jpeg__jpeg));
+            if (z == NULL)
+                return NULL;
+            z->s = &s;
+            jpeg__setup_jpeg(z);
+            z->threads = (int)Base::GetThreadNumber();
+            z->scale = 1;
+            s.img_n = 0;
+            uint8_t* buffer = NULL;
+            if (jpeg__decode_jpeg_image(z) && jpeg__yuv_compatible(z, layout))
+            {
+                size_t w = s.img_x, h = s.img_y, cw = (w + 1) / 2, ch = (h + 1) / 2;
+                size_t sizes[3] = { 0, 0, 0 };
+                strides[0] = AlignHi(w, SIMD_ALIGN), strides[1] = 0, strides[2] = 0;
+                sizes[0] = strides[0] * h;
+                if (layout == SimdYuvLayoutNv12)
+                    strides[1] = AlignHi(2 * cw, SIMD_ALIGN), sizes[1] = strides[1] * ch;
+                if (layout == SimdYuvLayoutYuv420p)
+                    strides[1] = strides[2] = AlignHi(cw, SIMD_ALIGN), sizes[1] = sizes[2] = strides[1] * ch;
+                buffer = (uint8_t*)Allocate(sizes[0] + sizes[1] + sizes[2]);
+                if (buffer)
+                {
+                    planes[0] = buffer;
+                    planes[1] = sizes[1] ? planes[0] + sizes[0] : NULL;
+                    planes[2] = sizes[2] ? planes[1] + sizes[1] : NULL;
+                    Base::Copy(z->img_comp[0].data, z->img_comp[0].w2, w, h, 1, planes[0], strides[0]);
+                    if (s.img_n == 1)
+                    {
+                        if (planes[1])
+                            memset(planes[1], 128, sizes[1] + sizes[2]);
+                    }
+                    else if (layout == SimdYuvLayoutNv12)
+                        InterleaveUv(z->img_comp[1].data, z->img_comp[1].w2, z->img_comp[2].data, z->img_comp[2].w2, cw, ch, planes[1], strides[1]);
+                    else if (layout == SimdYuvLayoutYuv420p)
+                    {
+                        Base::Copy(z->img_comp[1].data, z->img_comp[1].w2, cw, ch, 1, planes[1], strides[1]);
+                        Base::Copy(z->img_comp[2].data, z->img_comp[2].w2, cw, ch, 1, planes[2], strides[2]);
+                    }
+                    *width = w;
+                    *height = h;
+                }
+            }
+            jpeg__cleanup_jpeg(z);
+            JPEG_FREE(z);
+            return buffer;
+        }
+
+        bool JpegLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t stride)
+        {
+            int n = 0, bgr = 0;
+            switch (format)
+            {
+            case SimdPixelFormatGray8: n = 1; break;
+            case SimdPixelFormatBgr24: n = 3; bgr = 1; break;
+            case SimdPixelFormatRgb24: n = 3; break;
+            case SimdPixelFormatBgra32: n = 4; bgr = 1; break;
+            case SimdPixelFormatRgba32: n = 4; break;
+            default: return false;
+            }
+            if (data == NULL || size < 2 || data[0] != 0xFF || data[1] != 0xD8 || dst == NULL || width == 0 || height == 0 ||
+                left + width > JPEG_MAX_DIMENSIONS || top + height > JPEG_MAX_DIMENSIONS)
+                return false;
+            InputMemoryStream stream(data, size);
+            jpeg__context s;
+            jpeg__start_stream(&s, &stream);
+            jpeg__jpeg* z = (jpeg__jpeg*)jpeg__malloc(sizeof(jpeg__jpeg));
+            if (z == NULL)
+                return false;
+            z->s = &s;
+            jpeg__setup_jpeg(z);
+            z->threads = (int)Base::GetThreadNumber();
+            z->bgr = bgr;
+            z->roi_x = (int)left;
+            z->roi_y = (int)top;
+            z->roi_w = (int)width;
+            z->roi_h = (int)height;
+            s.img_n = 0;
+            int result = 0;
+            if (jpeg__decode_jpeg_image(z))
+                result = jpeg__convert_image(z, n, dst, stride);
+            else
+                jpeg__cleanup_jpeg(z);
+            JPEG_FREE(z);
+            return result != 0;
+        }
+
         //---------------------------------------------------------------------
 
         ImageJpegLoader::ImageJpegLoader(const ImageLoaderParam& param)
@@ -2180,22 +2685,17 @@ namespace Simd
         {
             int x, y, comp;
             jpeg__context s;
-            s.io.eof = jpeg__stdio_eof;
-            s.io.read = jpeg__stdio_read;
-            s.io.skip = jpeg__stdio_skip;
-            s.io_user_data = &_stream;
-            s.buflen = sizeof(s.buffer_start);
-            s.read_from_callbacks = 1;
-            s.callback_already_read = 0;
-            s.img_buffer = s.img_buffer_original = s.buffer_start;
-            jpeg__refill_buffer(&s);
-            s.img_buffer_original_end = s.img_buffer_end;
+            jpeg__start_stream(&s, &_stream);
             jpeg__result_info ri;
-            uint8_t * data = (uint8_t*)jpeg__jpeg_load(&s, &x, &y, &comp, 3, &ri);
+            uint8_t * data = (uint8_t*)jpeg__jpeg_load(&s, &x, &y, &comp, 3, (int)Base::GetThreadNumber(), (int)_param.scale, &ri);
             if (data)
             {
                 size_t stride = 3 * x;
-                _image.Recreate(x, y, (Image::Format)_param.format);
+                if (!PrepareImage(x, y))
+                {
+                    JPEG_FREE(data);
+                    return false;
+                }
                 switch (_param.format)
                 {
                 case SimdPixelFormatGray8:
@@ -598,6 +598,15 @@ namespace Simd
             }
             return NULL;
         }
+
+        void* JpegEncoderInit(size_t width, size_t height, SimdPixelFormatType format, int quality, SimdYuvType yuvType)
+        {
+            ImageSaverParam param = yuvType == SimdYuvUnknown ? ImageSaverParam(width, height, format, SimdImageFileJpeg, quality) :
+                ImageSaverParam(width, height, quality, yuvType);
+            if (!param.Validate())
+                return NULL;
+            return new ImageJpegSaver(param);
+        }
     }
 #endif// SIMD_SSE41_ENABLE
 }
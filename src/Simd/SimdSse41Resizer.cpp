@@ -41,6 +41,8 @@ namespace Simd
                 return new ResizerShortBilinear(param);
             else if (param.IsByteBicubic())
                 return new ResizerByteBicubic(param);
+            else if (param.IsFilter())
+                return new ResizerFilter(param);
             else if (param.IsByteArea2x2())
                 return new ResizerByteArea2x2(param);
             else if (param.IsByteArea1x1())
@@ -0,0 +1,241 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdResizerCommon.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        template<class T> SIMD_INLINE __m128 ResizerFilterLoad(const T* src);
+
+        template<> SIMD_INLINE __m128 ResizerFilterLoad<uint8_t>(const uint8_t* src)
+        {
+            return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)src)));
+        }
+
+        template<> SIMD_INLINE __m128 ResizerFilterLoad<uint16_t>(const uint16_t* src)
+        {
+            return _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)src)));
+        }
+
+        template<> SIMD_INLINE __m128 ResizerFilterLoad<float>(const float* src)
+        {
+            return _mm_loadu_ps(src);
+        }
+
+        template<size_t N> SIMD_INLINE void ResizerFilterStore(__m128 value, uint8_t* dst)
+        {
+            __m128i u8 = _mm_packus_epi16(_mm_packus_epi32(_mm_cvtps_epi32(value), K_ZERO), K_ZERO);
+            if (N == 4)
+                *(int32_t*)dst = _mm_cvtsi128_si32(u8);
+            else
+            {
+                int32_t tmp = _mm_cvtsi128_si32(u8);
+                for (size_t c = 0; c < N; ++c)
+                    dst[c] = ((uint8_t*)&tmp)[c];
+            }
+        }
+
+        template<size_t N> SIMD_INLINE void ResizerFilterStore(__m128 value, uint16_t* dst)
+        {
+            __m128i u16 = _mm_packus_epi32(_mm_cvtps_epi32(value), K_ZERO);
+            if (N == 4)
+                _mm_storel_epi64((__m128i*)dst, u16);
+            else if (N == 2)
+                *(int32_t*)dst = _mm_cvtsi128_si32(u16);
+            else
+            {
+                SIMD_ALIGNED(16) uint16_t tmp[HA];
+                _mm_store_si128((__m128i*)tmp, u16);
+                for (size_t c = 0; c < N; ++c)
+                    dst[c] = tmp[c];
+            }
+        }
+
+        template<size_t N> SIMD_INLINE void ResizerFilterStore(__m128 value, float* dst)
+        {
+            if (N == 4)
+                _mm_storeu_ps(dst, value);
+            else
+            {
+                SIMD_ALIGNED(16) float tmp[F];
+                _mm_store_ps(tmp, value);
+                for (size_t c = 0; c < N; ++c)
+                    dst[c] = tmp[c];
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        template<class T> SIMD_INLINE void ResizerFilterRowVert1(const uint8_t* src, size_t stride, const float* ay, size_t ky, float* dst)
+        {
+            __m128 sum = _mm_mul_ps(ResizerFilterLoad((const T*)src), _mm_set1_ps(ay[0]));
+            for (size_t k = 1; k < ky; ++k)
+                sum = _mm_add_ps(sum, _mm_mul_ps(ResizerFilterLoad((const T*)(src + k * stride)), _mm_set1_ps(ay[k])));
+            _mm_storeu_ps(dst, sum);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFilterRowVert2(const uint8_t* src, size_t stride, const float* ay, size_t ky, float* dst)
+        {
+            __m128 _ay = _mm_set1_ps(ay[0]);
+            __m128 sum0 = _mm_mul_ps(ResizerFilterLoad((const T*)src + 0), _ay);
+            __m128 sum1 = _mm_mul_ps(ResizerFilterLoad((const T*)src + F), _ay);
+            for (size_t k = 1; k < ky; ++k)
+            {
+                const T* ps = (const T*)(src + k * stride);
+                _ay = _mm_set1_ps(ay[k]);
+                sum0 = _mm_add_ps(sum0, _mm_mul_ps(ResizerFilterLoad(ps + 0), _ay));
+                sum1 = _mm_add_ps(sum1, _mm_mul_ps(ResizerFilterLoad(ps + F), _ay));
+            }
+            _mm_storeu_ps(dst + 0, sum0);
+            _mm_storeu_ps(dst + F, sum1);
+        }
+
+        template<class T> void ResizerFilterRowVert(const uint8_t* src, size_t stride, size_t size, const float* ay, size_t ky, float* dst)
+        {
+            if (size < F)
+            {
+                const T* ps = (const T*)src;
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] = float(ps[i]) * ay[0];
+                for (size_t k = 1; k < ky; ++k)
+                {
+                    ps = (const T*)(src + k * stride);
+                    for (size_t i = 0; i < size; ++i)
+                        dst[i] += float(ps[i]) * ay[k];
+                }
+                return;
+            }
+            size_t size2F = AlignLo(size, 2 * F), sizeF = AlignLo(size, F), i = 0;
+            for (; i < size2F; i += 2 * F)
+                ResizerFilterRowVert2<T>(src + i * sizeof(T), stride, ay, ky, dst + i);
+            for (; i < sizeF; i += F)
+                ResizerFilterRowVert1<T>(src + i * sizeof(T), stride, ay, ky, dst + i);
+            if (i < size)
+                ResizerFilterRowVert1<T>(src + (size - F) * sizeof(T), stride, ay, ky, dst + size - F);
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m128 ResizerFilterDot(const float* src, const float* ax, size_t kx)
+        {
+            __m128 sum = _mm_mul_ps(_mm_loadu_ps(src), _mm_loadu_ps(ax));
+            for (size_t k = F; k < kx; k += F)
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + k), _mm_loadu_ps(ax + k)));
+            return sum;
+        }
+
+        template<class T> void ResizerFilterRowHorz1(const float* src, size_t width, const int32_t* ix, const float* ax, size_t kx, uint8_t* dst)
+        {
+            T* pd = (T*)dst;
+            size_t width4 = AlignLo(width, 4), dx = 0;
+            for (; dx < width4; dx += 4, ax += 4 * kx)
+            {
+                __m128 sum0 = ResizerFilterDot(src + ix[dx + 0], ax + 0 * kx, kx);
+                __m128 sum1 = ResizerFilterDot(src + ix[dx + 1], ax + 1 * kx, kx);
+                __m128 sum2 = ResizerFilterDot(src + ix[dx + 2], ax + 2 * kx, kx);
+                __m128 sum3 = ResizerFilterDot(src + ix[dx + 3], ax + 3 * kx, kx);
+                ResizerFilterStore<4>(_mm_hadd_ps(_mm_hadd_ps(sum0, sum1), _mm_hadd_ps(sum2, sum3)), pd + dx);
+            }
+            for (; dx < width; dx += 1, ax += kx)
+            {
+                __m128 sum = ResizerFilterDot(src + ix[dx], ax, kx);
+                sum = _mm_hadd_ps(sum, sum);
+                ResizerFilterStore<1>(_mm_hadd_ps(sum, sum), pd + dx);
+            }
+        }
+
+        template<class T> void ResizerFilterRowHorz2(const float* src, size_t width, const int32_t* ix, const float* ax, size_t kx, uint8_t* dst)
+        {
+            T* pd = (T*)dst;
+            for (size_t dx = 0; dx < width; dx++, ax += kx, pd += 2)
+            {
+                const float* ps = src + ix[dx];
+                __m128 sum = _mm_setzero_ps();
+                for (size_t k = 0; k < kx; k += F)
+                {
+                    __m128 _ax = _mm_loadu_ps(ax + k);
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(ps + 2 * k + 0), _mm_unpacklo_ps(_ax, _ax)));
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(ps + 2 * k + F), _mm_unpackhi_ps(_ax, _ax)));
+                }
+                ResizerFilterStore<2>(_mm_add_ps(sum, _mm_movehl_ps(sum, sum)), pd);
+            }
+        }
+
+        template<class T, size_t N> void ResizerFilterRowHorzN(const float* src, size_t width, const int32_t* ix, const float* ax, size_t kx, uint8_t* dst)
+        {
+            T* pd = (T*)dst;
+            for (size_t dx = 0; dx < width; dx++, ax += kx, pd += N)
+            {
+                const float* ps = src + ix[dx];
+                __m128 sum = _mm_mul_ps(_mm_loadu_ps(ps), _mm_set1_ps(ax[0]));
+                for (size_t k = 1; k < kx; ++k)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(ps + k * N), _mm_set1_ps(ax[k])));
+                ResizerFilterStore<N>(sum, pd);
+            }
+        }
+
+        template<class T> Base::ResizerFilter::RowHorzPtr GetResizerFilterRowHorz(size_t channels)
+        {
+            switch (channels)
+            {
+            case 1: return ResizerFilterRowHorz1<T>;
+            case 2: return ResizerFilterRowHorz2<T>;
+            case 3: return ResizerFilterRowHorzN<T, 3>;
+            case 4: return ResizerFilterRowHorzN<T, 4>;
+            default:
+                assert(0); return NULL;
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        ResizerFilter::ResizerFilter(const ResParam& param)
+            : Base::ResizerFilter(param)
+        {
+            switch (_param.type)
+            {
+            case SimdResizeChannelByte:
+                _rowVert = ResizerFilterRowVert<uint8_t>;
+                _rowHorz = GetResizerFilterRowHorz<uint8_t>(_param.channels);
+                break;
+            case SimdResizeChannelShort:
+                _rowVert = ResizerFilterRowVert<uint16_t>;
+                _rowHorz = GetResizerFilterRowHorz<uint16_t>(_param.channels);
+                break;
+            case SimdResizeChannelFloat:
+                _rowVert = ResizerFilterRowVert<float>;
+                _rowHorz = GetResizerFilterRowHorz<float>(_param.channels);
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif
+}
@@ -88,10 +88,11 @@ namespace Simd
             }
         }
 
-        void ResizerNearest::Shuffle16x1(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        void ResizerNearest::Shuffle16x1(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd)
         {
             size_t body = _blocks - _tails;
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++)
             {
                 const uint8_t* srcRow = src + _iy[dy] * srcStride;
                 size_t i = 0, t = 0;
@@ -119,10 +120,11 @@ namespace Simd
             _mm_storeu_si128((__m128i*)dst, val);
         }
         
-        void ResizerNearest::Resize12(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        void ResizerNearest::Resize12(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd)
         {
             size_t body = _param.dstW - 1;
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            dst += yBeg * dstStride;
+            for (size_t dy = yBeg; dy < yEnd; dy++)
             {
                 const uint8_t* srcRow = src + _iy[dy] * srcStride;
                 size_t dx = 0, offset = 0;
@@ -133,15 +135,15 @@ namespace Simd
             }
         }
 
-        void ResizerNearest::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        void ResizerNearest::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, size_t yBeg, size_t yEnd, size_t band)
         {
             EstimateParams();
             if (_blocks)
-                Shuffle16x1(src, srcStride, dst, dstStride);
+                Shuffle16x1(src, srcStride, dst, dstStride, yBeg, yEnd);
             else if (_pixelSize == 12)
-                Resize12(src, srcStride, dst, dstStride);
+                Resize12(src, srcStride, dst, dstStride, yBeg, yEnd);
             else
-                Base::ResizerNearest::Run(src, srcStride, dst, dstStride);
+                Base::ResizerNearest::Run(src, srcStride, dst, dstStride, yBeg, yEnd, band);
         }
     }
 #endif
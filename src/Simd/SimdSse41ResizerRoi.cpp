@@ -0,0 +1,230 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizerRoi.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template<class T> SIMD_INLINE __m128 RoiLoad(const T* src);
+
+        template<> SIMD_INLINE __m128 RoiLoad(const uint8_t* src)
+        {
+            return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)src)));
+        }
+
+        template<> SIMD_INLINE __m128 RoiLoad(const float* src)
+        {
+            return _mm_loadu_ps(src);
+        }
+
+        template<class T> SIMD_INLINE void ResizerRoiVert(const T* src0, const T* src1, __m128 alpha, float* dst)
+        {
+            __m128 s0 = RoiLoad(src0);
+            _mm_storeu_ps(dst, _mm_add_ps(s0, _mm_mul_ps(_mm_sub_ps(RoiLoad(src1), s0), alpha)));
+        }
+
+        template<class T> void ResizerRoiVert(const uint8_t* src0, const uint8_t* src1, float alpha, size_t size, float* dst)
+        {
+            const T* s0 = (const T*)src0;
+            const T* s1 = (const T*)src1;
+            if (size >= F)
+            {
+                __m128 _alpha = _mm_set1_ps(alpha);
+                size_t sizeF = AlignLo(size, F), sizeQF = AlignLo(size, QF), i = 0;
+                for (; i < sizeQF; i += QF)
+                {
+                    ResizerRoiVert(s0 + i + 0 * F, s1 + i + 0 * F, _alpha, dst + i + 0 * F);
+                    ResizerRoiVert(s0 + i + 1 * F, s1 + i + 1 * F, _alpha, dst + i + 1 * F);
+                    ResizerRoiVert(s0 + i + 2 * F, s1 + i + 2 * F, _alpha, dst + i + 2 * F);
+                    ResizerRoiVert(s0 + i + 3 * F, s1 + i + 3 * F, _alpha, dst + i + 3 * F);
+                }
+                for (; i < sizeF; i += F)
+                    ResizerRoiVert(s0 + i, s1 + i, _alpha, dst + i);
+                if (i < size)
+                    ResizerRoiVert(s0 + size - F, s1 + size - F, _alpha, dst + size - F);
+            }
+            else
+            {
+                for (size_t i = 0; i < size; ++i)
+                {
+                    float v0 = (float)s0[i];
+                    dst[i] = v0 + ((float)s1[i] - v0) * alpha;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m128 RoiLerp(__m128 s0, __m128 s1, __m128 alpha)
+        {
+            return _mm_add_ps(s0, _mm_mul_ps(_mm_sub_ps(s1, s0), alpha));
+        }
+
+        template<size_t C> void ResizerRoiHorz(const float* src, const int32_t* ix, const float* ax, size_t width, float* dst);
+
+        template<> void ResizerRoiHorz<1>(const float* src, const int32_t* ix, const float* ax, size_t width, float* dst)
+        {
+            size_t widthF = AlignLo(width, F), x = 0;
+            for (; x < widthF; x += F)
+            {
+                __m128 s0 = _mm_setr_ps(src[ix[x + 0]], src[ix[x + 1]], src[ix[x + 2]], src[ix[x + 3]]);
+                __m128 s1 = _mm_setr_ps(src[ix[x + 0] + 1], src[ix[x + 1] + 1], src[ix[x + 2] + 1], src[ix[x + 3] + 1]);
+                _mm_storeu_ps(dst + x, RoiLerp(s0, s1, _mm_loadu_ps(ax + x)));
+            }
+            for (; x < width; ++x)
+            {
+                const float* s = src + ix[x];
+                dst[x] = s[0] + (s[1] - s[0]) * ax[x];
+            }
+        }
+
+        template<> void ResizerRoiHorz<2>(const float* src, const int32_t* ix, const float* ax, size_t width, float* dst)
+        {
+            size_t width2 = AlignLo(width, 2), x = 0;
+            for (; x < width2; x += 2, dst += 4)
+            {
+                const float* s0 = src + ix[x + 0], * s1 = src + ix[x + 1];
+                __m128 lo = _mm_loadh_pi(_mm_castpd_ps(_mm_load_sd((double*)s0)), (__m64*)s1);
+                __m128 hi = _mm_loadh_pi(_mm_castpd_ps(_mm_load_sd((double*)(s0 + 2))), (__m64*)(s1 + 2));
+                __m128 alpha = _mm_setr_ps(ax[x + 0], ax[x + 0], ax[x + 1], ax[x + 1]);
+                _mm_storeu_ps(dst, RoiLerp(lo, hi, alpha));
+            }
+            for (; x < width; ++x, dst += 2)
+            {
+                const float* s = src + ix[x];
+                dst[0] = s[0] + (s[2] - s[0]) * ax[x];
+                dst[1] = s[1] + (s[3] - s[1]) * ax[x];
+            }
+        }
+
+        template<> void ResizerRoiHorz<3>(const float* src, const int32_t* ix, const float* ax, size_t width, float* dst)
+        {
+            for (size_t x = 0; x < width; ++x, dst += 3)
+            {
+                const float* s = src + ix[x];
+                _mm_storeu_ps(dst, RoiLerp(_mm_loadu_ps(s), _mm_loadu_ps(s + 3), _mm_set1_ps(ax[x])));
+            }
+        }
+
+        template<> void ResizerRoiHorz<4>(const float* src, const int32_t* ix, const float* ax, size_t width, float* dst)
+        {
+            for (size_t x = 0; x < width; ++x, dst += 4)
+            {
+                const float* s = src + ix[x];
+                _mm_storeu_ps(dst, RoiLerp(_mm_loadu_ps(s), _mm_loadu_ps(s + 4), _mm_set1_ps(ax[x])));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m128i RoiRound(const float* src)
+        {
+            return _mm_cvtps_epi32(_mm_loadu_ps(src));
+        }
+
+        SIMD_INLINE void ResizerRoiStore16(const float* src, uint8_t* dst)
+        {
+            __m128i lo = _mm_packs_epi32(RoiRound(src + 0 * F), RoiRound(src + 1 * F));
+            __m128i hi = _mm_packs_epi32(RoiRound(src + 2 * F), RoiRound(src + 3 * F));
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(lo, hi));
+        }
+
+        void ResizerRoiStore(const float* src, size_t size, uint8_t* dst)
+        {
+            size_t i = 0;
+            if (size >= A)
+            {
+                size_t sizeA = AlignLo(size, A);
+                for (; i < sizeA; i += A)
+                    ResizerRoiStore16(src + i, dst + i);
+                if (i < size)
+                    ResizerRoiStore16(src + size - A, dst + size - A);
+                return;
+            }
+            for (; i < size; ++i)
+                dst[i] = (uint8_t)Simd::RestrictRange(Round(src[i]), 0, 255);
+        }
+
+        template<class T, size_t C> void ResizerRoiHorz(const float* src, const int32_t* ix, const float* ax, size_t width, size_t channels, float* buf, uint8_t* dst)
+        {
+            if (sizeof(T) == 4 && C != 3)
+                ResizerRoiHorz<C>(src, ix, ax, width, (float*)dst);
+            else
+            {
+                ResizerRoiHorz<C>(src, ix, ax, width, buf);
+                if (sizeof(T) == 4)
+                    memcpy(dst, buf, width * C * sizeof(float));
+                else
+                    ResizerRoiStore(buf, width * C, dst);
+            }
+        }
+
+        template<class T> Base::ResizerRoi::HorzPtr GetResizerRoiHorz(size_t channels)
+        {
+            switch (channels)
+            {
+            case 1: return ResizerRoiHorz<T, 1>;
+            case 2: return ResizerRoiHorz<T, 2>;
+            case 3: return ResizerRoiHorz<T, 3>;
+            case 4: return ResizerRoiHorz<T, 4>;
+            default:
+                return NULL;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ResizerRoi::ResizerRoi(const Base::RoiResParam& param)
+            : Base::ResizerRoi(param)
+        {
+            Base::ResizerRoi::HorzPtr horz = NULL;
+            if (_param.type == SimdResizeChannelFloat)
+            {
+                _vert = ResizerRoiVert<float>;
+                horz = GetResizerRoiHorz<float>(_param.channels);
+            }
+            else
+            {
+                _vert = ResizerRoiVert<uint8_t>;
+                horz = GetResizerRoiHorz<uint8_t>(_param.channels);
+            }
+            if (horz)
+                _horz = horz;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerRoiInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            Base::RoiResParam param(srcX, srcY, dstX, dstY, channels, type, method);
+            if (!param.Valid())
+                return NULL;
+            return new ResizerRoi(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,313 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetInputResizer.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#if defined(SIMD_SSE41_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i InputResizerBgrToGray(__m128i b, __m128i g, __m128i r)
+        {
+            __m128i sum = _mm_add_epi32(_mm_mullo_epi32(b, _mm_set1_epi32(Base::BLUE_TO_GRAY_WEIGHT)), _mm_mullo_epi32(g, _mm_set1_epi32(Base::GREEN_TO_GRAY_WEIGHT)));
+            sum = _mm_add_epi32(sum, _mm_mullo_epi32(r, _mm_set1_epi32(Base::RED_TO_GRAY_WEIGHT)));
+            return _mm_srli_epi32(_mm_add_epi32(sum, _mm_set1_epi32(Base::BGR_TO_GRAY_ROUND_TERM)), Base::BGR_TO_GRAY_AVERAGING_SHIFT);
+        }
+
+        template<size_t C> SIMD_INLINE void InputResizerBgr(__m128i b, __m128i g, __m128i r, __m128i* dst)
+        {
+            if (C == 1)
+                dst[0] = InputResizerBgrToGray(b, g, r);
+            else
+                dst[0] = b, dst[1] = g, dst[2] = r;
+        }
+
+        SIMD_INLINE __m128i InputResizerGather(const uint8_t* src, const int32_t* ix)
+        {
+            return _mm_setr_epi32(src[ix[0]], src[ix[2]], src[ix[4]], src[ix[6]]);
+        }
+
+        struct InputResizerGray8
+        {
+            template<size_t C> static SIMD_INLINE void Get(const uint8_t* const* src, const int32_t* ix, __m128i* dst)
+            {
+                __m128i gray = InputResizerGather(src[0], ix);
+                for (size_t c = 0; c < C; ++c)
+                    dst[c] = gray;
+            }
+        };
+
+        template<size_t step> SIMD_INLINE int32_t InputResizerLoad(const uint8_t* src)
+        {
+            return step == 4 ? *(int32_t*)src : (*(uint16_t*)src | (src[2] << 16));
+        }
+
+        template<size_t step, bool rgb> struct InputResizerBgr24
+        {
+            template<size_t C> static SIMD_INLINE void Get(const uint8_t* const* src, const int32_t* ix, __m128i* dst)
+            {
+                const uint8_t* ps = src[0];
+                __m128i pixels = _mm_setr_epi32(InputResizerLoad<step>(ps + ix[0] * step), InputResizerLoad<step>(ps + ix[2] * step),
+                    InputResizerLoad<step>(ps + ix[4] * step), InputResizerLoad<step>(ps + ix[6] * step));
+                __m128i c0 = _mm_and_si128(pixels, K32_000000FF);
+                __m128i c1 = _mm_and_si128(_mm_srli_epi32(pixels, 8), K32_000000FF);
+                __m128i c2 = _mm_and_si128(_mm_srli_epi32(pixels, 16), K32_000000FF);
+                if (rgb)
+                    InputResizerBgr<C>(c2, c1, c0, dst);
+                else
+                    InputResizerBgr<C>(c0, c1, c2, dst);
+            }
+        };
+
+        template<class T> SIMD_INLINE __m128i InputResizerYuvToBgr(__m128i y, __m128i u, __m128i v, int yk, int uk, int vk)
+        {
+            __m128i sum = _mm_mullo_epi32(y, _mm_set1_epi32(yk));
+            if (uk)
+                sum = _mm_add_epi32(sum, _mm_mullo_epi32(u, _mm_set1_epi32(uk)));
+            if (vk)
+                sum = _mm_add_epi32(sum, _mm_mullo_epi32(v, _mm_set1_epi32(vk)));
+            sum = _mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(T::F_ROUND)), T::F_SHIFT);
+            return _mm_min_epi32(_mm_max_epi32(sum, K_ZERO), K32_000000FF);
+        }
+
+        template<class T, size_t C> SIMD_INLINE void InputResizerYuv(__m128i y, __m128i u, __m128i v, __m128i* dst)
+        {
+            y = _mm_sub_epi32(y, _mm_set1_epi32(T::Y_LO));
+            u = _mm_sub_epi32(u, _mm_set1_epi32(T::UV_Z));
+            v = _mm_sub_epi32(v, _mm_set1_epi32(T::UV_Z));
+            InputResizerBgr<C>(InputResizerYuvToBgr<T>(y, u, v, T::Y_2_A, T::U_2_B, 0),
+                InputResizerYuvToBgr<T>(y, u, v, T::Y_2_A, T::U_2_G, T::V_2_G),
+                InputResizerYuvToBgr<T>(y, u, v, T::Y_2_A, 0, T::V_2_R), dst);
+        }
+
+        template<class T> struct InputResizerNv12
+        {
+            template<size_t C> static SIMD_INLINE void Get(const uint8_t* const* src, const int32_t* ix, __m128i* dst)
+            {
+                const uint16_t* uv = (const uint16_t*)src[1];
+                __m128i _uv = _mm_setr_epi32(uv[ix[0] >> 1], uv[ix[2] >> 1], uv[ix[4] >> 1], uv[ix[6] >> 1]);
+                InputResizerYuv<T, C>(InputResizerGather(src[0], ix), _mm_and_si128(_uv, K32_000000FF), _mm_srli_epi32(_uv, 8), dst);
+            }
+        };
+
+        template<class T> struct InputResizerYuv420p
+        {
+            template<size_t C> static SIMD_INLINE void Get(const uint8_t* const* src, const int32_t* ix, __m128i* dst)
+            {
+                const uint8_t* u = src[1], * v = src[2];
+                InputResizerYuv<T, C>(InputResizerGather(src[0], ix), 
+                    _mm_setr_epi32(u[ix[0] >> 1], u[ix[2] >> 1], u[ix[4] >> 1], u[ix[6] >> 1]),
+                    _mm_setr_epi32(v[ix[0] >> 1], v[ix[2] >> 1], v[ix[4] >> 1], v[ix[6] >> 1]), dst);
+            }
+        };
+
+        template<size_t C, bool nchw> SIMD_INLINE void InputResizerHorzStore(const __m128* val, size_t width, float* dst)
+        {
+            if (C == 1 || nchw)
+            {
+                for (size_t c = 0; c < C; ++c)
+                    _mm_storeu_ps(dst + c * width, val[c]);
+            }
+            else
+            {
+                __m128 bg = _mm_unpacklo_ps(val[0], val[1]), rb = _mm_unpacklo_ps(val[2], val[0]);
+                _mm_storeu_ps(dst + 0 * F, _mm_shuffle_ps(bg, rb, 0xC4));
+                __m128 gr = _mm_unpacklo_ps(val[1], val[2]);
+                bg = _mm_unpackhi_ps(val[0], val[1]);
+                _mm_storeu_ps(dst + 1 * F, _mm_shuffle_ps(gr, bg, 0x4E));
+                rb = _mm_unpackhi_ps(val[2], val[0]);
+                gr = _mm_unpackhi_ps(val[1], val[2]);
+                _mm_storeu_ps(dst + 2 * F, _mm_shuffle_ps(rb, gr, 0xEC));
+            }
+        }
+
+        template<class P, size_t C, bool nchw> SIMD_INLINE void InputResizerHorz4(const uint8_t* const* src, const int32_t* ix, 
+            const float* ax, size_t width, const __m128* scale, const __m128* shift, float* dst)
+        {
+            __m128i p0[C], p1[C];
+            P::template Get<C>(src, ix + 0, p0);
+            P::template Get<C>(src, ix + 1, p1);
+            __m128 ax0 = _mm_loadu_ps(ax + 0), ax1 = _mm_loadu_ps(ax + F);
+            __m128 a0 = _mm_shuffle_ps(ax0, ax1, 0x88), a1 = _mm_shuffle_ps(ax0, ax1, 0xDD);
+            __m128 val[C];
+            for (size_t c = 0; c < C; ++c)
+            {
+                __m128 sum = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(p0[c]), a0), _mm_mul_ps(_mm_cvtepi32_ps(p1[c]), a1));
+                val[c] = _mm_add_ps(_mm_mul_ps(sum, scale[c]), shift[c]);
+            }
+            InputResizerHorzStore<C, nchw>(val, width, dst);
+        }
+
+        template<class P, size_t C, bool nchw> void InputResizerHorz(const uint8_t* const* src, const int32_t* ix, const float* ax,
+            size_t width, const float* scale, const float* shift, float* dst)
+        {
+            assert(width >= F);
+            __m128 _scale[C], _shift[C];
+            for (size_t c = 0; c < C; ++c)
+                _scale[c] = _mm_set1_ps(scale[c]), _shift[c] = _mm_set1_ps(shift[c]);
+            const size_t step = (C == 1 || nchw) ? 1 : C;
+            size_t widthF = AlignLo(width, F), x = 0;
+            for (; x < widthF; x += F)
+                InputResizerHorz4<P, C, nchw>(src, ix + 2 * x, ax + 2 * x, width, _scale, _shift, dst + x * step);
+            if (x < width)
+            {
+                x = width - F;
+                InputResizerHorz4<P, C, nchw>(src, ix + 2 * x, ax + 2 * x, width, _scale, _shift, dst + x * step);
+            }
+        }
+
+        template<class P, size_t C> Base::SynetInputResizer::HorzPtr GetInputResizerHorz(SimdTensorFormatType format)
+        {
+            return format == SimdTensorFormatNchw ? InputResizerHorz<P, C, true> : InputResizerHorz<P, C, false>;
+        }
+
+        template<class P> Base::SynetInputResizer::HorzPtr GetInputResizerHorz(const Base::InputResizerParam& p)
+        {
+            return p.channels == 1 ? InputResizerHorz<P, 1, false> : GetInputResizerHorz<P, 3>(p.dstFormat);
+        }
+
+        template<class T> Base::SynetInputResizer::HorzPtr GetInputResizerHorzYuv(const Base::InputResizerParam& p)
+        {
+            switch (p.yuvLayout)
+            {
+            case SimdYuvLayoutNv12: return GetInputResizerHorz<InputResizerNv12<T>>(p);
+            case SimdYuvLayoutYuv420p: return GetInputResizerHorz<InputResizerYuv420p<T>>(p);
+            default:
+                assert(0); return NULL;
+            }
+        }
+
+        static Base::SynetInputResizer::HorzPtr GetInputResizerHorz(const Base::InputResizerParam& p)
+        {
+            if (p.IsYuv())
+            {
+                if (p.yuvLayout == SimdYuvLayoutGray8)
+                    return GetInputResizerHorz<InputResizerGray8>(p);
+                switch (p.yuvType)
+                {
+                case SimdYuvBt601: return GetInputResizerHorzYuv<Base::Bt601>(p);
+                case SimdYuvBt709: return GetInputResizerHorzYuv<Base::Bt709>(p);
+                case SimdYuvBt2020: return GetInputResizerHorzYuv<Base::Bt2020>(p);
+                case SimdYuvTrect871: return GetInputResizerHorzYuv<Base::Trect871>(p);
+                default:
+                    assert(0); return NULL;
+                }
+            }
+            switch (p.srcFormat)
+            {
+            case SimdPixelFormatGray8: return GetInputResizerHorz<InputResizerGray8>(p);
+            case SimdPixelFormatBgr24: return GetInputResizerHorz<InputResizerBgr24<3, false>>(p);
+            case SimdPixelFormatBgra32: return GetInputResizerHorz<InputResizerBgr24<4, false>>(p);
+            case SimdPixelFormatRgb24: return GetInputResizerHorz<InputResizerBgr24<3, true>>(p);
+            case SimdPixelFormatRgba32: return GetInputResizerHorz<InputResizerBgr24<4, true>>(p);
+            default:
+                assert(0); return NULL;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m128 InputResizerLerp(const float* src0, const float* src1, __m128 alpha)
+        {
+            __m128 s0 = _mm_loadu_ps(src0);
+            return _mm_add_ps(s0, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(src1), s0), alpha));
+        }
+
+        template<SimdTensorDataType type> SIMD_INLINE void InputResizerStore(__m128 value, uint8_t* dst);
+
+        template<> SIMD_INLINE void InputResizerStore<SimdTensorData32f>(__m128 value, uint8_t* dst)
+        {
+            _mm_storeu_ps((float*)dst, value);
+        }
+
+        template<> SIMD_INLINE void InputResizerStore<SimdTensorData16b>(__m128 value, uint8_t* dst)
+        {
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi32(Float32ToBFloat16(value), K_ZERO));
+        }
+
+        template<> SIMD_INLINE void InputResizerStore<SimdTensorData8u>(__m128 value, uint8_t* dst)
+        {
+            __m128i i32 = _mm_cvtps_epi32(value);
+            *(int32_t*)dst = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(i32, K_ZERO), K_ZERO));
+        }
+
+        template<SimdTensorDataType type> void InputResizerVert(const float* src0, const float* src1, float alpha, size_t size, uint8_t* dst)
+        {
+            const size_t elem = type == SimdTensorData32f ? 4 : (type == SimdTensorData16b ? 2 : 1);
+            __m128 _alpha = _mm_set1_ps(alpha);
+            if (size < F)
+            {
+                float buf0[F] = { 0 }, buf1[F] = { 0 };
+                SIMD_ALIGNED(16) uint8_t buf[F * 4];
+                for (size_t i = 0; i < size; ++i)
+                    buf0[i] = src0[i], buf1[i] = src1[i];
+                InputResizerStore<type>(InputResizerLerp(buf0, buf1, _alpha), buf);
+                memcpy(dst, buf, size * elem);
+                return;
+            }
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                InputResizerStore<type>(InputResizerLerp(src0 + i, src1 + i, _alpha), dst + i * elem);
+            if (i < size)
+            {
+                i = size - F;
+                InputResizerStore<type>(InputResizerLerp(src0 + i, src1 + i, _alpha), dst + i * elem);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetInputResizer::SynetInputResizer(const Base::InputResizerParam& param)
+            : Base::SynetInputResizer(param)
+        {
+            if (_param.dstW >= F)
+                _horz = GetInputResizerHorz(_param);
+            switch (_param.dstType)
+            {
+            case SimdTensorData32f: _vert = InputResizerVert<SimdTensorData32f>; break;
+            case SimdTensorData16b: _vert = InputResizerVert<SimdTensorData16b>; break;
+            case SimdTensorData8u: _vert = InputResizerVert<SimdTensorData8u>; break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetInputResizerInit(SimdPixelFormatType srcFormat, SimdYuvLayoutType yuvLayout, SimdYuvType yuvType,
+            size_t cropX, size_t cropY, size_t cropWidth, size_t cropHeight, size_t dstWidth, size_t dstHeight, size_t channels,
+            const float* mean, const float* scale, SimdTensorDataType dstType, SimdTensorFormatType dstFormat)
+        {
+            Base::InputResizerParam param(srcFormat, yuvLayout, yuvType, cropX, cropY, cropWidth, cropHeight, dstWidth, dstHeight, channels, mean, scale, dstType, dstFormat);
+            if (!param.Valid())
+                return NULL;
+            return new SynetInputResizer(param);
+        }
+    }
+#endif
+}
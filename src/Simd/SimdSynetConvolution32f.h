@@ -28,6 +28,7 @@
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetWorkspace.h"
 
 #ifdef _N
 #undef _N
@@ -94,6 +95,17 @@ namespace Simd
         return (p.padX + p.srcW - (p.kernelX - 1) * p.dilationX - 1) / p.strideX + 1;
     }
 
+    SIMD_INLINE size_t SrcBegY(const SimdConvolutionParameters& p, size_t dy)
+    {
+        return dy * p.strideY > p.padY ? dy * p.strideY - p.padY : 0;
+    }
+
+    SIMD_INLINE size_t SrcEndY(const SimdConvolutionParameters& p, size_t dy)
+    {
+        size_t end = (dy - 1) * p.strideY + (p.kernelY - 1) * p.dilationY + 1;
+        return end > p.padY ? end - p.padY : 0;
+    }
+
     //---------------------------------------------------------------------------------------------
 
     struct ConvParam32f : public SimdConvolutionParameters
@@ -224,6 +236,9 @@ namespace Simd
             , _nhwcRun(0)
             , _nhwcReorderB(0)
             , _biasAndActivation(0)
+            , _workspace(NULL)
+            , _threads(Base::GetThreadNumber())
+            , _context(Base::ThreadContextCurrent())
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
             , _perf(NULL)
 #endif
@@ -235,6 +250,11 @@ namespace Simd
             return _param;
         }
 
+        void * ThreadContext() const
+        {
+            return _context;
+        }
+
         virtual String Ext() const = 0;
         virtual String Desc() const = 0;
 
@@ -259,10 +279,34 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        virtual bool Tuned() const
+        {
+            return _gemm.Tuned() && _gemmCb.Tuned();
+        }
+
+        void Tune(const float * src, float * buf, float * dst)
+        {
+            Forward(src, buf, dst);
+            for (size_t i = 0; i < TUNE_FORWARD_MAX && !Tuned(); ++i)
+                Forward(src, buf, dst);
+        }
+
+        void SetWorkspace(SynetWorkspace * workspace)
+        {
+            _workspace = workspace;
+            if (_workspace)
+            {
+                _workspace->Reserve(ExternalBufferSize());
+                _buffer.Resize(0);
+            }
+        }
+
         float * Buffer(float * buffer)
         {
             if (buffer)
                 return buffer;
+            else if (_workspace)
+                return _workspace->Get(ExternalBufferSize());
             else
             {
                 _buffer.Resize(ExternalBufferSize());
@@ -285,6 +329,8 @@ namespace Simd
         typedef void(*NhwcRun)(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, GemmKernelType type, bool compatibility);
         typedef void(*BiasAndActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
+        static const size_t TUNE_FORWARD_MAX = 64;
+
         ConvParam32f _param;
         Array32f _buffer;
         float _0, _1;
@@ -295,6 +341,9 @@ namespace Simd
         NhwcRun _nhwcRun;
         NhwcReorderB _nhwcReorderB;
         BiasAndActivation _biasAndActivation;
+        SynetWorkspace * _workspace;
+        size_t _threads;
+        void * _context;
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer * _perf;
 #endif
@@ -321,6 +370,7 @@ namespace Simd
             virtual void ImgToCol(const float * src, float * dst);
             virtual void ImgToRow(const float * src, float * dst);
             bool GemmRuntime() const;
+            void ForwardTile(const float * src, size_t begin, size_t end, float * dst);
 
             bool _skipConv;
             size_t _M, _N, _K, _ldW, _ldS, _ldD, _grW, _grS, _grD, _batch, _sizeS, _sizeB, _sizeD, _merge;
@@ -440,6 +490,7 @@ namespace Simd
             virtual size_t InternalBufferSize() const;
             virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
             virtual void Forward(const float * src, float * buf, float * dst);
+            virtual bool Tuned() const { return SynetConvolution32f::Tuned() && _run.Tuned(); }
 
             static bool Preferable(const ConvParam32f & p);
 
@@ -461,13 +512,13 @@ namespace Simd
             size_t _sizeS, _sizeD;
             Array32f _rWeight, _rBias, _rParams;
 
-            static void Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst);
+            static void Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst, size_t threads);
 
             struct RunArgs
             {
-                const float* src; const ConvParam32f& p; const float* weight; const float* bias; const float* params; float* dst;
-                SIMD_INLINE RunArgs(const float* src_, const ConvParam32f& p_, const float* weight_, const float* bias_, const float* params_, float* dst_)
-                    :src(src_), p(p_), weight(weight_), bias(bias_), params(params_), dst(dst_)
+                const float* src; const ConvParam32f& p; const float* weight; const float* bias; const float* params; float* dst; size_t threads;
+                SIMD_INLINE RunArgs(const float* src_, const ConvParam32f& p_, const float* weight_, const float* bias_, const float* params_, float* dst_, size_t threads_)
+                    :src(src_), p(p_), weight(weight_), bias(bias_), params(params_), dst(dst_), threads(threads_)
                 {}
             };
 
@@ -482,17 +533,15 @@ namespace Simd
 
                 SIMD_INLINE void Run(const RunArgs& args)
                 {
-                    Forward(args.src, args.p, alg, args.weight, args.bias, args.params, args.dst);
+                    Forward(args.src, args.p, alg, args.weight, args.bias, args.params, args.dst, args.threads);
                 }
 
-#ifdef SIMD_RUNTIME_STATISTIC
                 SIMD_INLINE String Info(const RunArgs& args) const
                 {
                     std::stringstream ss;
                     ss << "NhwcDirect [" << args.p.Info() << "]";
                     return ss.str();
                 }
-#endif
 
                 AlgParam alg;
             private:
@@ -568,8 +617,9 @@ namespace Simd
             void SetWeight(const float* weight);
             void SetBias(const float* bias);
             void SetParams(const float* params);
-            void ForwardConv(const float* src, uint16_t* buf, float* dst);
-            void ForwardGemm(const float* src, uint16_t* buf, float* dst);
+            void ForwardConv(const float* src, size_t yBeg, size_t yEnd, uint16_t* buf, float* dst);
+            void ForwardGemm(const float* src, size_t yBeg, size_t yEnd, uint16_t* buf, float* dst);
+            size_t Stripes() const;
             size_t Offset(size_t yBeg, size_t cBeg, size_t cEnd);
 
             Array16u _weight;
@@ -28,6 +28,7 @@
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetWorkspace.h"
 
 #ifdef _N
 #undef _N
@@ -114,6 +115,7 @@ namespace Simd
             , _nhwcRun(0)
             , _nhwcReorderB(0)
             , _biasAndActivation(0)
+            , _workspace(NULL)
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
             , _perf(NULL)
 #endif
@@ -149,10 +151,34 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        virtual bool Tuned() const
+        {
+            return _gemm.Tuned() && _gemmCb.Tuned();
+        }
+
+        void Tune(const float * src, float * buf, float * dst)
+        {
+            Forward(src, buf, dst);
+            for (size_t i = 0; i < TUNE_FORWARD_MAX && !Tuned(); ++i)
+                Forward(src, buf, dst);
+        }
+
+        void SetWorkspace(SynetWorkspace * workspace)
+        {
+            _workspace = workspace;
+            if (_workspace)
+            {
+                _workspace->Reserve(ExternalBufferSize());
+                _buffer.Resize(0);
+            }
+        }
+
         float * Buffer(float * buffer)
         {
             if (buffer)
                 return buffer;
+            else if (_workspace)
+                return _workspace->Get(ExternalBufferSize());
             else
             {
                 _buffer.Resize(ExternalBufferSize());
@@ -175,6 +201,8 @@ namespace Simd
         typedef void(*NhwcRun)(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, GemmKernelType type, bool compatibility);
         typedef void(*BiasAndActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
+        static const size_t TUNE_FORWARD_MAX = 64;
+
         DeconvParam32f _param;
         Array32f _buffer;
         float _0, _1;
@@ -185,6 +213,7 @@ namespace Simd
         NhwcRun _nhwcRun;
         NhwcReorderB _nhwcReorderB;
         BiasAndActivation _biasAndActivation;
+        SynetWorkspace * _workspace;
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer * _perf;
 #endif
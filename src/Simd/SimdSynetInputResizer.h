@@ -0,0 +1,180 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetInputResizer_h__
+#define __SimdSynetInputResizer_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        struct InputResizerParam
+        {
+            SimdPixelFormatType srcFormat;
+            SimdYuvLayoutType yuvLayout;
+            SimdYuvType yuvType;
+            size_t cropX, cropY, cropW, cropH, dstW, dstH, channels;
+            float mean[3], scale[3];
+            SimdTensorDataType dstType;
+            SimdTensorFormatType dstFormat;
+
+            SIMD_INLINE InputResizerParam(SimdPixelFormatType sf, SimdYuvLayoutType yl, SimdYuvType yt, size_t cx, size_t cy, size_t cw, size_t ch,
+                size_t dw, size_t dh, size_t c, const float* m, const float* s, SimdTensorDataType dt, SimdTensorFormatType df)
+                : srcFormat(sf), yuvLayout(yl), yuvType(yt), cropX(cx), cropY(cy), cropW(cw), cropH(ch)
+                , dstW(dw), dstH(dh), channels(c), dstType(dt), dstFormat(df)
+            {
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    mean[i] = m && i < c ? m[i] : 0.0f;
+                    scale[i] = s && i < c ? s[i] : 1.0f;
+                }
+            }
+
+            SIMD_INLINE bool IsYuv() const
+            {
+                return srcFormat == SimdPixelFormatNone;
+            }
+
+            SIMD_INLINE bool Valid() const
+            {
+                if (cropW == 0 || cropH == 0 || dstW == 0 || dstH == 0)
+                    return false;
+                if (channels != 1 && channels != 3)
+                    return false;
+                if (dstType != SimdTensorData32f && dstType != SimdTensorData16b && dstType != SimdTensorData8u)
+                    return false;
+                if (dstFormat != SimdTensorFormatNchw && dstFormat != SimdTensorFormatNhwc)
+                    return false;
+                if (IsYuv())
+                {
+                    if (yuvLayout != SimdYuvLayoutGray8 && yuvLayout != SimdYuvLayoutNv12 && yuvLayout != SimdYuvLayoutYuv420p)
+                        return false;
+                    if (yuvLayout != SimdYuvLayoutGray8 && yuvType != SimdYuvBt601 && yuvType != SimdYuvBt709 && 
+                        yuvType != SimdYuvBt2020 && yuvType != SimdYuvTrect871)
+                        return false;
+                    return true;
+                }
+                return srcFormat == SimdPixelFormatGray8 || srcFormat == SimdPixelFormatBgr24 || srcFormat == SimdPixelFormatBgra32 ||
+                    srcFormat == SimdPixelFormatRgb24 || srcFormat == SimdPixelFormatRgba32;
+            }
+
+            SIMD_INLINE size_t ElemSize() const
+            {
+                switch (dstType)
+                {
+                case SimdTensorData32f: return 4;
+                case SimdTensorData16b: return 2;
+                case SimdTensorData8u: return 1;
+                default: assert(0); return 0;
+                }
+            }
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class SynetInputResizer : public Deletable
+        {
+        public:
+            SynetInputResizer(const InputResizerParam& param);
+
+            void Run(const uint8_t* const* src, const size_t* srcStride, uint8_t* dst);
+
+            typedef void (*HorzPtr)(const uint8_t* const* src, const int32_t* ix, const float* ax, size_t width, const float* scale, const float* shift, float* dst);
+            typedef void (*VertPtr)(const float* src0, const float* src1, float alpha, size_t size, uint8_t* dst);
+
+        protected:
+            void MakeRow(const uint8_t* const* src, const size_t* srcStride, size_t y, float* dst);
+
+            InputResizerParam _param;
+            Array32i _ix, _iy;
+            Array32f _ax, _ay, _rows;
+            float _shift[3];
+            size_t _rowSize;
+            HorzPtr _horz;
+            VertPtr _vert;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetInputResizerInit(SimdPixelFormatType srcFormat, SimdYuvLayoutType yuvLayout, SimdYuvType yuvType,
+            size_t cropX, size_t cropY, size_t cropWidth, size_t cropHeight, size_t dstWidth, size_t dstHeight, size_t channels,
+            const float* mean, const float* scale, SimdTensorDataType dstType, SimdTensorFormatType dstFormat);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SynetInputResizer : public Base::SynetInputResizer
+        {
+        public:
+            SynetInputResizer(const Base::InputResizerParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetInputResizerInit(SimdPixelFormatType srcFormat, SimdYuvLayoutType yuvLayout, SimdYuvType yuvType,
+            size_t cropX, size_t cropY, size_t cropWidth, size_t cropHeight, size_t dstWidth, size_t dstHeight, size_t channels,
+            const float* mean, const float* scale, SimdTensorDataType dstType, SimdTensorFormatType dstFormat);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetInputResizer : public Sse41::SynetInputResizer
+        {
+        public:
+            SynetInputResizer(const Base::InputResizerParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetInputResizerInit(SimdPixelFormatType srcFormat, SimdYuvLayoutType yuvLayout, SimdYuvType yuvType,
+            size_t cropX, size_t cropY, size_t cropWidth, size_t cropHeight, size_t dstWidth, size_t dstHeight, size_t channels,
+            const float* mean, const float* scale, SimdTensorDataType dstType, SimdTensorFormatType dstFormat);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        class SynetInputResizer : public Avx2::SynetInputResizer
+        {
+        public:
+            SynetInputResizer(const Base::InputResizerParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetInputResizerInit(SimdPixelFormatType srcFormat, SimdYuvLayoutType yuvLayout, SimdYuvType yuvType,
+            size_t cropX, size_t cropY, size_t cropWidth, size_t cropHeight, size_t dstWidth, size_t dstHeight, size_t channels,
+            const float* mean, const float* scale, SimdTensorDataType dstType, SimdTensorFormatType dstFormat);
+    }
+#endif
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
+#include "Simd/SimdSynetWorkspace.h"
 
 #ifdef _N
 #undef _N
@@ -143,6 +144,7 @@ namespace Simd
     public:
         SynetMergedConvolution32f(const MergConvParam32f& p)
             : _param(p)
+            , _workspace(NULL)
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
             , _perf(NULL)
 #endif
@@ -162,6 +164,16 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        void SetWorkspace(SynetWorkspace * workspace)
+        {
+            _workspace = workspace;
+            if (_workspace)
+            {
+                _workspace->Reserve(ExternalBufferSize());
+                _buffer.Resize(0);
+            }
+        }
+
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         virtual Base::PerformanceMeasurer* Perf(const char* func)
         {
@@ -184,11 +196,14 @@ namespace Simd
     protected:
         MergConvParam32f _param;
         Array32f _buffer;
+        SynetWorkspace* _workspace;
 
         float* Buffer(float* buffer)
         {
             if (buffer)
                 return buffer;
+            else if (_workspace)
+                return _workspace->Get(ExternalBufferSize());
             else
             {
                 _buffer.Resize(ExternalBufferSize());
@@ -224,13 +239,17 @@ namespace Simd
             virtual void ReorderFirstWeight(const float* src, float* dst) const {}
             virtual void ReorderSecondWeight(const float* src, float* dst) const {}
             virtual void ReorderThirdWeight(const float* src, float* dst) const {}
+            virtual void ForwardRows(const float* src, float* buf0, float* buf1, size_t yBeg, size_t yEnd, float* dst) {}
+
+            size_t Threads() const;
 
             ConvolutionPtr _convolution[4];
             size_t _sizeS, _sizeD, _sizeB[2];
             Array32f _rWeight[3], _rBias[3], _rParams[3];
             const float * _weight[3], * _bias[3], * _params[3];
 
-            size_t _miC, _maC, _yStep[2], _bufH[2], _dp[2], _dw[3];
+            size_t _miC, _maC, _yStep[2], _bufH[2], _dp[2], _dw[3], _yStripe, _threads;
+            void* _context;
         };
 
         class SynetMergedConvolution32fCdc : public SynetMergedConvolution32f
@@ -238,8 +257,6 @@ namespace Simd
         public:
             SynetMergedConvolution32fCdc(const MergConvParam32f & p);
 
-            virtual void Forward(const float * src, float * buf, float * dst);
-
             static bool Preferable(const MergConvParam32f& p);
 
         protected:
@@ -247,6 +264,7 @@ namespace Simd
             virtual void ReorderFirstWeight(const float* src, float* dst) const;
             virtual void ReorderSecondWeight(const float* src, float* dst) const;
             virtual void ReorderThirdWeight(const float* src, float* dst) const;
+            virtual void ForwardRows(const float* src, float* buf0, float* buf1, size_t yBeg, size_t yEnd, float* dst);
         };
 
         class SynetMergedConvolution32fCd : public SynetMergedConvolution32f
@@ -254,14 +272,13 @@ namespace Simd
         public:
             SynetMergedConvolution32fCd(const MergConvParam32f& p);
 
-            virtual void Forward(const float* src, float* buf, float* dst);
-
             static bool Preferable(const MergConvParam32f& p);
 
         protected:
             void SetSize(size_t L1, size_t L2, size_t L3, size_t F);
             virtual void ReorderFirstWeight(const float* src, float* dst) const;
             virtual void ReorderSecondWeight(const float* src, float* dst) const;
+            virtual void ForwardRows(const float* src, float* buf0, float* buf1, size_t yBeg, size_t yEnd, float* dst);
         };
 
         class SynetMergedConvolution32fDc : public SynetMergedConvolution32f
@@ -269,14 +286,13 @@ namespace Simd
         public:
             SynetMergedConvolution32fDc(const MergConvParam32f& p);
 
-            virtual void Forward(const float* src, float* buf, float* dst);
-
             static bool Preferable(const MergConvParam32f& p);
 
         protected:
             void SetSize(size_t L1, size_t L2, size_t L3, size_t F);
             virtual void ReorderFirstWeight(const float* src, float* dst) const;
             virtual void ReorderSecondWeight(const float* src, float* dst) const;
+            virtual void ForwardRows(const float* src, float* buf0, float* buf1, size_t yBeg, size_t yEnd, float* dst);
         };
 
         //-----------------------------------------------------------------------------------------
@@ -310,6 +326,9 @@ namespace Simd
                 const uint16_t* weight, const float* bias, const float* params, float* dst, int zero);
 
         protected:
+            virtual void ForwardRows(const float* src, float* buf, size_t yBeg, size_t yEnd, float* dst);
+            size_t Bands() const;
+            size_t Threads() const;
             void SetInputWeight(const float* src, const ConvParam32f& p);
             void SetDepthwiseWeight(const float* src, const ConvParam32f& p);
             void SetOutputWeight(const float* src, const ConvParam32f& p);
@@ -321,7 +340,8 @@ namespace Simd
             InputConvolutionPtr _input;
             DepthwiseConvolutionPtr _depthwise;
             OutputConvolutionPtr _output[2];
-            size_t _sizeS, _sizeD, _sizeB[3];
+            size_t _sizeS, _sizeD, _sizeB[3], _threads;
+            void* _context;
             AlgParam _alg;
             Array16u _weightI, _weightO;
             Array32f _weightD, _bias[3], _params[3];
@@ -332,12 +352,11 @@ namespace Simd
         public:
             SynetMergedConvolution32fBf16Cdc(const MergConvParam32f& p);
 
-            virtual void Forward(const float* src, float* buf, float* dst);
-
             static bool Preferable(const MergConvParam32f& p);
 
         protected:
             void SetSize(size_t F);
+            virtual void ForwardRows(const float* src, float* buf, size_t yBeg, size_t yEnd, float* dst);
         };
 
         class SynetMergedConvolution32fBf16Cd : public SynetMergedConvolution32fBf16
@@ -345,12 +364,11 @@ namespace Simd
         public:
             SynetMergedConvolution32fBf16Cd(const MergConvParam32f& p);
 
-            virtual void Forward(const float* src, float* buf, float* dst);
-
             static bool Preferable(const MergConvParam32f& p);
 
         protected:
             void SetSize(size_t F);
+            virtual void ForwardRows(const float* src, float* buf, size_t yBeg, size_t yEnd, float* dst);
         };
 
         class SynetMergedConvolution32fBf16Dc : public SynetMergedConvolution32fBf16
@@ -358,12 +376,11 @@ namespace Simd
         public:
             SynetMergedConvolution32fBf16Dc(const MergConvParam32f& p);
 
-            virtual void Forward(const float* src, float* buf, float* dst);
-
             static bool Preferable(const MergConvParam32f& p);
 
         protected:
             void SetSize(size_t F);
+            virtual void ForwardRows(const float* src, float* buf, size_t yBeg, size_t yEnd, float* dst);
         };
 
         //-----------------------------------------------------------------------------------------
@@ -190,6 +190,9 @@ namespace Simd
                 const int8_t* weight, const float* norm, const float* bias, const float* params, const float* scale, const float* shift, int32_t* buf, uint8_t* dst, int first);
 
         protected:
+            virtual void ForwardRows(const uint8_t* src, uint8_t* buf, size_t yBeg, size_t yEnd, uint8_t* dst);
+            size_t Bands() const;
+            size_t Threads() const;
             uint8_t* GetBuffer(uint8_t* buffer);
             void Quantize(const float* weight, const float* bias, size_t i, size_t q);
             void ReorderInputWeight(const ConvParam8i& p, Array8i & weight);
@@ -199,7 +202,8 @@ namespace Simd
 
             MergConvParam8i _param;
             bool _s8u, _d8u, _dw0, _1x1;
-            size_t _sizeS, _sizeD, _sizeI[2], _sizeB[5];
+            size_t _sizeS, _sizeD, _sizeI[2], _sizeB[5], _threads;
+            void* _context;
             CvtParam _cvt[3];
             Array8u _buffer;
             Array8i _weight8i[2];
@@ -223,12 +227,11 @@ namespace Simd
         public:
             SynetMergedConvolution8iCdc(const MergConvParam8i& p);
 
-            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
-
             static bool Preferable(const MergConvParam8i& p);
 
         protected:
             void SetSize(size_t F);
+            virtual void ForwardRows(const uint8_t* src, uint8_t* buf, size_t yBeg, size_t yEnd, uint8_t* dst);
         };
 
         class SynetMergedConvolution8iCd : public SynetMergedConvolution8i
@@ -236,12 +239,11 @@ namespace Simd
         public:
             SynetMergedConvolution8iCd(const MergConvParam8i& p);
 
-            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
-
             static bool Preferable(const MergConvParam8i& p);
 
         protected:
             void SetSize(size_t F);
+            virtual void ForwardRows(const uint8_t* src, uint8_t* buf, size_t yBeg, size_t yEnd, uint8_t* dst);
         };
 
         class SynetMergedConvolution8iDc : public SynetMergedConvolution8i
@@ -249,12 +251,11 @@ namespace Simd
         public:
             SynetMergedConvolution8iDc(const MergConvParam8i& p);
 
-            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
-
             static bool Preferable(const MergConvParam8i& p);
 
         protected:
             void SetSize(size_t F);
+            virtual void ForwardRows(const uint8_t* src, uint8_t* buf, size_t yBeg, size_t yEnd, uint8_t* dst);
         };
 
         void* SynetMergedConvolution8iInit(size_t batch, const SimdConvolutionParameters * convs, size_t count, SimdSynetCompatibilityType compatibility);
@@ -92,6 +92,7 @@ namespace Simd
         WarpAffParam _param;
         bool _first;
         size_t _size, _threads;
+        void* _context;
         Array8u _buf;
     };
 
@@ -233,7 +233,9 @@ namespace Test
     TEST_ADD_GROUP_A0(ImageSaveToMemory);
     TEST_ADD_GROUP_A0(Nv12SaveAsJpegToMemory);
     TEST_ADD_GROUP_A0(Yuv420pSaveAsJpegToMemory);
+    TEST_ADD_GROUP_A0(JpegEncoder);
     TEST_ADD_GROUP_AS(ImageLoadFromMemory);
+    TEST_ADD_GROUP_A0(ImageInfoFromMemory);
 
     TEST_ADD_GROUP_A0(MeanFilter3x3);
     TEST_ADD_GROUP_A0(MedianFilterRhomb3x3);
@@ -326,6 +328,8 @@ namespace Test
     TEST_ADD_GROUP_A0(OperationBinary16i);
     TEST_ADD_GROUP_A0(VectorProduct);
 
+    TEST_ADD_GROUP_A0(Parallel);
+
     TEST_ADD_GROUP_A0(ReduceColor2x2);
     TEST_ADD_GROUP_A0(ReduceGray2x2);
     TEST_ADD_GROUP_A0(ReduceGray3x3);
@@ -338,8 +342,14 @@ namespace Test
 
     TEST_ADD_GROUP_AS(ResizeBilinear);
     TEST_ADD_GROUP_A0(Resizer);
+    TEST_ADD_GROUP_A0(ResizerParallel);
+    TEST_ADD_GROUP_A0(ResizerRoi);
+    TEST_ADD_GROUP_A0(ResizerYuv);
+    TEST_ADD_GROUP_A0(ResizerCache);
     TEST_ADD_GROUP_0S(ResizeYuv420p);
 
+    TEST_ADD_GROUP_A0(Runtime);
+
     TEST_ADD_GROUP_A0(SegmentationShrinkRegion);
     TEST_ADD_GROUP_A0(SegmentationFillSingleHoles);
     TEST_ADD_GROUP_A0(SegmentationChangeIndex);
@@ -392,6 +402,7 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetConvert32fTo8u);
     TEST_ADD_GROUP_A0(SynetConvert8uTo32f);
     TEST_ADD_GROUP_A0(SynetSetInput);
+    TEST_ADD_GROUP_A0(SynetInputResizer);
 
     TEST_ADD_GROUP_A0(SynetConvolution8iForward);
 
@@ -611,11 +622,11 @@ namespace Test
 
         Strings include, exclude;
 
-        String text, html;
+        String text, html, internalJson, internalTrace;
 
         size_t testThreads, workThreads, testRepeats, testStatistics;
 
-        bool printAlign, printInternal, checkCpp;
+        bool printAlign, printInternal, printCounters, checkCpp;
 
         Options(int argc, char* argv[])
             : mode(Auto)
@@ -626,6 +637,7 @@ namespace Test
             , testStatistics(0)
             , printAlign(false)
             , printInternal(true)
+            , printCounters(false)
             , checkCpp(false)
         {
             for (int i = 1; i < argc; ++i)
@@ -707,6 +719,18 @@ namespace Test
                 {
                     printInternal = FromString<bool>(arg.substr(4, arg.size() - 4));
                 }
+                else if (arg.find("-ph=") == 0)
+                {
+                    printCounters = FromString<bool>(arg.substr(4, arg.size() - 4));
+                }
+                else if (arg.find("-pj=") == 0)
+                {
+                    internalJson = arg.substr(4, arg.size() - 4);
+                }
+                else if (arg.find("-pt=") == 0)
+                {
+                    internalTrace = arg.substr(4, arg.size() - 4);
+                }
                 else if (arg.find("-wt=") == 0)
                 {
                     workThreads = FromString<size_t>(arg.substr(4, arg.size() - 4));
@@ -810,6 +834,10 @@ namespace Test
             Test::PerformanceMeasurerStorage::s_storage.TextReport(options.text, options.printAlign);
         if (!options.html.empty())
             Test::PerformanceMeasurerStorage::s_storage.HtmlReport(options.html, options.printAlign);
+        if (!options.internalJson.empty())
+            std::ofstream(options.internalJson.c_str()) << SimdPerformanceReport(SimdPerformanceReportJson);
+        if (!options.internalTrace.empty())
+            std::ofstream(options.internalTrace.c_str()) << SimdPerformanceReport(SimdPerformanceReportTrace);
 #endif
 
         if (options.testStatistics)
@@ -872,6 +900,9 @@ namespace Test
         std::cout << "    -r=../..      to set project root directory." << std::endl << std::endl;
         std::cout << "    -pa=1         to print alignment statistics." << std::endl << std::endl;
         std::cout << "    -pi=1         to print internal statistics (Cmake parameter SIMD_PERF must be ON)." << std::endl << std::endl;
+        std::cout << "    -ph=1         to add hardware counters to internal statistics (Linux only, Cmake parameter SIMD_PERF must be ON)." << std::endl << std::endl;
+        std::cout << "    -pj=stat.json a file name with internal statistics in JSON format (Cmake parameter SIMD_PERF must be ON)." << std::endl << std::endl;
+        std::cout << "    -pt=trace.json a file name with internal timeline in Chrome trace format (Cmake parameter SIMD_PERF must be ON)." << std::endl << std::endl;
         std::cout << "    -c=512        a number of channels in test image for performance testing." << std::endl << std::endl;
         std::cout << "    -h=1080       a height of test image for performance testing." << std::endl << std::endl;
         std::cout << "    -w=1920       a width of test image for performance testing." << std::endl << std::endl;
@@ -950,6 +981,8 @@ int main(int argc, char* argv[])
     }
 
     ::SimdSetThreadNumber(options.workThreads);
+    ::SimdPerformanceTrace(options.internalTrace.empty() ? SimdFalse : SimdTrue);
+    ::SimdPerformanceCounters(options.printCounters ? SimdTrue : SimdFalse);
 
     switch (options.mode)
     {
@@ -28,6 +28,7 @@
 #include "Test/TestRandom.h"
 
 #include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageLoadJpeg.h"
 #include "Simd/SimdImageSave.h"
 
 #include "Simd/SimdDrawing.hpp"
@@ -129,7 +130,7 @@ namespace Test
             void Update(View::Format format, SimdImageFileType file, int quality)
             {
                 desc = desc + "[" + ToString(format) + "-" + ToString(file) + 
-                    (file == SimdImageFileJpeg ? String("-") + ToString(quality) : String("")) + "]";
+                    (file == SimdImageFileJpeg || file == SimdImageFilePng ? String("-") + ToString(quality) : String("")) + "]";
             }
 
             void Call(const View& src, SimdImageFileType file, int quality, uint8_t** data, size_t* size) const
@@ -213,8 +214,13 @@ namespace Test
         std::vector<View::Format> formats({ View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32});
         for (int format = 0; format < (int)formats.size(); format++)
         {
-            for (int file = (int)SimdImageFileJpeg; file <= (int)SimdImageFileJpeg; file++)
+            for (int file = (int)SimdImageFilePng; file <= (int)SimdImageFileJpeg; file++)
             {
+                if (file == SimdImageFilePng)
+                {
+                    result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 1, f1, f2);
+                    result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 9, f1, f2);
+                }
                 if (file == SimdImageFileJpeg)
                 {
                     result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 100, f1, f2);
@@ -557,6 +563,176 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncJE
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, SimdPixelFormatType format, int quality, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String desc;
+
+            FuncJE(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format, SimdYuvType yuvType, int quality)
+            {
+                desc = desc + "[" + (yuvType == SimdYuvUnknown ? ToString(format) : String("Nv12")) + "-" + ToString(quality) + "]";
+            }
+
+            size_t Call(void* encoder, const View& src, const View& uv, uint8_t* dst, size_t capacity) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                if (uv.data)
+                    return SimdJpegEncoderRunNv12(encoder, src.data, src.stride, uv.data, uv.stride, dst, capacity);
+                else
+                    return SimdJpegEncoderRun(encoder, src.data, src.stride, dst, capacity);
+            }
+        };
+    }
+
+#define FUNC_JE(func) \
+    FuncJE(func, std::string(#func))
+
+    bool JpegEncoderAutoTest(size_t width, size_t height, View::Format format, SimdYuvType yuvType, int quality, FuncJE f1, FuncJE f2)
+    {
+        bool result = true;
+
+        f1.Update(format, yuvType, quality);
+        f2.Update(format, yuvType, quality);
+
+        View image;
+        if (!GetTestImage(image, width, height, View::Bgra32, f1.desc, f2.desc, SimdImageFileJpeg, quality, NULL, NULL))
+            return false;
+        width = image.width & (yuvType == SimdYuvUnknown ? ~0 : ~1);
+        height = image.height & (yuvType == SimdYuvUnknown ? ~0 : ~1);
+        View bgra = image.Region(0, 0, width, height);
+
+        const size_t frames = 2;
+        View src[frames], uv[frames];
+        for (size_t i = 0; i < frames; ++i)
+        {
+            if (i)
+                Simd::Fill(bgra.Region(width / 4, height / 4, width / 2, height / 2).Ref(), uint8_t(i * 64));
+            if (yuvType == SimdYuvUnknown)
+            {
+                src[i].Recreate(width, height, format);
+                Simd::Convert(bgra, src[i]);
+            }
+            else
+            {
+                View u(width / 2, height / 2, View::Gray8), v(width / 2, height / 2, View::Gray8);
+                src[i].Recreate(width, height, View::Gray8);
+                uv[i].Recreate(width / 2, height / 2, View::Uv16);
+                SimdBgraToYuv420pV2(bgra.data, bgra.stride, bgra.width, bgra.height, src[i].data, src[i].stride, u.data, u.stride, v.data, v.stride, yuvType);
+                Simd::InterleaveUv(u, v, uv[i]);
+            }
+        }
+
+        SimdPixelFormatType pixelFormat = yuvType == SimdYuvUnknown ? (SimdPixelFormatType)format : SimdPixelFormatNone;
+        void* encoder1 = f1.func(width, height, pixelFormat, quality, yuvType);
+        void* encoder2 = f2.func(width, height, pixelFormat, quality, yuvType);
+        if (encoder1 == NULL || encoder2 == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't create JPEG encoder!");
+            return false;
+        }
+
+        size_t capacity = width * height * 4 + 4096;
+        Buffer8u data1(capacity), data2(capacity);
+        for (size_t i = 0; i < frames && result; ++i)
+        {
+            size_t size1 = 0, size2 = 0;
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(size1 = f1.Call(encoder1, src[i], uv[i], data1.data(), capacity));
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(size2 = f2.Call(encoder2, src[i], uv[i], data2.data(), capacity));
+
+            size_t size3 = 0;
+            uint8_t* data3 = NULL;
+            if (yuvType == SimdYuvUnknown)
+                data3 = SimdImageSaveToMemory(src[i].data, src[i].stride, width, height, pixelFormat, SimdImageFileJpeg, quality, &size3);
+            else
+                data3 = SimdNv12SaveAsJpegToMemory(src[i].data, src[i].stride, uv[i].data, uv[i].stride, width, height, yuvType, quality, &size3);
+            result = result && Compare(data2.data(), size2, data3, size3, 0, true, 64);
+            SimdFree(data3);
+
+            if (f2.Call(encoder2, src[i], uv[i], NULL, 0) != size2)
+            {
+                TEST_LOG_SS(Error, "Wrong size of output JPEG for empty output buffer!");
+                result = false;
+            }
+
+            View dst1, dst2;
+            if (dst1.Load(data1.data(), size1, View::Bgra32) && dst2.Load(data2.data(), size2, View::Bgra32))
+            {
+                int differenceMax = GetMaxJpegError(quality);
+                result = result && Compare(dst1, dst2, differenceMax, true, 64, 0, "dst1 & dst2");
+            }
+            else
+            {
+                TEST_LOG_SS(Error, "Can't load images from memory!");
+                result = false;
+            }
+        }
+
+        SimdRelease(encoder1);
+        SimdRelease(encoder2);
+
+        return result;
+    }
+
+    bool JpegEncoderAutoTest(const FuncJE& f1, const FuncJE& f2)
+    {
+        bool result = true;
+
+        View::Format formats[4] = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24 };
+        Ints qualities({ 95, 65 });
+
+        for (size_t q = 0; q < qualities.size() && result; ++q)
+        {
+            for (int format = 0; format < 4; format++)
+            {
+                result = result && JpegEncoderAutoTest(W, H, formats[format], SimdYuvUnknown, qualities[q], f1, f2);
+                result = result && JpegEncoderAutoTest(W + O, H - O, formats[format], SimdYuvUnknown, qualities[q], f1, f2);
+            }
+            result = result && JpegEncoderAutoTest(W, H, View::Gray8, SimdYuvTrect871, qualities[q], f1, f2);
+            result = result && JpegEncoderAutoTest(W + E, H - E, View::Gray8, SimdYuvTrect871, qualities[q], f1, f2);
+        }
+
+        return result;
+    }
+
+    bool JpegEncoderAutoTest()
+    {
+        bool result = true;
+
+        result = result && JpegEncoderAutoTest(FUNC_JE(Simd::Base::JpegEncoderInit), FUNC_JE(SimdJpegEncoderInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && JpegEncoderAutoTest(FUNC_JE(Simd::Sse41::JpegEncoderInit), FUNC_JE(SimdJpegEncoderInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && JpegEncoderAutoTest(FUNC_JE(Simd::Avx2::JpegEncoderInit), FUNC_JE(SimdJpegEncoderInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && JpegEncoderAutoTest(FUNC_JE(Simd::Avx512bw::JpegEncoderInit), FUNC_JE(SimdJpegEncoderInit));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && JpegEncoderAutoTest(FUNC_JE(Simd::Neon::JpegEncoderInit), FUNC_JE(SimdJpegEncoderInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     namespace
     {
         struct FuncLM
@@ -586,12 +762,357 @@ namespace Test
 #define FUNC_LM(func) \
     FuncLM(func, std::string(#func))
 
+    namespace
+    {
+        struct FuncLS
+        {
+            typedef Simd::CreateImageLoaderPtr FuncPtr;
+
+            FuncPtr func;
+            String desc;
+
+            FuncLS(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format, size_t scale)
+            {
+                desc = desc + "[" + ToString(format) + "-1/" + ToString(scale) + "]";
+            }
+
+            void Call(const uint8_t* data, size_t size, size_t scale, View::Format format, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ((View::Format&)dst.format) = format;
+                if (func)
+                    *(uint8_t**)&dst.data = Simd::ImageLoadFromMemory(func, Simd::ImageLoaderParam(data, size, (SimdPixelFormatType)format, scale),
+                        (size_t*)&dst.stride, (size_t*)&dst.width, (size_t*)&dst.height, (SimdPixelFormatType*)&dst.format);
+                else
+                    *(uint8_t**)&dst.data = SimdImageLoadFromMemoryScaled(data, size, scale, 
+                        (size_t*)&dst.stride, (size_t*)&dst.width, (size_t*)&dst.height, (SimdPixelFormatType*)&dst.format);
+            }
+        };
+    }
+
+#define FUNC_LS(func) \
+    FuncLS(func, std::string(#func))
+
+    bool ImageLoadFromMemoryScaledAutoTest(size_t width, size_t height, View::Format format, size_t scale, FuncLS f1, FuncLS f2)
+    {
+        bool result = true;
+
+        f1.Update(format, scale);
+        f2.Update(format, scale);
+
+        View src;
+        size_t size = 0;
+        uint8_t* data = NULL;
+        if (!GetTestImage(src, width, height, format, f1.desc, f2.desc, SimdImageFileJpeg, 95, &data, &size))
+            return false;
+
+        View dst1, dst2;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(if (dst1.data) Simd::Free(dst1.data); f1.Call(data, size, scale, format, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(if (dst2.data) SimdFree(dst2.data); f2.Call(data, size, scale, format, dst2));
+
+        size_t dstW = (src.width + scale - 1) / scale, dstH = (src.height + scale - 1) / scale;
+        if (dst1.data == NULL || dst2.data == NULL || dst1.width != dstW || dst1.height != dstH || dst2.width != dstW || dst2.height != dstH)
+        {
+            TEST_LOG_SS(Error, "Wrong size of scaled image: " << dst1.width << "x" << dst1.height << " and " 
+                << dst2.width << "x" << dst2.height << " instead of " << dstW << "x" << dstH << " !");
+            result = false;
+        }
+        else
+            result = result && Compare(dst1, dst2, GetMaxJpegError(95), true, 64, 0, "dst1 & dst2");
+
+        if (dst1.data)
+            Simd::Free(dst1.data);
+        if (dst2.data)
+            SimdFree(dst2.data);
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool ImageLoadFromMemoryScaledAutoTest(const FuncLS& f1, const FuncLS& f2)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Rgba32 };
+        for (size_t format = 0; format < formats.size(); format++)
+        {
+            for (size_t scale = 2; scale <= 8; scale *= 2)
+            {
+                result = result && ImageLoadFromMemoryScaledAutoTest(W, H, formats[format], scale, f1, f2);
+                result = result && ImageLoadFromMemoryScaledAutoTest(W + O, H - O, formats[format], scale, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool ImageLoadFromMemoryScaledAutoTest()
+    {
+        bool result = true;
+
+        result = result && ImageLoadFromMemoryScaledAutoTest(FUNC_LS(Simd::Base::CreateImageLoader), FuncLS(NULL, "SimdImageLoadFromMemoryScaled"));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && ImageLoadFromMemoryScaledAutoTest(FUNC_LS(Simd::Sse41::CreateImageLoader), FuncLS(NULL, "SimdImageLoadFromMemoryScaled"));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncLY
+        {
+            typedef uint8_t* (*FuncPtr)(const uint8_t* data, size_t size, SimdYuvLayoutType layout, uint8_t* planes[3], size_t strides[3], size_t* width, size_t* height);
+
+            FuncPtr func;
+            String desc;
+
+            FuncLY(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(SimdYuvLayoutType layout)
+            {
+                desc = desc + "[" + (layout == SimdYuvLayoutGray8 ? "Gray8" : layout == SimdYuvLayoutNv12 ? "Nv12" : "Yuv420p") + "]";
+            }
+
+            uint8_t* Call(const uint8_t* data, size_t size, SimdYuvLayoutType layout, View planes[3]) const
+            {
+                uint8_t* ptrs[3] = { NULL, NULL, NULL };
+                size_t strides[3] = { 0, 0, 0 }, width = 0, height = 0;
+                uint8_t* buffer = NULL;
+                {
+                    TEST_PERFORMANCE_TEST(desc);
+                    buffer = func(data, size, layout, ptrs, strides, &width, &height);
+                }
+                if (buffer)
+                {
+                    planes[0] = View(width, height, strides[0], View::Gray8, ptrs[0]);
+                    if (layout == SimdYuvLayoutNv12)
+                        planes[1] = View((width + 1) / 2, (height + 1) / 2, strides[1], View::Uv16, ptrs[1]);
+                    if (layout == SimdYuvLayoutYuv420p)
+                    {
+                        planes[1] = View((width + 1) / 2, (height + 1) / 2, strides[1], View::Gray8, ptrs[1]);
+                        planes[2] = View((width + 1) / 2, (height + 1) / 2, strides[2], View::Gray8, ptrs[2]);
+                    }
+                }
+                return buffer;
+            }
+        };
+    }
+
+#define FUNC_LY(func) \
+    FuncLY(func, std::string(#func))
+
+    bool ImageLoadYuvFromMemoryAutoTest(size_t width, size_t height, SimdYuvLayoutType layout, FuncLY f1, FuncLY f2)
+    {
+        bool result = true;
+
+        assert(width % 2 == 0 && height % 2 == 0);
+
+        f1.Update(layout);
+        f2.Update(layout);
+
+        const int quality = 100;
+        View bgra;
+        if (!GetTestImage(bgra, width, height, View::Bgra32, f1.desc, f2.desc, SimdImageFileJpeg, quality, NULL, NULL))
+            return false;
+
+        View y(width, height, View::Gray8), u(width / 2, height / 2, View::Gray8), v(width / 2, height / 2, View::Gray8), uv(width / 2, height / 2, View::Uv16);
+        SimdBgraToYuv420pV2(bgra.data, bgra.stride, bgra.width, bgra.height, y.data, y.stride, u.data, u.stride, v.data, v.stride, SimdYuvTrect871);
+        SimdInterleaveUv(u.data, u.stride, v.data, v.stride, u.width, u.height, uv.data, uv.stride);
+
+        size_t size = 0;
+        uint8_t* data = SimdYuv420pSaveAsJpegToMemory(y.data, y.stride, u.data, u.stride, v.data, v.stride, width, height, SimdYuvTrect871, quality, &size);
+
+        View dst1[3], dst2[3];
+        uint8_t* buf1 = NULL, * buf2 = NULL;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(if (buf1) Simd::Free(buf1); buf1 = f1.Call(data, size, layout, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(if (buf2) SimdFree(buf2); buf2 = f2.Call(data, size, layout, dst2));
+
+        if (buf1 == NULL || buf2 == NULL || dst1[0].width != width || dst1[0].height != height || dst2[0].width != width || dst2[0].height != height)
+        {
+            TEST_LOG_SS(Error, "Can't load YUV planes from JPEG image!");
+            result = false;
+        }
+        else
+        {
+            int differenceMax = GetMaxJpegError(quality);
+            result = result && Compare(dst1[0], y, differenceMax, true, 64, 0, "y1 & y");
+            result = result && Compare(dst1[0], dst2[0], differenceMax, true, 64, 0, "y1 & y2");
+            if (layout == SimdYuvLayoutNv12)
+            {
+                result = result && Compare(dst1[1], uv, differenceMax, true, 64, 0, "uv1 & uv");
+                result = result && Compare(dst1[1], dst2[1], differenceMax, true, 64, 0, "uv1 & uv2");
+            }
+            if (layout == SimdYuvLayoutYuv420p)
+            {
+                result = result && Compare(dst1[1], u, differenceMax, true, 64, 0, "u1 & u");
+                result = result && Compare(dst1[2], v, differenceMax, true, 64, 0, "v1 & v");
+                result = result && Compare(dst1[1], dst2[1], differenceMax, true, 64, 0, "u1 & u2");
+                result = result && Compare(dst1[2], dst2[2], differenceMax, true, 64, 0, "v1 & v2");
+            }
+        }
+
+        if (buf1)
+            Simd::Free(buf1);
+        if (buf2)
+            SimdFree(buf2);
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool ImageLoadYuvFromMemoryAutoTest(const FuncLY& f1, const FuncLY& f2)
+    {
+        bool result = true;
+
+        std::vector<SimdYuvLayoutType> layouts = { SimdYuvLayoutGray8, SimdYuvLayoutNv12, SimdYuvLayoutYuv420p };
+        for (size_t layout = 0; layout < layouts.size(); layout++)
+        {
+            result = result && ImageLoadYuvFromMemoryAutoTest(W, H, layouts[layout], f1, f2);
+            result = result && ImageLoadYuvFromMemoryAutoTest(W + E, H - E, layouts[layout], f1, f2);
+        }
+
+        return result;
+    }
+
+    bool ImageLoadYuvFromMemoryAutoTest()
+    {
+        bool result = true;
+
+        result = result && ImageLoadYuvFromMemoryAutoTest(FUNC_LY(Simd::Base::JpegLoadYuvFromMemory), FUNC_LY(SimdImageLoadYuvFromMemory));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && ImageLoadYuvFromMemoryAutoTest(FUNC_LY(Simd::Sse41::JpegLoadYuvFromMemory), FUNC_LY(SimdImageLoadYuvFromMemory));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncLR
+        {
+            typedef bool (*FuncPtr)(const uint8_t* data, size_t size, size_t left, size_t top, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t stride);
+
+            FuncPtr func;
+            String desc;
+
+            FuncLR(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format)
+            {
+                desc = desc + "[" + ToString(format) + "]";
+            }
+
+            bool Call(const uint8_t* data, size_t size, const Rect& roi, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                return func(data, size, roi.left, roi.top, roi.Width(), roi.Height(), (SimdPixelFormatType)dst.format, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_LR(func) \
+    FuncLR(func, std::string(#func))
+
+    static bool SimdImageLoadRoiFromMemoryWrapper(const uint8_t* data, size_t size, size_t left, size_t top, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t stride)
+    {
+        return SimdImageLoadRoiFromMemory(data, size, left, top, width, height, format, dst, stride) == SimdTrue;
+    }
+
+    bool ImageLoadRoiFromMemoryAutoTest(size_t width, size_t height, View::Format format, FuncLR f1, FuncLR f2)
+    {
+        bool result = true;
+
+        f1.Update(format);
+        f2.Update(format);
+
+        const int quality = 95;
+        View src;
+        size_t size = 0;
+        uint8_t* data = NULL;
+        if (!GetTestImage(src, width, height, format, f1.desc, f2.desc, SimdImageFileJpeg, quality, &data, &size))
+            return false;
+
+        View full;
+        if (!full.Load(data, size, format))
+        {
+            TEST_LOG_SS(Error, "Can't load image from memory!");
+            SimdFree(data);
+            return false;
+        }
+
+        Rect roi(width / 3, height / 4, width / 3 + width / 2, height / 4 + height / 3);
+        View dst1(roi.Size(), format), dst2(roi.Size(), format);
+
+        bool ok1 = false, ok2 = false;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(ok1 = f1.Call(data, size, roi, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(ok2 = f2.Call(data, size, roi, dst2));
+
+        if (!ok1 || !ok2)
+        {
+            TEST_LOG_SS(Error, "Can't load region of interest of image from memory!");
+            result = false;
+        }
+        else
+        {
+            int differenceMax = GetMaxJpegError(quality);
+            result = result && Compare(dst1, full.Region(roi), differenceMax, true, 64, 0, "dst1 & full");
+            result = result && Compare(dst1, dst2, differenceMax, true, 64, 0, "dst1 & dst2");
+        }
+
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool ImageLoadRoiFromMemoryAutoTest(const FuncLR& f1, const FuncLR& f2)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Rgba32 };
+        for (size_t format = 0; format < formats.size(); format++)
+        {
+            result = result && ImageLoadRoiFromMemoryAutoTest(W, H, formats[format], f1, f2);
+            result = result && ImageLoadRoiFromMemoryAutoTest(W + O, H - O, formats[format], f1, f2);
+        }
+
+        return result;
+    }
+
+    bool ImageLoadRoiFromMemoryAutoTest()
+    {
+        bool result = true;
+
+        result = result && ImageLoadRoiFromMemoryAutoTest(FUNC_LR(Simd::Base::JpegLoadRoiFromMemory), FUNC_LR(SimdImageLoadRoiFromMemoryWrapper));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && ImageLoadRoiFromMemoryAutoTest(FUNC_LR(Simd::Sse41::JpegLoadRoiFromMemory), FUNC_LR(SimdImageLoadRoiFromMemoryWrapper));
+#endif 
+
+        return result;
+    }
+
     bool SaveLoadCompatible(View::Format format, SimdImageFileType file, int quality)
     {
         if (file == SimdImageFilePgmTxt || file == SimdImageFilePgmBin)
             return format == View::Gray8;
         if (file == SimdImageFilePpmTxt || file == SimdImageFilePpmBin)
             return format != View::Bgra32 && format != View::Rgba32;
+        if (file == SimdImageFilePng)
+            return true;
         return false;
     }
 
@@ -665,7 +1186,7 @@ namespace Test
         std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
         for (size_t format = 0; format < formats.size(); format++)
         {
-            for (int file = (int)SimdImageFileJpeg; file <= (int)SimdImageFileJpeg; file++)
+            for (int file = (int)SimdImageFilePng; file <= (int)SimdImageFileJpeg; file++)
             {
                 if (file == SimdImageFileJpeg)
                 {
@@ -680,6 +1201,135 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncLB
+        {
+            typedef Simd::CreateImageLoaderPtr FuncPtr;
+
+            FuncPtr func;
+            String desc;
+
+            FuncLB(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format, SimdImageFileType file)
+            {
+                desc = desc + "[" + ToString(format) + "-" + ToString(file) + "]";
+            }
+
+            bool Call(const uint8_t* data, size_t size, View::Format format, View& dst, size_t dstSize, size_t* width, size_t* height) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                SimdPixelFormatType dstFormat = (SimdPixelFormatType)format;
+                if (func)
+                    return Simd::ImageLoadFromMemory(func, Simd::ImageLoaderParam(data, size, dstFormat), dst.data, dst.stride, dstSize, width, height, &dstFormat);
+                else
+                    return SimdImageLoadFromMemoryToBuffer(data, size, dst.data, dst.stride, dstSize, width, height, &dstFormat) == SimdTrue;
+            }
+        };
+    }
+
+#define FUNC_LB(func) \
+    FuncLB(func, std::string(#func))
+
+    bool ImageLoadToBufferAutoTest(size_t width, size_t height, View::Format format, SimdImageFileType file, FuncLB f1, FuncLB f2)
+    {
+        bool result = true;
+
+        f1.Update(format, file);
+        f2.Update(format, file);
+
+        View src;
+        size_t size = 0;
+        uint8_t* data = NULL;
+        if (!GetTestImage(src, width, height, format, f1.desc, f2.desc, file, 95, &data, &size))
+            return false;
+
+        size_t rowSize = src.width * src.PixelSize(), stride = rowSize + 3, dstSize = (src.height - 1) * stride + rowSize;
+        View dst1(src.width, src.height, stride, format, NULL), dst2(src.width, src.height, stride, format, NULL);
+        Simd::Fill(dst1, 0x55);
+        Simd::Fill(dst2, 0x55);
+
+        size_t w1 = 0, h1 = 0, w2 = 0, h2 = 0;
+        bool ok1 = false, ok2 = false;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(ok1 = f1.Call(data, size, format, dst1, dstSize, &w1, &h1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(ok2 = f2.Call(data, size, format, dst2, dstSize, &w2, &h2));
+
+        if (!ok1 || !ok2 || w1 != src.width || h1 != src.height || w2 != src.width || h2 != src.height)
+        {
+            TEST_LOG_SS(Error, "Can't load image to buffer: " << ok1 << " " << w1 << "x" << h1 << " and " << ok2 << " " << w2 << "x" << h2 << " !");
+            result = false;
+        }
+        else
+        {
+            int differenceMax = file == SimdImageFileJpeg ? GetMaxJpegError(95) : 0;
+            result = result && Compare(dst1, dst2, differenceMax, true, 64, 0, "dst1 & dst2");
+            if (SaveLoadCompatible(format, file, 95))
+                result = result && Compare(dst1, src, 0, true, 64, 0, "dst1 & src");
+        }
+
+        if (result)
+        {
+            View control(src.width, src.height, stride, format, NULL);
+            Simd::Copy(dst1, control);
+            w1 = 0, h1 = 0;
+            if (f1.Call(data, size, format, dst1, dstSize - 1, &w1, &h1) || w1 != src.width || h1 != src.height)
+            {
+                TEST_LOG_SS(Error, "Loading to too small buffer must fail and return image size!");
+                result = false;
+            }
+            View narrow(src.width, src.height, rowSize - 1, format, dst1.data);
+            if (f1.Call(data, size, format, narrow, dstSize, &w1, &h1))
+            {
+                TEST_LOG_SS(Error, "Loading to buffer with too small stride must fail!");
+                result = false;
+            }
+            result = result && Compare(dst1, control, 0, true, 64, 0, "dst1 & control");
+        }
+
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool ImageLoadToBufferAutoTest(const FuncLB& f1, const FuncLB& f2)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Rgba32 };
+        for (size_t format = 0; format < formats.size(); format++)
+        {
+            for (int file = (int)SimdImageFilePpmBin; file <= (int)SimdImageFileJpeg; file++)
+            {
+                result = result && ImageLoadToBufferAutoTest(W, H, formats[format], (SimdImageFileType)file, f1, f2);
+                result = result && ImageLoadToBufferAutoTest(W + O, H - O, formats[format], (SimdImageFileType)file, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool ImageLoadToBufferAutoTest()
+    {
+        bool result = true;
+
+        result = result && ImageLoadToBufferAutoTest(FUNC_LB(Simd::Base::CreateImageLoader), FuncLB(NULL, "SimdImageLoadFromMemoryToBuffer"));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && ImageLoadToBufferAutoTest(FUNC_LB(Simd::Sse41::CreateImageLoader), FuncLB(NULL, "SimdImageLoadFromMemoryToBuffer"));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && ImageLoadToBufferAutoTest(FUNC_LB(Simd::Avx2::CreateImageLoader), FuncLB(NULL, "SimdImageLoadFromMemoryToBuffer"));
+#endif 
+
+        return result;
+    }
+
     bool ImageLoadFromMemoryAutoTest()
     {
         bool result = true;
@@ -706,6 +1356,14 @@ namespace Test
             result = result && ImageLoadFromMemoryAutoTest(FUNC_LM(Simd::Neon::ImageLoadFromMemory), FUNC_LM(SimdImageLoadFromMemory));
 #endif 
 
+        result = result && ImageLoadFromMemoryScaledAutoTest();
+
+        result = result && ImageLoadToBufferAutoTest();
+
+        result = result && ImageLoadYuvFromMemoryAutoTest();
+
+        result = result && ImageLoadRoiFromMemoryAutoTest();
+
         return result;
     }
 
@@ -887,4 +1545,68 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------
+
+    bool ImageInfoFromMemoryAutoTest(size_t width, size_t height, View::Format format, SimdImageFileType file)
+    {
+        bool result = true;
+
+        String desc = String("ImageInfoFromMemory[") + ToString(format) + "-" + (file == SimdImageFileJpeg ? "Jpeg" : "Png") + "]";
+        TEST_LOG_SS(Info, "Test " << desc << " " << width << "x" << height << ".");
+
+        View src(width, height, format);
+        FillRandom(src);
+        size_t size = 0;
+        uint8_t* data = SimdImageSaveToMemory(src.data, src.stride, src.width, src.height, (SimdPixelFormatType)src.format, file, 95, &size);
+        if (data == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't save image to memory!");
+            return false;
+        }
+
+        size_t channels = file == SimdImageFileJpeg ? 3 : (format == View::Gray8 ? 1 : (format == View::Bgra32 ? 4 : 3));
+        SimdImageInfo info;
+        {
+            TEST_PERFORMANCE_TEST(desc);
+            result = SimdImageInfoFromMemory(data, size, &info) == SimdTrue;
+        }
+        if (!result)
+        {
+            TEST_LOG_SS(Error, "Can't get image info from memory!");
+        }
+        else if (info.file != file || info.width != width || info.height != height || info.channels != channels || info.depth != 8 || info.orientation != 1)
+        {
+            TEST_LOG_SS(Error, "Wrong image info: file " << info.file << ", size " << info.width << "x" << info.height 
+                << ", channels " << info.channels << ", depth " << info.depth << ", orientation " << info.orientation << " !");
+            result = false;
+        }
+        else if (SimdImageInfoFromMemory(data, 16, &info) == SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Image info is read from truncated header!");
+            result = false;
+        }
+
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool ImageInfoFromMemoryAutoTest()
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32 };
+        std::vector<SimdImageFileType> files = { SimdImageFilePng, SimdImageFileJpeg };
+        for (size_t format = 0; format < formats.size(); format++)
+        {
+            for (size_t file = 0; file < files.size(); file++)
+            {
+                result = result && ImageInfoFromMemoryAutoTest(W, H, formats[format], files[file]);
+                result = result && ImageInfoFromMemoryAutoTest(W + O, H - O, formats[format], files[file]);
+            }
+        }
+
+        return result;
+    }
 }
@@ -0,0 +1,289 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+#include "Test/TestLog.h"
+
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <future>
+#include <atomic>
+
+namespace Test
+{
+    namespace
+    {
+        template<class Function> void ParallelAsync(size_t begin, size_t end, const Function& function, size_t threadNumber, size_t blockAlign = 1)
+        {
+            threadNumber = std::min<size_t>(threadNumber, std::thread::hardware_concurrency());
+            if (threadNumber <= 1 || size_t(blockAlign * 1.5) >= (end - begin))
+                function(0, begin, end);
+            else
+            {
+                std::vector<std::future<void>> futures;
+                size_t blockSize = (end - begin + threadNumber - 1) / threadNumber;
+                blockSize = (blockSize + blockAlign - 1) / blockAlign * blockAlign;
+                size_t blockBegin = begin;
+                size_t blockEnd = blockBegin + blockSize;
+                for (size_t thread = 0; thread < threadNumber && blockBegin < end; ++thread)
+                {
+                    futures.push_back(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function] { function(thread, blockBegin, blockEnd); }));
+                    blockBegin += blockSize;
+                    blockEnd = std::min(blockBegin + blockSize, end);
+                }
+                for (size_t i = 0; i < futures.size(); ++i)
+                    futures[i].wait();
+            }
+        }
+
+        struct Checker
+        {
+            std::vector<std::atomic<int>> visits, busy;
+            std::atomic<int> errors;
+
+            Checker(size_t size, size_t threads)
+                : visits(size)
+                , busy(threads)
+            {
+                for (size_t i = 0; i < size; ++i)
+                    visits[i] = 0;
+                for (size_t i = 0; i < threads; ++i)
+                    busy[i] = 0;
+                errors = 0;
+            }
+
+            void operator()(size_t thread, size_t begin, size_t end)
+            {
+                if (thread >= busy.size() || busy[thread].fetch_add(1) != 0)
+                    errors++;
+                for (size_t i = begin; i < end; ++i)
+                    visits[i]++;
+                if (thread < busy.size())
+                    busy[thread]--;
+            }
+
+            bool Check(const String & description) const
+            {
+                if (errors)
+                {
+                    TEST_LOG_SS(Error, description << " : thread index is out of range or is used concurrently!");
+                    return false;
+                }
+                for (size_t i = 0; i < visits.size(); ++i)
+                {
+                    if (visits[i] != 1)
+                    {
+                        TEST_LOG_SS(Error, description << " : element " << i << " is processed " << int(visits[i]) << " times!");
+                        return false;
+                    }
+                }
+                return true;
+            }
+        };
+    }
+
+    bool ParallelAutoTest(size_t size, size_t threads, size_t align, size_t granularity)
+    {
+        std::stringstream ss;
+        ss << "Simd::Parallel [" << size << ", " << threads << ", " << align << ", " << granularity << "]";
+        TEST_LOG_SS(Info, "Test " << ss.str() << ".");
+
+        Checker checker(size, threads);
+        Simd::Parallel(0, size, [&](size_t thread, size_t begin, size_t end) { checker(thread, begin, end); }, threads, align, granularity);
+        return checker.Check(ss.str());
+    }
+
+    bool ParallelNestedAutoTest(size_t size, size_t threads)
+    {
+        TEST_LOG_SS(Info, "Test nested Simd::Parallel [" << size << ", " << threads << "].");
+
+        std::vector<Checker*> checkers(size);
+        for (size_t i = 0; i < size; ++i)
+            checkers[i] = new Checker(size, threads);
+        Simd::Parallel(0, size, [&](size_t, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+                Simd::Parallel(0, size, [&](size_t thread, size_t b, size_t e) { (*checkers[i])(thread, b, e); }, threads, 1, 4);
+        }, threads);
+        bool result = true;
+        for (size_t i = 0; i < size; ++i)
+        {
+            result = result && checkers[i]->Check("nested Simd::Parallel");
+            delete checkers[i];
+        }
+        return result;
+    }
+
+    bool ParallelOverheadAutoTest(size_t size, size_t threads)
+    {
+        TEST_LOG_SS(Info, "Test per-call overhead of Simd::Parallel and std::async for size = " << size << " and threads = " << threads << ".");
+
+        std::vector<float> data(size, 1.0f);
+        auto function = [&](size_t thread, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+                data[i] = data[i] * 0.5f + 0.5f;
+        };
+
+        const size_t count = 1000;
+        double async = GetTime();
+        for (size_t i = 0; i < count; ++i)
+        {
+            TEST_PERFORMANCE_TEST("ParallelAsync");
+            ParallelAsync(0, size, function, threads);
+        }
+        async = (GetTime() - async) / count;
+
+        double pool = GetTime();
+        for (size_t i = 0; i < count; ++i)
+        {
+            TEST_PERFORMANCE_TEST("Simd::Parallel");
+            Simd::Parallel(0, size, function, threads);
+        }
+        pool = (GetTime() - pool) / count;
+
+        TEST_LOG_SS(Info, "Average time per call: std::async " << ToString(async * 1000000.0, 1, false) << " us, Simd::Parallel " << ToString(pool * 1000000.0, 1, false) << " us.");
+
+        return true;
+    }
+
+    bool ThreadContextAutoTest(size_t threads)
+    {
+        TEST_LOG_SS(Info, "Test thread context with " << threads << " threads.");
+
+        bool result = true;
+        size_t global = SimdGetThreadNumber();
+        size_t expected = std::max<size_t>(std::min<size_t>(threads, std::thread::hardware_concurrency()), 1);
+
+        View src(W * 4, H * 4, View::Bgr24), dst1(W, H, View::Bgr24), dst2(W, H, View::Bgr24);
+        FillRandom(src);
+
+        void * resizer1 = SimdResizerInit(src.width, src.height, dst1.width, dst1.height, 3, SimdResizeChannelByte, SimdResizeMethodBilinear);
+        SimdResizerRun(resizer1, src.data, src.stride, dst1.data, dst1.stride);
+
+        void * context = SimdThreadContextCreate(threads, 0);
+        void * previous = SimdThreadContextBind(context);
+        if (previous != NULL)
+        {
+            TEST_LOG_SS(Error, "There is unexpected thread context bound to the calling thread!");
+            result = false;
+        }
+        if (SimdGetThreadNumber() != expected)
+        {
+            TEST_LOG_SS(Error, "Thread number of bound context is " << SimdGetThreadNumber() << " instead of " << expected << "!");
+            result = false;
+        }
+        void * resizer2 = SimdResizerInit(src.width, src.height, dst2.width, dst2.height, 3, SimdResizeChannelByte, SimdResizeMethodBilinear);
+        SimdResizerRun(resizer2, src.data, src.stride, dst2.data, dst2.stride);
+        SimdThreadContextBind(previous);
+        if (SimdGetThreadNumber() != global)
+        {
+            TEST_LOG_SS(Error, "Thread number is not restored after unbinding of thread context!");
+            result = false;
+        }
+        SimdRelease(context);
+        SimdRelease(resizer1);
+        SimdRelease(resizer2);
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool ThreadContextOtherThreadAutoTest(size_t threads)
+    {
+        TEST_LOG_SS(Info, "Test objects created with thread context of " << threads << " threads and run from other thread.");
+
+        bool result = true;
+        size_t expected = std::max<size_t>(std::min<size_t>(threads, std::thread::hardware_concurrency()), 1);
+
+        View src(W * 4, H * 4, View::Bgr24), dst1(W, H, View::Bgr24), dst2(W, H, View::Bgr24);
+        FillRandom(src);
+
+        void * context = SimdThreadContextCreate(threads, 0);
+        void * previous = SimdThreadContextBind(context);
+        void * resizer = SimdResizerInit(src.width, src.height, dst1.width, dst1.height, 3, SimdResizeChannelByte, SimdResizeMethodBilinear);
+        SimdThreadContextBind(previous);
+        SimdResizerRun(resizer, src.data, src.stride, dst1.data, dst1.stride);
+
+        std::atomic<int> unbound(0), foreign(0);
+        std::thread thread([&]
+        {
+            size_t global = SimdGetThreadNumber();
+            SimdResizerRun(resizer, src.data, src.stride, dst2.data, dst2.stride);
+            if (SimdGetThreadNumber() != global || SimdThreadContextBind(NULL) != NULL)
+                unbound++;
+            Simd::Base::ThreadContextScope scope(context);
+            Simd::Parallel(0, W * H, [&](size_t, size_t, size_t)
+            {
+                if (SimdGetThreadNumber() != expected)
+                    foreign++;
+            }, expected, 1, 4);
+        });
+        thread.join();
+        if (unbound)
+        {
+            TEST_LOG_SS(Error, "Object run leaves its thread context bound to the calling thread!");
+            result = false;
+        }
+        if (foreign)
+        {
+            TEST_LOG_SS(Error, "Thread context scope runs " << int(foreign) << " blocks outside of its thread context!");
+            result = false;
+        }
+
+        SimdRelease(resizer);
+        SimdRelease(context);
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool ParallelAutoTest()
+    {
+        bool result = true;
+
+        size_t threads = std::max<size_t>(std::thread::hardware_concurrency(), 2);
+
+        result = result && ParallelAutoTest(1, threads, 1, 1);
+        result = result && ParallelAutoTest(W * H, threads, 1, 1);
+        result = result && ParallelAutoTest(W * H + O, threads, 16, 1);
+        result = result && ParallelAutoTest(W * H - O, threads, 1, 8);
+        result = result && ParallelAutoTest(H, threads, 3, 4);
+        result = result && ParallelAutoTest(threads - 1, threads, 1, 1);
+
+        result = result && ParallelNestedAutoTest(64, threads);
+
+        result = result && ThreadContextAutoTest(threads);
+        result = result && ThreadContextOtherThreadAutoTest(threads);
+
+        result = result && ParallelOverheadAutoTest(W * 8, threads);
+
+        return result;
+    }
+}
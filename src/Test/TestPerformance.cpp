@@ -425,7 +425,7 @@ namespace Test
         for (size_t i = 0; i < enable.Size(); ++i)
             if (enable[i])
                 size++;
-        TablePtr table(new Table(size*(align ? 4 : 3) - 3, 1 + functions.size()));
+        TablePtr table(new Table(size > 1 ? size*(align ? 4 : 3) - 3 : 1 + size*(align ? 2 : 1), 1 + functions.size()));
         AddHeader(*table, names, enable, align);
         size_t row = 0;
         table->SetRowProp(row, true, true);
@@ -0,0 +1,350 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestLog.h"
+
+#include "Simd/SimdPerformance.h"
+
+#include <thread>
+#include <set>
+
+namespace Test
+{
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+    namespace
+    {
+        struct Json
+        {
+            enum Type { Null, Bool, Number, Str, Array, Object } type;
+            double number;
+            String str;
+            std::vector<Json> array;
+            std::map<String, Json> object;
+
+            Json() : type(Null), number(0) {}
+
+            bool Has(const String & key, Type t) const
+            {
+                std::map<String, Json>::const_iterator it = object.find(key);
+                return type == Object && it != object.end() && it->second.type == t;
+            }
+
+            const Json & operator[](const String & key) const
+            {
+                return object.find(key)->second;
+            }
+        };
+
+        class JsonParser
+        {
+            const char * _p;
+
+            void Skip()
+            {
+                while (*_p == ' ' || *_p == '\t' || *_p == '\n' || *_p == '\r')
+                    _p++;
+            }
+
+            bool Match(const char * word)
+            {
+                size_t size = strlen(word);
+                if (strncmp(_p, word, size))
+                    return false;
+                _p += size;
+                return true;
+            }
+
+            bool ParseString(String & str)
+            {
+                if (*_p++ != '"')
+                    return false;
+                while (*_p != '"')
+                {
+                    if (*_p == 0 || (unsigned char)*_p < 0x20)
+                        return false;
+                    if (*_p == '\\')
+                    {
+                        _p++;
+                        if (*_p == 'u')
+                        {
+                            for (int i = 1; i <= 4; ++i)
+                                if (!isxdigit((unsigned char)_p[i]))
+                                    return false;
+                            str.push_back((char)strtol(String(_p + 1, 4).c_str(), NULL, 16));
+                            _p += 5;
+                            continue;
+                        }
+                        if (strchr("\"\\/bfnrt", *_p) == NULL || *_p == 0)
+                            return false;
+                    }
+                    str.push_back(*_p++);
+                }
+                _p++;
+                return true;
+            }
+
+            bool ParseValue(Json & value)
+            {
+                Skip();
+                if (*_p == '{')
+                {
+                    value.type = Json::Object;
+                    _p++, Skip();
+                    if (*_p == '}')
+                        return _p++, true;
+                    for (;;)
+                    {
+                        String key;
+                        Skip();
+                        if (!ParseString(key) || value.object.count(key))
+                            return false;
+                        Skip();
+                        if (*_p++ != ':' || !ParseValue(value.object[key]))
+                            return false;
+                        Skip();
+                        if (*_p == '}')
+                            return _p++, true;
+                        if (*_p++ != ',')
+                            return false;
+                    }
+                }
+                if (*_p == '[')
+                {
+                    value.type = Json::Array;
+                    _p++, Skip();
+                    if (*_p == ']')
+                        return _p++, true;
+                    for (;;)
+                    {
+                        value.array.push_back(Json());
+                        if (!ParseValue(value.array.back()))
+                            return false;
+                        Skip();
+                        if (*_p == ']')
+                            return _p++, true;
+                        if (*_p++ != ',')
+                            return false;
+                    }
+                }
+                if (*_p == '"')
+                {
+                    value.type = Json::Str;
+                    return ParseString(value.str);
+                }
+                if (Match("true") || Match("false"))
+                {
+                    value.type = Json::Bool;
+                    return true;
+                }
+                if (Match("null"))
+                    return true;
+                char * end = NULL;
+                value.type = Json::Number;
+                value.number = strtod(_p, &end);
+                if (end == _p || !(*_p == '-' || isdigit((unsigned char)*_p)) || value.number != value.number)
+                    return false;
+                _p = end;
+                return true;
+            }
+
+        public:
+            bool Parse(const char * text, Json & root)
+            {
+                _p = text;
+                if (!ParseValue(root))
+                    return false;
+                Skip();
+                return *_p == 0;
+            }
+        };
+
+        void Wait(double delay)
+        {
+            double finish = GetTime() + delay;
+            while (GetTime() < finish);
+        }
+
+        const size_t CALLS = 100, SLOW = 5;
+        const double FAST_DELAY = 0.0001, SLOW_DELAY = 0.004;
+        const int64_t FLOP = 1000000;
+
+        void Measure(const String & name)
+        {
+            for (size_t i = 0; i < CALLS; ++i)
+            {
+                Simd::Base::PerformanceMeasurerHolder holder(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(name, FLOP));
+                Wait(i < SLOW ? SLOW_DELAY : FAST_DELAY);
+            }
+        }
+
+        const Json * Find(const Json & list, const String & name)
+        {
+            for (size_t i = 0; i < list.array.size(); ++i)
+                if (list.array[i].Has("name", Json::Str) && list.array[i]["name"].str == name)
+                    return &list.array[i];
+            return NULL;
+        }
+
+        bool CheckStatistic(const Json & stat, size_t count, const String & where)
+        {
+            const char * fields[] = { "count", "total", "average", "min", "max", "p50", "p90", "p99", "gflops" };
+            for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); ++i)
+            {
+                if (!stat.Has(fields[i], Json::Number))
+                {
+                    TEST_LOG_SS(Error, where << " has no numeric field '" << fields[i] << "'!");
+                    return false;
+                }
+            }
+            if (stat["count"].number != count)
+            {
+                TEST_LOG_SS(Error, where << " has count " << stat["count"].number << " instead of " << count << "!");
+                return false;
+            }
+            double min = stat["min"].number, p50 = stat["p50"].number, p90 = stat["p90"].number, p99 = stat["p99"].number, max = stat["max"].number;
+            if (!(min <= p50 && p50 <= p90 && p90 <= p99 && p99 <= max) || stat["gflops"].number <= 0)
+            {
+                TEST_LOG_SS(Error, where << " has inconsistent statistic: min " << min << ", p50 " << p50 << ", p90 " << p90
+                    << ", p99 " << p99 << ", max " << max << ", gflops " << stat["gflops"].number << " !");
+                return false;
+            }
+            if (p50 >= SLOW_DELAY * 1000.0 / 2 || p99 <= SLOW_DELAY * 1000.0 / 2)
+            {
+                TEST_LOG_SS(Error, where << " has wrong percentiles: p50 " << p50 << " ms, p99 " << p99 << " ms!");
+                return false;
+            }
+            return true;
+        }
+    }
+
+    bool PerformanceReportAutoTest(size_t threads)
+    {
+        TEST_LOG_SS(Info, "Test JSON and trace reports of internal performance statistics for " << threads << " threads.");
+
+        bool result = true;
+        const String name = "PerformanceReportAutoTest\"" + ToString(GetTime(), 6, false) + "\"";
+
+        Simd::Base::PerformanceMeasurerStorage & storage = Simd::Base::PerformanceMeasurerStorage::s_storage;
+        bool tracing = storage.Tracing();
+        SimdPerformanceTrace(SimdTrue);
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t)
+            workers.push_back(std::thread(Measure, name));
+        for (size_t t = 0; t < threads; ++t)
+            workers[t].join();
+        SimdPerformanceTrace(tracing ? SimdTrue : SimdFalse);
+
+        Json report, trace;
+        if (!JsonParser().Parse(SimdPerformanceReport(SimdPerformanceReportJson), report))
+        {
+            TEST_LOG_SS(Error, "JSON report is not a valid JSON!");
+            return false;
+        }
+        if (!JsonParser().Parse(SimdPerformanceReport(SimdPerformanceReportTrace), trace))
+        {
+            TEST_LOG_SS(Error, "Trace report is not a valid JSON!");
+            return false;
+        }
+
+        const Json * function = report.Has("functions", Json::Array) ? Find(report["functions"], name) : NULL;
+        if (function == NULL || !function->Has("threads", Json::Array))
+        {
+            TEST_LOG_SS(Error, "JSON report has no entry with per-thread breakdown for the measured function!");
+            return false;
+        }
+        result = result && CheckStatistic(*function, CALLS * threads, "Function entry");
+        const Json & list = (*function)["threads"];
+        std::set<double> indices;
+        for (size_t i = 0; i < list.array.size() && result; ++i)
+        {
+            if (!list.array[i].Has("thread", Json::Number))
+            {
+                TEST_LOG_SS(Error, "Thread entry " << i << " has no thread index!");
+                result = false;
+            }
+            else
+            {
+                indices.insert(list.array[i]["thread"].number);
+                result = CheckStatistic(list.array[i], CALLS, "Thread entry " + ToString(i));
+            }
+        }
+        if (result && (list.array.size() != threads || indices.size() != threads))
+        {
+            TEST_LOG_SS(Error, "JSON report has " << list.array.size() << " thread entries (" << indices.size() << " unique) instead of " << threads << "!");
+            result = false;
+        }
+
+        if (!trace.Has("traceEvents", Json::Array) || !trace.Has("displayTimeUnit", Json::Str))
+        {
+            TEST_LOG_SS(Error, "Trace report has no trace events!");
+            return false;
+        }
+        const Json & events = trace["traceEvents"];
+        size_t spans = 0;
+        std::set<double> tids;
+        for (size_t i = 0; i < events.array.size() && result; ++i)
+        {
+            const Json & event = events.array[i];
+            if (!(event.Has("name", Json::Str) && event.Has("ph", Json::Str) && event.Has("ts", Json::Number) &&
+                event.Has("dur", Json::Number) && event.Has("pid", Json::Number) && event.Has("tid", Json::Number)) ||
+                event["ph"].str != "X" || event["ts"].number < 0 || event["dur"].number < 0)
+            {
+                TEST_LOG_SS(Error, "Trace event " << i << " is malformed!");
+                result = false;
+            }
+            else if (event["name"].str == name)
+            {
+                spans++;
+                tids.insert(event["tid"].number);
+            }
+        }
+        if (result && (spans != CALLS * threads || tids.size() != threads))
+        {
+            TEST_LOG_SS(Error, "Trace report has " << spans << " spans in " << tids.size() << " threads instead of " << CALLS * threads << " in " << threads << "!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool PerformanceReportAutoTest()
+    {
+        bool result = true;
+
+        result = result && PerformanceReportAutoTest(1);
+        result = result && PerformanceReportAutoTest(3);
+
+        return result;
+    }
+#else
+    bool PerformanceReportAutoTest()
+    {
+        TEST_LOG_SS(Info, "Test of internal performance reports is skipped: Simd Library is built without SIMD_PERF.");
+
+        return true;
+    }
+#endif
+}
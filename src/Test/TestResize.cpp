@@ -27,6 +27,9 @@
 #include "Test/TestRandom.h"
 
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdResizerRoi.h"
+
+#include <thread>
 
 namespace Test
 {
@@ -154,6 +157,7 @@ namespace Test
         case SimdResizeMethodBicubic: return "BcO";
         case SimdResizeMethodArea: return "ArO";
         case SimdResizeMethodAreaFast: return "ArF";
+        case SimdResizeMethodLanczos: return "Lc3";
         default: assert(0); return "";
         }
     }
@@ -289,11 +293,11 @@ namespace Test
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, type, method));
 
         if (format == View::Float)
-            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
         else if(format == View::Int16)
             result = result && Compare(dst1, dst2, 1, true, 64);
         else
-            result = result && Compare(dst1, dst2, 0, true, 64);
+            result = result && Compare(dst1, dst2, method == SimdResizeMethodLanczos ? 1 : 0, true, 64);
 
 #if defined(TEST_RESIZE_REAL_IMAGE) && 0
         String suffix = ToString(method) + "_" + ToString(method == SimdResizeMethodBicubic ? SIMD_RESIZER_BICUBIC_BITS : 4);
@@ -349,14 +353,14 @@ namespace Test
         result = result && ResizerAutoTest(SimdResizeMethodBicubic, SimdResizeChannelByte, 4, 100, 2, 200, 10, f1, f2);
 
 #if !defined(__aarch64__) || 1  
-        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodNearest, SimdResizeMethodBilinear, SimdResizeMethodBicubic, SimdResizeMethodArea, SimdResizeMethodAreaFast };
+        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodNearest, SimdResizeMethodBilinear, SimdResizeMethodBicubic, SimdResizeMethodArea, SimdResizeMethodAreaFast, SimdResizeMethodLanczos };
         for (size_t m = 0; m < methods.size(); ++m)
         {
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelByte, 1, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelByte, 2, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelByte, 3, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelByte, 4, f1, f2);
-            if (methods[m] == SimdResizeMethodBicubic || methods[m] == SimdResizeMethodArea || methods[m] == SimdResizeMethodAreaFast)
+            if (methods[m] == SimdResizeMethodAreaFast)
                 continue;
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelShort, 1, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelShort, 2, f1, f2);
@@ -406,6 +410,387 @@ namespace Test
 
     //---------------------------------------------------------------------------------------------
 
+    namespace
+    {
+        Simd::Base::ResizerInitPtr ResizerInitBest()
+        {
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                return Simd::Avx512bw::ResizerInit;
+#endif
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                return Simd::Avx2::ResizerInit;
+#endif
+#ifdef SIMD_AVX_ENABLE
+            if (Simd::Avx::Enable)
+                return Simd::Avx::ResizerInit;
+#endif
+#ifdef SIMD_SSE41_ENABLE
+            if (Simd::Sse41::Enable)
+                return Simd::Sse41::ResizerInit;
+#endif
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                return Simd::Neon::ResizerInit;
+#endif
+            return Simd::Base::ResizerInit;
+        }
+
+        template<size_t bands> void* ResizerParallelInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            Simd::ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(void*));
+            Simd::Base::ResizerParallel* resizer = new Simd::Base::ResizerParallel(param, ResizerInitBest(), bands);
+            if (resizer->Bands() == bands)
+                return resizer;
+            delete resizer;
+            return NULL;
+        }
+    }
+
+    bool ResizerParallelAutoTest(SimdResizeMethodType method, SimdResizeChannelType type, size_t channels, size_t srcW, size_t srcH, size_t dstW, size_t dstH)
+    {
+        bool result = true;
+
+        result = result && ResizerAutoTest(method, type, channels, srcW, srcH, dstW, dstH, FUNC_RS(ResizerParallelInit<1>), FUNC_RS(ResizerParallelInit<2>));
+        result = result && ResizerAutoTest(method, type, channels, srcW, srcH, dstW, dstH, FUNC_RS(ResizerParallelInit<1>), FUNC_RS(ResizerParallelInit<4>));
+        result = result && ResizerAutoTest(method, type, channels, srcW, srcH, dstW, dstH, FUNC_RS(ResizerParallelInit<1>), FUNC_RS(ResizerParallelInit<8>));
+
+        return result;
+    }
+
+    bool ResizerParallelAutoTest()
+    {
+        bool result = true;
+
+        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodNearest, SimdResizeMethodBilinear, SimdResizeMethodBicubic, SimdResizeMethodArea, SimdResizeMethodAreaFast, SimdResizeMethodLanczos };
+        for (size_t m = 0; m < methods.size(); ++m)
+        {
+            result = result && ResizerParallelAutoTest(methods[m], SimdResizeChannelByte, 3, 1920, 1080, 640, 360);
+            result = result && ResizerParallelAutoTest(methods[m], SimdResizeChannelByte, 4, 1999, 1499, 319, 239);
+            result = result && ResizerParallelAutoTest(methods[m], SimdResizeChannelByte, 1, 640, 360, 1920, 1080);
+            if (methods[m] == SimdResizeMethodAreaFast)
+                continue;
+            result = result && ResizerParallelAutoTest(methods[m], SimdResizeChannelShort, 3, 1920, 1080, 640, 360);
+            result = result && ResizerParallelAutoTest(methods[m], SimdResizeChannelFloat, 3, 1920, 1080, 640, 360);
+        }
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncRY
+        {
+            typedef void*(*FuncPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdYuvLayoutType layout, SimdResizeMethodType method);
+
+            FuncPtr func;
+            String description;
+
+            FuncRY(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdYuvLayoutType layout, SimdResizeMethodType method, size_t srcW, size_t srcH, size_t dstW, size_t dstH)
+            {
+                std::stringstream ss;
+                ss << description << "[" << (layout == SimdYuvLayoutNv12 ? "Nv12" : "Yuv420p") << ":" << srcW << "x" << srcH << "->" << dstW << "x" << dstH;
+                ss << ":" << ToString(method) << "]";
+                description = ss.str();
+            }
+
+            void Call(const View* src, View* dst, SimdYuvLayoutType layout, SimdResizeMethodType method) const
+            {
+                void* resizer = func(src[0].width, src[0].height, dst[0].width, dst[0].height, layout, method);
+                if (resizer)
+                {
+                    const uint8_t* srcPlanes[3] = { src[0].data, src[1].data, src[2].data };
+                    size_t srcStrides[3] = { src[0].stride, src[1].stride, src[2].stride };
+                    uint8_t* dstPlanes[3] = { dst[0].data, dst[1].data, dst[2].data };
+                    size_t dstStrides[3] = { dst[0].stride, dst[1].stride, dst[2].stride };
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdResizerYuvRun(resizer, srcPlanes, srcStrides, dstPlanes, dstStrides);
+                    }
+                    SimdRelease(resizer);
+                }
+            }
+        };
+
+        template<size_t threads> void* ResizerYuvInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdYuvLayoutType layout, SimdResizeMethodType method)
+        {
+            return Simd::Base::ResizerYuvInit(ResizerInitBest(), threads, srcX, srcY, dstX, dstY, layout, method);
+        }
+    }
+
+#define FUNC_RY(function) \
+    FuncRY(function, std::string(#function))
+
+    static void CreateYuvPlanes(SimdYuvLayoutType layout, size_t width, size_t height, View* planes)
+    {
+        size_t uvW = (width + 1) / 2, uvH = (height + 1) / 2;
+        planes[0].Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        if (layout == SimdYuvLayoutNv12)
+            planes[1].Recreate(uvW, uvH, View::Uv16, NULL, TEST_ALIGN(uvW));
+        else
+        {
+            planes[1].Recreate(uvW, uvH, View::Gray8, NULL, TEST_ALIGN(uvW));
+            planes[2].Recreate(uvW, uvH, View::Gray8, NULL, TEST_ALIGN(uvW));
+        }
+    }
+
+    bool ResizerYuvAutoTest(SimdYuvLayoutType layout, SimdResizeMethodType method, size_t srcW, size_t srcH, size_t dstW, size_t dstH, FuncRY f1, FuncRY f2)
+    {
+        bool result = true;
+
+        f1.Update(layout, method, srcW, srcH, dstW, dstH);
+        f2.Update(layout, method, srcW, srcH, dstW, dstH);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        size_t planes = layout == SimdYuvLayoutNv12 ? 2 : 3;
+        View src[3], dst1[3], dst2[3];
+        CreateYuvPlanes(layout, srcW, srcH, src);
+        CreateYuvPlanes(layout, dstW, dstH, dst1);
+        CreateYuvPlanes(layout, dstW, dstH, dst2);
+        for (size_t p = 0; p < planes; ++p)
+        {
+            FillRandom(src[p]);
+            Simd::Fill(dst1[p], 0x01);
+            Simd::Fill(dst2[p], 0x02);
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, layout, method));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, layout, method));
+
+        for (size_t p = 0; p < planes && result; ++p)
+            result = result && Compare(dst1[p], dst2[p], 0, true, 64, 0, p == 0 ? "Y" : (planes == 2 ? "UV" : (p == 1 ? "U" : "V")));
+
+        return result;
+    }
+
+    bool ResizerYuvAutoTest(const FuncRY& f1, const FuncRY& f2)
+    {
+        bool result = true;
+
+        std::vector<SimdYuvLayoutType> layouts = { SimdYuvLayoutNv12, SimdYuvLayoutYuv420p };
+        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodBilinear, SimdResizeMethodBicubic, SimdResizeMethodArea };
+        for (size_t l = 0; l < layouts.size(); ++l)
+        {
+            for (size_t m = 0; m < methods.size(); ++m)
+            {
+                result = result && ResizerYuvAutoTest(layouts[l], methods[m], 3840, 2160, 1280, 720, f1, f2);
+                result = result && ResizerYuvAutoTest(layouts[l], methods[m], 1919, 1079, 853, 479, f1, f2);
+                result = result && ResizerYuvAutoTest(layouts[l], methods[m], 320, 240, 641, 361, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool ResizerYuvAutoTest()
+    {
+        bool result = true;
+
+        result = result && ResizerYuvAutoTest(FUNC_RY(ResizerYuvInit<1>), FUNC_RY(SimdResizerYuvInit));
+
+        result = result && ResizerYuvAutoTest(FUNC_RY(ResizerYuvInit<1>), FUNC_RY(ResizerYuvInit<4>));
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    bool ResizerCacheAutoTest(View::Format format, const Size& srcSize, const Size& dstSize, SimdResizeMethodType method, size_t repeats, size_t threads)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test ResizerCache [" << ToString(format) << ":" << srcSize.x << "x" << srcSize.y << "->" << dstSize.x << "x" << dstSize.y <<
+            ":" << ToString(method) << "] repeats: " << repeats << ", threads: " << threads << ".");
+
+        View src(srcSize, format);
+        FillRandom(src);
+
+        View control(dstSize, format);
+        SimdResizeChannelType type = format == View::Float ? SimdResizeChannelFloat : (src.ChannelSize() == 2 ? SimdResizeChannelShort : SimdResizeChannelByte);
+        void* resizer = SimdResizerInit(src.width, src.height, control.width, control.height, src.ChannelCount(), type, method);
+        if (resizer == NULL)
+            return false;
+        SimdResizerRun(resizer, src.data, src.stride, control.data, control.stride);
+        SimdRelease(resizer);
+
+        std::vector<View> dst(threads);
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t)
+        {
+            dst[t].Recreate(dstSize, format);
+            workers.push_back(std::thread([&, t]()
+            {
+                for (size_t r = 0; r < repeats; ++r)
+                {
+                    Simd::Fill(dst[t], uint8_t(r));
+                    TEST_PERFORMANCE_TEST("Simd::Resize(View)");
+                    Simd::Resize(src, dst[t], method);
+                }
+            }));
+        }
+        for (size_t t = 0; t < threads; ++t)
+            workers[t].join();
+
+        for (size_t t = 0; t < threads && result; ++t)
+            result = result && Compare(control, dst[t], 0, true, 64);
+
+        return result;
+    }
+
+    bool ResizerCacheAutoTest()
+    {
+        bool result = true;
+
+        size_t capacity = SimdResizerCacheGetCapacity();
+
+        result = result && ResizerCacheAutoTest(View::Bgr24, Size(1920, 1080), Size(640, 360), SimdResizeMethodBilinear, 10, 1);
+        result = result && ResizerCacheAutoTest(View::Gray8, Size(640, 480), Size(1280, 720), SimdResizeMethodArea, 10, 4);
+        result = result && ResizerCacheAutoTest(View::Bgra32, Size(1280, 720), Size(224, 224), SimdResizeMethodBicubic, 10, 4);
+
+        SimdResizerCacheSetCapacity(1);
+        result = result && ResizerCacheAutoTest(View::Bgr24, Size(1920, 1080), Size(640, 360), SimdResizeMethodBilinear, 5, 4);
+        result = result && ResizerCacheAutoTest(View::Gray8, Size(1920, 1080), Size(853, 480), SimdResizeMethodBilinear, 5, 2);
+
+        SimdResizerCacheSetCapacity(0);
+        result = result && ResizerCacheAutoTest(View::Bgr24, Size(1920, 1080), Size(640, 360), SimdResizeMethodBilinear, 3, 2);
+
+        SimdResizerCacheSetCapacity(capacity);
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncRR
+        {
+            typedef void*(*FuncPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+            FuncPtr func;
+            String description;
+
+            FuncRR(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdResizeChannelType type, size_t channels, size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t count)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels << ":" << srcW << "x" << srcH << "->" << count << "x" << dstW << "x" << dstH;
+                ss << ":" << ToString(type) << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t srcW, size_t srcH, const Buffer32f& rois, size_t count, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, View& dst) const
+            {
+                void* resizer = func(srcW, srcH, dstW, dstH, channels, type, SimdResizeMethodBilinear);
+                if (resizer)
+                {
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdResizerRoiRun(resizer, src.data, src.stride, rois.data(), count, dst.data);
+                    }
+                    SimdRelease(resizer);
+                }
+            }
+        };
+    }
+
+#define FUNC_RR(function) \
+    FuncRR(function, std::string(#function))
+
+    bool ResizerRoiAutoTest(SimdResizeChannelType type, size_t channels, size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t count, FuncRR f1, FuncRR f2)
+    {
+        bool result = true;
+
+        f1.Update(type, channels, srcW, srcH, dstW, dstH, count);
+        f2.Update(type, channels, srcW, srcH, dstW, dstH, count);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << srcW << ", " << srcH << "] -> " << count << " x [" << dstW << ", " << dstH << "].");
+
+        View::Format format = type == SimdResizeChannelFloat ? View::Float : View::Gray8;
+        View src(srcW * channels, srcH, format, NULL, TEST_ALIGN(srcW * channels));
+        if (format == View::Float)
+            FillRandom32f(src);
+        else
+            FillRandom(src);
+
+        Buffer32f rois(count * 4);
+        for (size_t i = 0; i < count; ++i)
+        {
+            float w = float(2 + Random(int(srcW / 2) + 1)), h = float(2 + Random(int(srcH / 2) + 1));
+            float x = float(Random() * (srcW + w / 2) - w / 4), y = float(Random() * (srcH + h / 2) - h / 4);
+            rois[i * 4 + 0] = x;
+            rois[i * 4 + 1] = y;
+            rois[i * 4 + 2] = x + w;
+            rois[i * 4 + 3] = y + h;
+        }
+
+        View dst1(dstW * dstH * channels, count, format, NULL, 1);
+        View dst2(dstW * dstH * channels, count, format, NULL, 1);
+        Simd::Fill(dst1, 0x01);
+        Simd::Fill(dst2, 0x02);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, srcW, srcH, rois, count, dstW, dstH, channels, type, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, srcW, srcH, rois, count, dstW, dstH, channels, type, dst2));
+
+        if (format == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+        else
+            result = result && Compare(dst1, dst2, 1, true, 64);
+
+        return result;
+    }
+
+    bool ResizerRoiAutoTest(const FuncRR& f1, const FuncRR& f2)
+    {
+        bool result = true;
+
+        for (size_t channels = 1; channels <= 4; ++channels)
+        {
+            result = result && ResizerRoiAutoTest(SimdResizeChannelByte, channels, 1920, 1080, 112, 112, 100, f1, f2);
+            result = result && ResizerRoiAutoTest(SimdResizeChannelFloat, channels, 1920, 1080, 112, 112, 100, f1, f2);
+        }
+        result = result && ResizerRoiAutoTest(SimdResizeChannelByte, 3, 640, 360, 7, 7, 200, f1, f2);
+        result = result && ResizerRoiAutoTest(SimdResizeChannelFloat, 5, 80, 60, 14, 14, 50, f1, f2);
+        result = result && ResizerRoiAutoTest(SimdResizeChannelByte, 3, 1, 1, 9, 9, 3, f1, f2);
+
+        return result;
+    }
+
+    bool ResizerRoiAutoTest()
+    {
+        bool result = true;
+
+        result = result && ResizerRoiAutoTest(FUNC_RR(Simd::Base::ResizerRoiInit), FUNC_RR(SimdResizerRoiInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && ResizerRoiAutoTest(FUNC_RR(Simd::Sse41::ResizerRoiInit), FUNC_RR(SimdResizerRoiInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && ResizerRoiAutoTest(FUNC_RR(Simd::Avx2::ResizerRoiInit), FUNC_RR(SimdResizerRoiInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && ResizerRoiAutoTest(FUNC_RR(Simd::Avx512bw::ResizerRoiInit), FUNC_RR(SimdResizerRoiInit));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
     bool ResizeSpecialTest(View::Format format, const Size & src, const Size & dst, const FuncRB & f1, const FuncRB & f2)
     {
         bool result = true;
@@ -0,0 +1,195 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestLog.h"
+
+#include "Simd/SimdRuntime.h"
+
+#include <fstream>
+#include <cstdio>
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncArgs
+        {
+            String key;
+
+            FuncArgs(const String & k) : key(k) {}
+        };
+
+        struct Func
+        {
+            Func(const String & name, double delay, size_t * count)
+                : _name(name)
+                , _delay(delay)
+                , _count(count)
+            {
+            }
+
+            String Name() const { return _name; }
+
+            void Run(const FuncArgs & args)
+            {
+                (*_count)++;
+                double finish = GetTime() + _delay;
+                while (GetTime() < finish);
+            }
+
+            String Info(const FuncArgs & args) const
+            {
+                return "TestRuntime [" + args.key + "]";
+            }
+
+        private:
+            String _name;
+            double _delay;
+            size_t * _count;
+        };
+
+        typedef Simd::Runtime<Func, FuncArgs> FuncRuntime;
+
+        struct Counts
+        {
+            size_t slow, fast;
+
+            Counts() : slow(0), fast(0) {}
+        };
+
+        void Init(FuncRuntime & runtime, Counts & counts)
+        {
+            std::vector<Func> funcs;
+            funcs.push_back(Func("slow", 0.002, &counts.slow));
+            funcs.push_back(Func("fast", 0.0, &counts.fast));
+            runtime.Init(funcs);
+        }
+
+        bool WriteFile(const String & path, const String & data)
+        {
+            std::ofstream ofs(path.c_str());
+            ofs << data;
+            return !ofs.fail();
+        }
+
+        String ReadFile(const String & path)
+        {
+            std::ifstream ifs(path.c_str());
+            std::stringstream ss;
+            ss << ifs.rdbuf();
+            return ss.str();
+        }
+    }
+
+    bool RuntimeCacheAutoTest()
+    {
+        TEST_LOG_SS(Info, "Test Simd::Runtime cache save, load and rejection of malformed file.");
+
+        bool result = true;
+        const String path = "runtime_cache_test.txt";
+        FuncArgs args(ToString(GetTime(), 6, false));
+
+        FuncRuntime tuned;
+        Counts tunedCounts;
+        Init(tuned, tunedCounts);
+        for (size_t i = 0; i < 100 && !tuned.Tuned(); ++i)
+            tuned.Run(args);
+        if (!tuned.Tuned() || tunedCounts.slow == 0 || tunedCounts.fast == 0)
+        {
+            TEST_LOG_SS(Error, "Simd::Runtime is not tuned after exploration of both candidates!");
+            return false;
+        }
+        tunedCounts = Counts();
+        tuned.Run(args);
+        if (tunedCounts.slow != 0 || tunedCounts.fast != 1)
+        {
+            TEST_LOG_SS(Error, "Simd::Runtime has chosen slow candidate!");
+            return false;
+        }
+
+        if (!SimdRuntimeCacheSave(path.c_str()))
+        {
+            TEST_LOG_SS(Error, "Can't save runtime cache to '" << path << "'!");
+            return false;
+        }
+        String valid = ReadFile(path);
+        Simd::Base::RuntimeCacheClear();
+        if (!SimdRuntimeCacheLoad(path.c_str()))
+        {
+            TEST_LOG_SS(Error, "Can't load runtime cache from '" << path << "'!");
+            result = false;
+        }
+
+        FuncRuntime loaded;
+        Counts loadedCounts;
+        Init(loaded, loadedCounts);
+        loaded.Run(args);
+        if (!loaded.Tuned() || loadedCounts.slow != 0 || loadedCounts.fast != 1)
+        {
+            TEST_LOG_SS(Error, "Simd::Runtime explores candidates in spite of loaded cache: slow " << loadedCounts.slow << ", fast " << loadedCounts.fast << " runs!");
+            result = false;
+        }
+
+        const char * malformed[] = { "garbage\n", "model\tkey\n", "model\t\tname\n", "model\tkey\t\n", "model\tkey\tname\textra\n" };
+        for (size_t i = 0; i < sizeof(malformed) / sizeof(malformed[0]) && result; ++i)
+        {
+            Simd::Base::RuntimeCacheClear();
+            if (!WriteFile(path, valid + malformed[i]))
+            {
+                TEST_LOG_SS(Error, "Can't write file '" << path << "'!");
+                result = false;
+            }
+            else if (SimdRuntimeCacheLoad(path.c_str()))
+            {
+                TEST_LOG_SS(Error, "Malformed runtime cache file (line " << i << ") is loaded!");
+                result = false;
+            }
+            FuncRuntime rejected;
+            Counts rejectedCounts;
+            Init(rejected, rejectedCounts);
+            rejected.Run(args);
+            if (rejected.Tuned())
+            {
+                TEST_LOG_SS(Error, "Malformed runtime cache file (line " << i << ") changes the cache!");
+                result = false;
+            }
+        }
+
+        std::remove(path.c_str());
+        Simd::Base::RuntimeCacheClear();
+
+        return result;
+    }
+
+    bool RuntimeAutoTest()
+    {
+        bool result = true;
+
+        result = result && RuntimeCacheAutoTest();
+
+        return result;
+    }
+}
@@ -28,6 +28,7 @@
 #include "Test/TestRandom.h"
 
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetInputResizer.h"
 
 namespace Test
 {
@@ -331,5 +332,169 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncIR
+        {
+            typedef void* (*FuncPtr)(SimdPixelFormatType srcFormat, SimdYuvLayoutType yuvLayout, SimdYuvType yuvType,
+                size_t cropX, size_t cropY, size_t cropWidth, size_t cropHeight, size_t dstWidth, size_t dstHeight, size_t channels,
+                const float* mean, const float* scale, SimdTensorDataType dstType, SimdTensorFormatType dstFormat);
+
+            FuncPtr func;
+            String desc;
+
+            FuncIR(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(const String& src, const Rect& crop, size_t c, size_t h, size_t w, SimdTensorDataType type, SimdTensorFormatType format)
+            {
+                desc = desc + "[" + src + ":" + ToString(crop.Width()) + "x" + ToString(crop.Height()) + "->" + 
+                    ToString(c) + "x" + ToString(h) + "x" + ToString(w) + ":" + ToString(type) + ":" + ToString(format) + "]";
+            }
+
+            void Call(const void* context, const uint8_t* const* src, const size_t* stride, uint8_t* dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                SimdSynetInputResizerRun(context, src, stride, dst);
+            }
+        };
+    }
+
+#define FUNC_IR(function) FuncIR(function, #function)
+
+    bool SynetInputResizerAutoTest(View::Format srcFormat, SimdYuvLayoutType yuvLayout, const Rect& crop, size_t c, size_t h, size_t w, 
+        SimdTensorDataType type, SimdTensorFormatType format, FuncIR f1, FuncIR f2)
+    {
+        bool result = true;
+
+        String src = srcFormat != View::None ? ToString(srcFormat) : (yuvLayout == SimdYuvLayoutNv12 ? "Nv12" : "Yuv420p");
+        f1.Update(src, crop, c, h, w, type, format);
+        f2.Update(src, crop, c, h, w, type, format);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        size_t srcW = W / 2, srcH = H / 2;
+        View planes[3];
+        if (srcFormat != View::None)
+            planes[0].Recreate(srcW, srcH, srcFormat);
+        else
+        {
+            planes[0].Recreate(srcW, srcH, View::Gray8);
+            if (yuvLayout == SimdYuvLayoutNv12)
+                planes[1].Recreate(srcW / 2, srcH / 2, View::Uv16);
+            else
+            {
+                planes[1].Recreate(srcW / 2, srcH / 2, View::Gray8);
+                planes[2].Recreate(srcW / 2, srcH / 2, View::Gray8);
+            }
+        }
+        const uint8_t* data[3] = { NULL, NULL, NULL };
+        size_t stride[3] = { 0, 0, 0 };
+        for (size_t i = 0; i < 3; ++i)
+        {
+            if (planes[i].data)
+            {
+                FillRandom(planes[i]);
+                data[i] = planes[i].data;
+                stride[i] = planes[i].stride;
+            }
+        }
+
+        float mean[3] = { 104.0f, 117.0f, 123.0f }, scale[3] = { 0.0171f, 0.0175f, 0.0174f };
+        if (type == SimdTensorData8u)
+        {
+            for (size_t i = 0; i < 3; ++i)
+                mean[i] -= 128.0f / (scale[i] * 40.0f), scale[i] *= 40.0f;
+        }
+
+        void* context1 = f1.func((SimdPixelFormatType)srcFormat, yuvLayout, SimdYuvBt601, crop.left, crop.top, crop.Width(), crop.Height(), w, h, c, mean, scale, type, format);
+        void* context2 = f2.func((SimdPixelFormatType)srcFormat, yuvLayout, SimdYuvBt601, crop.left, crop.top, crop.Width(), crop.Height(), w, h, c, mean, scale, type, format);
+
+        Shape shape = ToShape(1, c, h, w, format);
+        if (type == SimdTensorData32f)
+        {
+            Tensor32f dst1(shape, format), dst2(shape, format);
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, data, stride, (uint8_t*)dst1.Data()));
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, data, stride, (uint8_t*)dst2.Data()));
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        }
+        else if (type == SimdTensorData16b)
+        {
+            Tensor16u dst1(shape, format), dst2(shape, format);
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, data, stride, (uint8_t*)dst1.Data()));
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, data, stride, (uint8_t*)dst2.Data()));
+            Tensor32f fp1(shape, format), fp2(shape, format);
+            SimdBFloat16ToFloat32(dst1.Data(), dst1.Size(), fp1.Data());
+            SimdBFloat16ToFloat32(dst2.Data(), dst2.Size(), fp2.Data());
+            result = result && Compare(fp1, fp2, 0.01, true, 64, DifferenceBoth);
+        }
+        else
+        {
+            Tensor8u dst1(shape, format), dst2(shape, format);
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, data, stride, dst1.Data()));
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, data, stride, dst2.Data()));
+            result = result && Compare(dst1, dst2, 1, true, 64);
+        }
+
+        SimdRelease(context1);
+        SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetInputResizerAutoTest(const FuncIR& f1, const FuncIR& f2)
+    {
+        bool result = true;
+
+        View::Format srcFormat[7] = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32, View::None, View::None };
+        SimdYuvLayoutType yuvLayout[7] = { SimdYuvLayoutGray8, SimdYuvLayoutGray8, SimdYuvLayoutGray8, SimdYuvLayoutGray8, SimdYuvLayoutGray8, SimdYuvLayoutNv12, SimdYuvLayoutYuv420p };
+        SimdTensorDataType type[3] = { SimdTensorData32f, SimdTensorData16b, SimdTensorData8u };
+        SimdTensorFormatType format[2] = { SimdTensorFormatNchw, SimdTensorFormatNhwc };
+        Rect down(W / 16 + 1, H / 14 + 1, W / 16 + W / 3 + 2, H / 14 + H / 3 + 2);
+        Rect up(W / 5 + 1, H / 5 + 1, W / 5 + W / 32 + 2, H / 5 + H / 32 + 2);
+
+        for (int s = 0; s < 7; ++s)
+        {
+            for (size_t c = 1; c <= 3; c += 2)
+            {
+                for (int t = 0; t < 3; ++t)
+                {
+                    for (int f = 0; f < 2; ++f)
+                        result = result && SynetInputResizerAutoTest(srcFormat[s], yuvLayout[s], down, c, H / 8 + O, W / 8 + O, type[t], format[f], f1, f2);
+                }
+            }
+        }
+
+        result = result && SynetInputResizerAutoTest(View::Bgr24, SimdYuvLayoutGray8, up, 3, H / 10 + 1, W / 10 + 1, SimdTensorData32f, SimdTensorFormatNchw, f1, f2);
+        result = result && SynetInputResizerAutoTest(View::None, SimdYuvLayoutNv12, up, 3, H / 10 + 1, W / 10 + 1, SimdTensorData8u, SimdTensorFormatNhwc, f1, f2);
+
+        return result;
+    }
+
+    bool SynetInputResizerAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetInputResizerAutoTest(FUNC_IR(Simd::Base::SynetInputResizerInit), FUNC_IR(SimdSynetInputResizerInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetInputResizerAutoTest(FUNC_IR(Simd::Sse41::SynetInputResizerInit), FUNC_IR(SimdSynetInputResizerInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetInputResizerAutoTest(FUNC_IR(Simd::Avx2::SynetInputResizerInit), FUNC_IR(SimdSynetInputResizerInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetInputResizerAutoTest(FUNC_IR(Simd::Avx512bw::SynetInputResizerInit), FUNC_IR(SimdSynetInputResizerInit));
+#endif 
+
+        return result;
+    }
 #endif
 }
@@ -567,6 +567,7 @@ namespace Test
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 512, 32, 32, 512, _1, _1, _1, _0, _0, 1, a, t), c, f1, f2);
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 256, 32, 32, 256, _1, _1, _1, _0, _0, 1, a, t), c, f1, f2);
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 128, 96, 128, 128, _1, _1, _1, _0, _0, 1, a, t), c, f1, f2);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(4, 3, 160, 160, 32, _3, _1, _2, _1, _1, 1, a, t), c, f1, f2);
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 511, 15, 20, 1023, _5, _1, _2, _2, _2, 1, a, t), c, f1, f2);
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 128, 150, 100, 128, _3, _1, _2, _1, _1, 1, a, t), c, f1, f2);
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 32, 37, 47, 48, _3, _1, _2, _1, _1, 1, a, t), c, f1, f2);
@@ -622,6 +623,59 @@ namespace Test
         return result;
     }
 
+    bool SynetWorkspaceAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetWorkspace.");
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const size_t N = 3;
+        Param params[N] = {
+            Param(1, 16, 56, 48, 32, _3, _1, _1, _1, _1, 1, SimdConvolutionActivationRelu, SimdTrue),
+            Param(1, 32, 28, 24, 64, _1, _1, _1, _0, _0, 1, SimdConvolutionActivationRelu, SimdTrue),
+            Param(1, 64, 28, 24, 64, _3, _1, _2, _1, _1, 64, SimdConvolutionActivationRelu, SimdTrue) };
+        void * workspace = ::SimdSynetWorkspaceInit();
+        size_t required = 0;
+        for (size_t i = 0; i < N && result; ++i)
+        {
+            const SimdConvolutionParameters & c = params[i].conv;
+            Tensor32f src({ 1, c.srcH, c.srcW, c.srcC });
+            Tensor32f weight({ c.kernelY, c.kernelX, c.srcC / c.group, c.dstC });
+            Tensor32f bias({ c.dstC });
+            Tensor32f dst1({ 1, c.dstH, c.dstW, c.dstC }), dst2({ 1, c.dstH, c.dstW, c.dstC });
+            FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+            FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+            FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+            void * context1 = ::SimdSynetConvolution32fInit(1, &c, SimdSynetCompatibilityDefault);
+            void * context2 = ::SimdSynetConvolution32fInit(1, &c, SimdSynetCompatibilityDefault);
+            ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), NULL);
+            ::SimdSynetConvolution32fSetParams(context2, weight.Data(), NULL, bias.Data(), NULL);
+            ::SimdSynetConvolution32fSetWorkspace(context2, workspace);
+            ::SimdSynetConvolution32fForward(context1, src.Data(), NULL, dst1.Data());
+            ::SimdSynetConvolution32fForward(context2, src.Data(), NULL, dst2.Data());
+            required = std::max(required, ::SimdSynetConvolution32fExternalBufferSize(context2) * sizeof(float));
+            if (::SimdSynetConvolution32fInternalBufferSize(context2) > ::SimdSynetConvolution32fInternalBufferSize(context1))
+            {
+                TEST_LOG_SS(Error, "Convolution bound to workspace uses internal buffer!");
+                result = false;
+            }
+            ::SimdRelease(context1);
+            ::SimdRelease(context2);
+
+            result = result && Compare(dst1, dst2, 0.001f, true, 64, DifferenceBoth);
+        }
+        if (result && ::SimdSynetWorkspaceSize(workspace) != required)
+        {
+            TEST_LOG_SS(Error, "SimdSynetWorkspaceSize() " << ::SimdSynetWorkspaceSize(workspace) << " != " << required << " !");
+            result = false;
+        }
+        ::SimdRelease(workspace);
+
+        return result;
+    }
+
     bool SynetConvolution32fForwardAutoTest()
     {
         const float EPS = 0.001f;
@@ -664,6 +718,8 @@ namespace Test
             result = result && SynetConvolution32fForwardAutoTest(2 * EPS, FUNC_C(Simd::Neon::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
 #endif
 
+        result = result && SynetWorkspaceAutoTest();
+
         return result;
     }
 #endif